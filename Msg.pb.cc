@@ -0,0 +1,4944 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: Msg.proto
+
+#include "Msg.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+PROTOBUF_CONSTEXPR request_msg_t::request_msg_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.transaction_)*/nullptr
+  , /*decltype(_impl_.type_)*/0u
+  , /*decltype(_impl_.client_id_)*/0u
+  , /*decltype(_impl_.request_id_)*/uint64_t{0u}} {}
+struct request_msg_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR request_msg_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~request_msg_tDefaultTypeInternal() {}
+  union {
+    request_msg_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 request_msg_tDefaultTypeInternal _request_msg_t_default_instance_;
+PROTOBUF_CONSTEXPR response_msg_t::response_msg_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.request_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/0u
+  , /*decltype(_impl_.succeed_)*/false
+  , /*decltype(_impl_.balance_)*/0
+  , /*decltype(_impl_.leader_id_)*/0u
+  , /*decltype(_impl_.shard_id_)*/0u} {}
+struct response_msg_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR response_msg_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~response_msg_tDefaultTypeInternal() {}
+  union {
+    response_msg_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 response_msg_tDefaultTypeInternal _response_msg_t_default_instance_;
+PROTOBUF_CONSTEXPR txn_msg_t::txn_msg_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sender_id_)*/0u
+  , /*decltype(_impl_.recver_id_)*/0u
+  , /*decltype(_impl_.amount_)*/0
+  , /*decltype(_impl_.bal_txn_flag_)*/false
+  , /*decltype(_impl_.config_txn_flag_)*/false
+  , /*decltype(_impl_.voters_)*/uint64_t{0u}
+  , /*decltype(_impl_.xshard_txn_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.xshard_phase_)*/0u} {}
+struct txn_msg_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR txn_msg_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~txn_msg_tDefaultTypeInternal() {}
+  union {
+    txn_msg_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 txn_msg_tDefaultTypeInternal _txn_msg_t_default_instance_;
+PROTOBUF_CONSTEXPR block_msg_t::block_msg_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.phash_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.nonce_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.txn_)*/nullptr
+  , /*decltype(_impl_.term_)*/0u
+  , /*decltype(_impl_.index_)*/0} {}
+struct block_msg_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR block_msg_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~block_msg_tDefaultTypeInternal() {}
+  union {
+    block_msg_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 block_msg_tDefaultTypeInternal _block_msg_t_default_instance_;
+PROTOBUF_CONSTEXPR bc_msg_t::bc_msg_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.blocks_)*/{}
+  , /*decltype(_impl_.committed_index_)*/0} {}
+struct bc_msg_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR bc_msg_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~bc_msg_tDefaultTypeInternal() {}
+  union {
+    bc_msg_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 bc_msg_tDefaultTypeInternal _bc_msg_t_default_instance_;
+PROTOBUF_CONSTEXPR replica_msg_t::replica_msg_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.request_vote_rpc_msg_)*/nullptr
+  , /*decltype(_impl_.request_vote_reply_msg_)*/nullptr
+  , /*decltype(_impl_.append_entry_rpc_msg_)*/nullptr
+  , /*decltype(_impl_.append_entry_reply_msg_)*/nullptr
+  , /*decltype(_impl_.timeout_now_msg_)*/nullptr
+  , /*decltype(_impl_.xshard_msg_)*/nullptr
+  , /*decltype(_impl_.type_)*/0u
+  , /*decltype(_impl_.receiver_id_)*/0u
+  , /*decltype(_impl_.shard_id_)*/0u} {}
+struct replica_msg_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR replica_msg_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~replica_msg_tDefaultTypeInternal() {}
+  union {
+    replica_msg_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 replica_msg_tDefaultTypeInternal _replica_msg_t_default_instance_;
+PROTOBUF_CONSTEXPR request_vote_rpc_msg_t::request_vote_rpc_msg_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.candidate_id_)*/0u
+  , /*decltype(_impl_.term_)*/0u
+  , /*decltype(_impl_.last_log_term_)*/0u
+  , /*decltype(_impl_.last_log_index_)*/0
+  , /*decltype(_impl_.leadership_transfer_)*/false} {}
+struct request_vote_rpc_msg_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR request_vote_rpc_msg_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~request_vote_rpc_msg_tDefaultTypeInternal() {}
+  union {
+    request_vote_rpc_msg_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 request_vote_rpc_msg_tDefaultTypeInternal _request_vote_rpc_msg_t_default_instance_;
+PROTOBUF_CONSTEXPR request_vote_reply_msg_t::request_vote_reply_msg_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.term_)*/0u
+  , /*decltype(_impl_.vote_granted_)*/false
+  , /*decltype(_impl_.sender_id_)*/0u} {}
+struct request_vote_reply_msg_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR request_vote_reply_msg_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~request_vote_reply_msg_tDefaultTypeInternal() {}
+  union {
+    request_vote_reply_msg_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 request_vote_reply_msg_tDefaultTypeInternal _request_vote_reply_msg_t_default_instance_;
+PROTOBUF_CONSTEXPR append_entry_rpc_msg_t::append_entry_rpc_msg_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.term_)*/0u
+  , /*decltype(_impl_.leader_id_)*/0u
+  , /*decltype(_impl_.prev_log_term_)*/0u
+  , /*decltype(_impl_.prev_log_index_)*/0
+  , /*decltype(_impl_.commit_index_)*/0} {}
+struct append_entry_rpc_msg_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR append_entry_rpc_msg_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~append_entry_rpc_msg_tDefaultTypeInternal() {}
+  union {
+    append_entry_rpc_msg_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 append_entry_rpc_msg_tDefaultTypeInternal _append_entry_rpc_msg_t_default_instance_;
+PROTOBUF_CONSTEXPR append_entry_reply_msg_t::append_entry_reply_msg_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.term_)*/0u
+  , /*decltype(_impl_.sender_id_)*/0u
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.reply_heartbeat_)*/false
+  , /*decltype(_impl_.match_index_)*/0
+  , /*decltype(_impl_.commit_index_)*/-1} {}
+struct append_entry_reply_msg_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR append_entry_reply_msg_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~append_entry_reply_msg_tDefaultTypeInternal() {}
+  union {
+    append_entry_reply_msg_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 append_entry_reply_msg_tDefaultTypeInternal _append_entry_reply_msg_t_default_instance_;
+PROTOBUF_CONSTEXPR timeout_now_msg_t::timeout_now_msg_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.term_)*/0u
+  , /*decltype(_impl_.leader_id_)*/0u} {}
+struct timeout_now_msg_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR timeout_now_msg_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~timeout_now_msg_tDefaultTypeInternal() {}
+  union {
+    timeout_now_msg_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 timeout_now_msg_tDefaultTypeInternal _timeout_now_msg_t_default_instance_;
+PROTOBUF_CONSTEXPR xshard_msg_t::xshard_msg_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.txn_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.from_shard_)*/0u
+  , /*decltype(_impl_.sender_id_)*/0u
+  , /*decltype(_impl_.recver_id_)*/0u
+  , /*decltype(_impl_.amount_)*/0
+  , /*decltype(_impl_.commit_)*/false} {}
+struct xshard_msg_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR xshard_msg_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~xshard_msg_tDefaultTypeInternal() {}
+  union {
+    xshard_msg_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 xshard_msg_tDefaultTypeInternal _xshard_msg_t_default_instance_;
+static ::_pb::Metadata file_level_metadata_Msg_2eproto[12];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_Msg_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_Msg_2eproto = nullptr;
+
+const uint32_t TableStruct_Msg_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::request_msg_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::request_msg_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::request_msg_t, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::request_msg_t, _impl_.client_id_),
+  PROTOBUF_FIELD_OFFSET(::request_msg_t, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::request_msg_t, _impl_.transaction_),
+  1,
+  2,
+  3,
+  0,
+  PROTOBUF_FIELD_OFFSET(::response_msg_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::response_msg_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::response_msg_t, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::response_msg_t, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::response_msg_t, _impl_.succeed_),
+  PROTOBUF_FIELD_OFFSET(::response_msg_t, _impl_.balance_),
+  PROTOBUF_FIELD_OFFSET(::response_msg_t, _impl_.leader_id_),
+  PROTOBUF_FIELD_OFFSET(::response_msg_t, _impl_.shard_id_),
+  1,
+  0,
+  2,
+  3,
+  4,
+  5,
+  PROTOBUF_FIELD_OFFSET(::txn_msg_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::txn_msg_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::txn_msg_t, _impl_.sender_id_),
+  PROTOBUF_FIELD_OFFSET(::txn_msg_t, _impl_.recver_id_),
+  PROTOBUF_FIELD_OFFSET(::txn_msg_t, _impl_.amount_),
+  PROTOBUF_FIELD_OFFSET(::txn_msg_t, _impl_.bal_txn_flag_),
+  PROTOBUF_FIELD_OFFSET(::txn_msg_t, _impl_.config_txn_flag_),
+  PROTOBUF_FIELD_OFFSET(::txn_msg_t, _impl_.voters_),
+  PROTOBUF_FIELD_OFFSET(::txn_msg_t, _impl_.xshard_phase_),
+  PROTOBUF_FIELD_OFFSET(::txn_msg_t, _impl_.xshard_txn_id_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  7,
+  6,
+  PROTOBUF_FIELD_OFFSET(::block_msg_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::block_msg_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::block_msg_t, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::block_msg_t, _impl_.phash_),
+  PROTOBUF_FIELD_OFFSET(::block_msg_t, _impl_.nonce_),
+  PROTOBUF_FIELD_OFFSET(::block_msg_t, _impl_.txn_),
+  PROTOBUF_FIELD_OFFSET(::block_msg_t, _impl_.index_),
+  3,
+  0,
+  1,
+  2,
+  4,
+  PROTOBUF_FIELD_OFFSET(::bc_msg_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::bc_msg_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::bc_msg_t, _impl_.committed_index_),
+  PROTOBUF_FIELD_OFFSET(::bc_msg_t, _impl_.blocks_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::replica_msg_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::replica_msg_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::replica_msg_t, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::replica_msg_t, _impl_.receiver_id_),
+  PROTOBUF_FIELD_OFFSET(::replica_msg_t, _impl_.request_vote_rpc_msg_),
+  PROTOBUF_FIELD_OFFSET(::replica_msg_t, _impl_.request_vote_reply_msg_),
+  PROTOBUF_FIELD_OFFSET(::replica_msg_t, _impl_.append_entry_rpc_msg_),
+  PROTOBUF_FIELD_OFFSET(::replica_msg_t, _impl_.append_entry_reply_msg_),
+  PROTOBUF_FIELD_OFFSET(::replica_msg_t, _impl_.timeout_now_msg_),
+  PROTOBUF_FIELD_OFFSET(::replica_msg_t, _impl_.shard_id_),
+  PROTOBUF_FIELD_OFFSET(::replica_msg_t, _impl_.xshard_msg_),
+  6,
+  7,
+  0,
+  1,
+  2,
+  3,
+  4,
+  8,
+  5,
+  PROTOBUF_FIELD_OFFSET(::request_vote_rpc_msg_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::request_vote_rpc_msg_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::request_vote_rpc_msg_t, _impl_.candidate_id_),
+  PROTOBUF_FIELD_OFFSET(::request_vote_rpc_msg_t, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::request_vote_rpc_msg_t, _impl_.last_log_term_),
+  PROTOBUF_FIELD_OFFSET(::request_vote_rpc_msg_t, _impl_.last_log_index_),
+  PROTOBUF_FIELD_OFFSET(::request_vote_rpc_msg_t, _impl_.leadership_transfer_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::request_vote_reply_msg_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::request_vote_reply_msg_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::request_vote_reply_msg_t, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::request_vote_reply_msg_t, _impl_.vote_granted_),
+  PROTOBUF_FIELD_OFFSET(::request_vote_reply_msg_t, _impl_.sender_id_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::append_entry_rpc_msg_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::append_entry_rpc_msg_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::append_entry_rpc_msg_t, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::append_entry_rpc_msg_t, _impl_.leader_id_),
+  PROTOBUF_FIELD_OFFSET(::append_entry_rpc_msg_t, _impl_.prev_log_term_),
+  PROTOBUF_FIELD_OFFSET(::append_entry_rpc_msg_t, _impl_.prev_log_index_),
+  PROTOBUF_FIELD_OFFSET(::append_entry_rpc_msg_t, _impl_.commit_index_),
+  PROTOBUF_FIELD_OFFSET(::append_entry_rpc_msg_t, _impl_.entries_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::append_entry_reply_msg_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::append_entry_reply_msg_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::append_entry_reply_msg_t, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::append_entry_reply_msg_t, _impl_.sender_id_),
+  PROTOBUF_FIELD_OFFSET(::append_entry_reply_msg_t, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::append_entry_reply_msg_t, _impl_.reply_heartbeat_),
+  PROTOBUF_FIELD_OFFSET(::append_entry_reply_msg_t, _impl_.match_index_),
+  PROTOBUF_FIELD_OFFSET(::append_entry_reply_msg_t, _impl_.commit_index_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  PROTOBUF_FIELD_OFFSET(::timeout_now_msg_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::timeout_now_msg_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::timeout_now_msg_t, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::timeout_now_msg_t, _impl_.leader_id_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::xshard_msg_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::xshard_msg_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::xshard_msg_t, _impl_.txn_id_),
+  PROTOBUF_FIELD_OFFSET(::xshard_msg_t, _impl_.from_shard_),
+  PROTOBUF_FIELD_OFFSET(::xshard_msg_t, _impl_.sender_id_),
+  PROTOBUF_FIELD_OFFSET(::xshard_msg_t, _impl_.recver_id_),
+  PROTOBUF_FIELD_OFFSET(::xshard_msg_t, _impl_.amount_),
+  PROTOBUF_FIELD_OFFSET(::xshard_msg_t, _impl_.commit_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, -1, sizeof(::request_msg_t)},
+  { 14, 26, -1, sizeof(::response_msg_t)},
+  { 32, 46, -1, sizeof(::txn_msg_t)},
+  { 54, 65, -1, sizeof(::block_msg_t)},
+  { 70, 78, -1, sizeof(::bc_msg_t)},
+  { 80, 95, -1, sizeof(::replica_msg_t)},
+  { 104, 115, -1, sizeof(::request_vote_rpc_msg_t)},
+  { 120, 129, -1, sizeof(::request_vote_reply_msg_t)},
+  { 132, 144, -1, sizeof(::append_entry_rpc_msg_t)},
+  { 150, 162, -1, sizeof(::append_entry_reply_msg_t)},
+  { 168, 176, -1, sizeof(::timeout_now_msg_t)},
+  { 178, 190, -1, sizeof(::xshard_msg_t)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::_request_msg_t_default_instance_._instance,
+  &::_response_msg_t_default_instance_._instance,
+  &::_txn_msg_t_default_instance_._instance,
+  &::_block_msg_t_default_instance_._instance,
+  &::_bc_msg_t_default_instance_._instance,
+  &::_replica_msg_t_default_instance_._instance,
+  &::_request_vote_rpc_msg_t_default_instance_._instance,
+  &::_request_vote_reply_msg_t_default_instance_._instance,
+  &::_append_entry_rpc_msg_t_default_instance_._instance,
+  &::_append_entry_reply_msg_t_default_instance_._instance,
+  &::_timeout_now_msg_t_default_instance_._instance,
+  &::_xshard_msg_t_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_Msg_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\tMsg.proto\"e\n\rrequest_msg_t\022\014\n\004type\030\001 \002"
+  "(\r\022\021\n\tclient_id\030\002 \002(\r\022\022\n\nrequest_id\030\003 \002("
+  "\004\022\037\n\013transaction\030\004 \001(\0132\n.txn_msg_t\"y\n\016re"
+  "sponse_msg_t\022\014\n\004type\030\001 \002(\r\022\022\n\nrequest_id"
+  "\030\002 \002(\004\022\017\n\007succeed\030\003 \002(\010\022\017\n\007balance\030\004 \001(\002"
+  "\022\021\n\tleader_id\030\005 \001(\r\022\020\n\010shard_id\030\006 \001(\r\"\255\001"
+  "\n\ttxn_msg_t\022\021\n\tsender_id\030\001 \002(\r\022\021\n\trecver"
+  "_id\030\002 \002(\r\022\016\n\006amount\030\003 \002(\002\022\024\n\014bal_txn_fla"
+  "g\030\004 \001(\010\022\027\n\017config_txn_flag\030\005 \001(\010\022\016\n\006vote"
+  "rs\030\006 \001(\004\022\024\n\014xshard_phase\030\007 \001(\r\022\025\n\rxshard"
+  "_txn_id\030\010 \001(\004\"a\n\013block_msg_t\022\014\n\004term\030\001 \002"
+  "(\r\022\r\n\005phash\030\002 \002(\t\022\r\n\005nonce\030\003 \002(\t\022\027\n\003txn\030"
+  "\004 \002(\0132\n.txn_msg_t\022\r\n\005index\030\005 \002(\005\"A\n\010bc_m"
+  "sg_t\022\027\n\017committed_index\030\001 \002(\005\022\034\n\006blocks\030"
+  "\003 \003(\0132\014.block_msg_t\"\370\002\n\rreplica_msg_t\022\014\n"
+  "\004type\030\001 \002(\r\022\023\n\013receiver_id\030\002 \001(\r\0225\n\024requ"
+  "est_vote_rpc_msg\030\003 \001(\0132\027.request_vote_rp"
+  "c_msg_t\0229\n\026request_vote_reply_msg\030\004 \001(\0132"
+  "\031.request_vote_reply_msg_t\0225\n\024append_ent"
+  "ry_rpc_msg\030\005 \001(\0132\027.append_entry_rpc_msg_"
+  "t\0229\n\026append_entry_reply_msg\030\006 \001(\0132\031.appe"
+  "nd_entry_reply_msg_t\022+\n\017timeout_now_msg\030"
+  "\007 \001(\0132\022.timeout_now_msg_t\022\020\n\010shard_id\030\010 "
+  "\001(\r\022!\n\nxshard_msg\030\t \001(\0132\r.xshard_msg_t\"\210"
+  "\001\n\026request_vote_rpc_msg_t\022\024\n\014candidate_i"
+  "d\030\001 \002(\r\022\014\n\004term\030\002 \002(\r\022\025\n\rlast_log_term\030\003"
+  " \002(\r\022\026\n\016last_log_index\030\004 \002(\005\022\033\n\023leadersh"
+  "ip_transfer\030\005 \001(\010\"Q\n\030request_vote_reply_"
+  "msg_t\022\014\n\004term\030\001 \002(\r\022\024\n\014vote_granted\030\002 \002("
+  "\010\022\021\n\tsender_id\030\003 \001(\r\"\217\001\n\026append_entry_rp"
+  "c_msg_t\022\014\n\004term\030\001 \002(\r\022\021\n\tleader_id\030\002 \002(\r"
+  "\022\025\n\rprev_log_term\030\003 \002(\r\022\026\n\016prev_log_inde"
+  "x\030\004 \002(\005\022\024\n\014commit_index\030\005 \002(\005\022\017\n\007entries"
+  "\030\006 \003(\014\"\224\001\n\030append_entry_reply_msg_t\022\014\n\004t"
+  "erm\030\001 \002(\r\022\021\n\tsender_id\030\002 \002(\r\022\017\n\007success\030"
+  "\003 \002(\010\022\027\n\017reply_heartbeat\030\004 \002(\010\022\023\n\013match_"
+  "index\030\005 \001(\005\022\030\n\014commit_index\030\006 \001(\005:\002-1\"4\n"
+  "\021timeout_now_msg_t\022\014\n\004term\030\001 \002(\r\022\021\n\tlead"
+  "er_id\030\002 \002(\r\"x\n\014xshard_msg_t\022\016\n\006txn_id\030\001 "
+  "\002(\004\022\022\n\nfrom_shard\030\002 \002(\r\022\021\n\tsender_id\030\003 \001"
+  "(\r\022\021\n\trecver_id\030\004 \001(\r\022\016\n\006amount\030\005 \001(\002\022\016\n"
+  "\006commit\030\006 \001(\010B\003\370\001\001"
+  ;
+static ::_pbi::once_flag descriptor_table_Msg_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_Msg_2eproto = {
+    false, false, 1658, descriptor_table_protodef_Msg_2eproto,
+    "Msg.proto",
+    &descriptor_table_Msg_2eproto_once, nullptr, 0, 12,
+    schemas, file_default_instances, TableStruct_Msg_2eproto::offsets,
+    file_level_metadata_Msg_2eproto, file_level_enum_descriptors_Msg_2eproto,
+    file_level_service_descriptors_Msg_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_Msg_2eproto_getter() {
+  return &descriptor_table_Msg_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_Msg_2eproto(&descriptor_table_Msg_2eproto);
+
+// ===================================================================
+
+class request_msg_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<request_msg_t>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_client_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_request_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::txn_msg_t& transaction(const request_msg_t* msg);
+  static void set_has_transaction(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000e) ^ 0x0000000e) != 0;
+  }
+};
+
+const ::txn_msg_t&
+request_msg_t::_Internal::transaction(const request_msg_t* msg) {
+  return *msg->_impl_.transaction_;
+}
+request_msg_t::request_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:request_msg_t)
+}
+request_msg_t::request_msg_t(const request_msg_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  request_msg_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.transaction_){nullptr}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.client_id_){}
+    , decltype(_impl_.request_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_transaction()) {
+    _this->_impl_.transaction_ = new ::txn_msg_t(*from._impl_.transaction_);
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.request_id_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.request_id_));
+  // @@protoc_insertion_point(copy_constructor:request_msg_t)
+}
+
+inline void request_msg_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.transaction_){nullptr}
+    , decltype(_impl_.type_){0u}
+    , decltype(_impl_.client_id_){0u}
+    , decltype(_impl_.request_id_){uint64_t{0u}}
+  };
+}
+
+request_msg_t::~request_msg_t() {
+  // @@protoc_insertion_point(destructor:request_msg_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void request_msg_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.transaction_;
+}
+
+void request_msg_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void request_msg_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:request_msg_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.transaction_ != nullptr);
+    _impl_.transaction_->Clear();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.request_id_) -
+        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.request_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* request_msg_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_type(&has_bits);
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 client_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_client_id(&has_bits);
+          _impl_.client_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 request_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_request_id(&has_bits);
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .txn_msg_t transaction = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_transaction(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* request_msg_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:request_msg_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 type = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_type(), target);
+  }
+
+  // required uint32 client_id = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_client_id(), target);
+  }
+
+  // required uint64 request_id = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_request_id(), target);
+  }
+
+  // optional .txn_msg_t transaction = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::transaction(this),
+        _Internal::transaction(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:request_msg_t)
+  return target;
+}
+
+size_t request_msg_t::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:request_msg_t)
+  size_t total_size = 0;
+
+  if (_internal_has_type()) {
+    // required uint32 type = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_type());
+  }
+
+  if (_internal_has_client_id()) {
+    // required uint32 client_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_client_id());
+  }
+
+  if (_internal_has_request_id()) {
+    // required uint64 request_id = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+  }
+
+  return total_size;
+}
+size_t request_msg_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:request_msg_t)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000e) ^ 0x0000000e) == 0) {  // All required fields are present.
+    // required uint32 type = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_type());
+
+    // required uint32 client_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_client_id());
+
+    // required uint64 request_id = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .txn_msg_t transaction = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.transaction_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData request_msg_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    request_msg_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*request_msg_t::GetClassData() const { return &_class_data_; }
+
+
+void request_msg_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<request_msg_t*>(&to_msg);
+  auto& from = static_cast<const request_msg_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:request_msg_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_transaction()->::txn_msg_t::MergeFrom(
+          from._internal_transaction());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.client_id_ = from._impl_.client_id_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.request_id_ = from._impl_.request_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void request_msg_t::CopyFrom(const request_msg_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:request_msg_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool request_msg_t::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_transaction()) {
+    if (!_impl_.transaction_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void request_msg_t::InternalSwap(request_msg_t* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(request_msg_t, _impl_.request_id_)
+      + sizeof(request_msg_t::_impl_.request_id_)
+      - PROTOBUF_FIELD_OFFSET(request_msg_t, _impl_.transaction_)>(
+          reinterpret_cast<char*>(&_impl_.transaction_),
+          reinterpret_cast<char*>(&other->_impl_.transaction_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata request_msg_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Msg_2eproto_getter, &descriptor_table_Msg_2eproto_once,
+      file_level_metadata_Msg_2eproto[0]);
+}
+
+// ===================================================================
+
+class response_msg_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<response_msg_t>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_request_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_succeed(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_balance(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_leader_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_shard_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+response_msg_t::response_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:response_msg_t)
+}
+response_msg_t::response_msg_t(const response_msg_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  response_msg_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.request_id_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.succeed_){}
+    , decltype(_impl_.balance_){}
+    , decltype(_impl_.leader_id_){}
+    , decltype(_impl_.shard_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.request_id_, &from._impl_.request_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.shard_id_) -
+    reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.shard_id_));
+  // @@protoc_insertion_point(copy_constructor:response_msg_t)
+}
+
+inline void response_msg_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.request_id_){uint64_t{0u}}
+    , decltype(_impl_.type_){0u}
+    , decltype(_impl_.succeed_){false}
+    , decltype(_impl_.balance_){0}
+    , decltype(_impl_.leader_id_){0u}
+    , decltype(_impl_.shard_id_){0u}
+  };
+}
+
+response_msg_t::~response_msg_t() {
+  // @@protoc_insertion_point(destructor:response_msg_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void response_msg_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void response_msg_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void response_msg_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:response_msg_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    ::memset(&_impl_.request_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.shard_id_) -
+        reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.shard_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* response_msg_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_type(&has_bits);
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 request_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_request_id(&has_bits);
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool succeed = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_succeed(&has_bits);
+          _impl_.succeed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float balance = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_balance(&has_bits);
+          _impl_.balance_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 leader_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_leader_id(&has_bits);
+          _impl_.leader_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 shard_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_shard_id(&has_bits);
+          _impl_.shard_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* response_msg_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:response_msg_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 type = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_type(), target);
+  }
+
+  // required uint64 request_id = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_request_id(), target);
+  }
+
+  // required bool succeed = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_succeed(), target);
+  }
+
+  // optional float balance = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_balance(), target);
+  }
+
+  // optional uint32 leader_id = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_leader_id(), target);
+  }
+
+  // optional uint32 shard_id = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_shard_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:response_msg_t)
+  return target;
+}
+
+size_t response_msg_t::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:response_msg_t)
+  size_t total_size = 0;
+
+  if (_internal_has_request_id()) {
+    // required uint64 request_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+  }
+
+  if (_internal_has_type()) {
+    // required uint32 type = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_type());
+  }
+
+  if (_internal_has_succeed()) {
+    // required bool succeed = 3;
+    total_size += 1 + 1;
+  }
+
+  return total_size;
+}
+size_t response_msg_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:response_msg_t)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 request_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+
+    // required uint32 type = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_type());
+
+    // required bool succeed = 3;
+    total_size += 1 + 1;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000038u) {
+    // optional float balance = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 4;
+    }
+
+    // optional uint32 leader_id = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_leader_id());
+    }
+
+    // optional uint32 shard_id = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_id());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData response_msg_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    response_msg_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*response_msg_t::GetClassData() const { return &_class_data_; }
+
+
+void response_msg_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<response_msg_t*>(&to_msg);
+  auto& from = static_cast<const response_msg_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:response_msg_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.request_id_ = from._impl_.request_id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.succeed_ = from._impl_.succeed_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.balance_ = from._impl_.balance_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.leader_id_ = from._impl_.leader_id_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.shard_id_ = from._impl_.shard_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void response_msg_t::CopyFrom(const response_msg_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:response_msg_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool response_msg_t::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void response_msg_t::InternalSwap(response_msg_t* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(response_msg_t, _impl_.shard_id_)
+      + sizeof(response_msg_t::_impl_.shard_id_)
+      - PROTOBUF_FIELD_OFFSET(response_msg_t, _impl_.request_id_)>(
+          reinterpret_cast<char*>(&_impl_.request_id_),
+          reinterpret_cast<char*>(&other->_impl_.request_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata response_msg_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Msg_2eproto_getter, &descriptor_table_Msg_2eproto_once,
+      file_level_metadata_Msg_2eproto[1]);
+}
+
+// ===================================================================
+
+class txn_msg_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<txn_msg_t>()._impl_._has_bits_);
+  static void set_has_sender_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_recver_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_amount(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_bal_txn_flag(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_config_txn_flag(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_voters(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_xshard_phase(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_xshard_txn_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+txn_msg_t::txn_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:txn_msg_t)
+}
+txn_msg_t::txn_msg_t(const txn_msg_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  txn_msg_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sender_id_){}
+    , decltype(_impl_.recver_id_){}
+    , decltype(_impl_.amount_){}
+    , decltype(_impl_.bal_txn_flag_){}
+    , decltype(_impl_.config_txn_flag_){}
+    , decltype(_impl_.voters_){}
+    , decltype(_impl_.xshard_txn_id_){}
+    , decltype(_impl_.xshard_phase_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.sender_id_, &from._impl_.sender_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.xshard_phase_) -
+    reinterpret_cast<char*>(&_impl_.sender_id_)) + sizeof(_impl_.xshard_phase_));
+  // @@protoc_insertion_point(copy_constructor:txn_msg_t)
+}
+
+inline void txn_msg_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sender_id_){0u}
+    , decltype(_impl_.recver_id_){0u}
+    , decltype(_impl_.amount_){0}
+    , decltype(_impl_.bal_txn_flag_){false}
+    , decltype(_impl_.config_txn_flag_){false}
+    , decltype(_impl_.voters_){uint64_t{0u}}
+    , decltype(_impl_.xshard_txn_id_){uint64_t{0u}}
+    , decltype(_impl_.xshard_phase_){0u}
+  };
+}
+
+txn_msg_t::~txn_msg_t() {
+  // @@protoc_insertion_point(destructor:txn_msg_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void txn_msg_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void txn_msg_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void txn_msg_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:txn_msg_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.sender_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.xshard_phase_) -
+        reinterpret_cast<char*>(&_impl_.sender_id_)) + sizeof(_impl_.xshard_phase_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* txn_msg_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 sender_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_sender_id(&has_bits);
+          _impl_.sender_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 recver_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_recver_id(&has_bits);
+          _impl_.recver_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required float amount = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_amount(&has_bits);
+          _impl_.amount_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool bal_txn_flag = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_bal_txn_flag(&has_bits);
+          _impl_.bal_txn_flag_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool config_txn_flag = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_config_txn_flag(&has_bits);
+          _impl_.config_txn_flag_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 voters = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_voters(&has_bits);
+          _impl_.voters_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 xshard_phase = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_xshard_phase(&has_bits);
+          _impl_.xshard_phase_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 xshard_txn_id = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_xshard_txn_id(&has_bits);
+          _impl_.xshard_txn_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* txn_msg_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:txn_msg_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 sender_id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_sender_id(), target);
+  }
+
+  // required uint32 recver_id = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_recver_id(), target);
+  }
+
+  // required float amount = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_amount(), target);
+  }
+
+  // optional bool bal_txn_flag = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_bal_txn_flag(), target);
+  }
+
+  // optional bool config_txn_flag = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_config_txn_flag(), target);
+  }
+
+  // optional uint64 voters = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_voters(), target);
+  }
+
+  // optional uint32 xshard_phase = 7;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_xshard_phase(), target);
+  }
+
+  // optional uint64 xshard_txn_id = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_xshard_txn_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:txn_msg_t)
+  return target;
+}
+
+size_t txn_msg_t::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:txn_msg_t)
+  size_t total_size = 0;
+
+  if (_internal_has_sender_id()) {
+    // required uint32 sender_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sender_id());
+  }
+
+  if (_internal_has_recver_id()) {
+    // required uint32 recver_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_recver_id());
+  }
+
+  if (_internal_has_amount()) {
+    // required float amount = 3;
+    total_size += 1 + 4;
+  }
+
+  return total_size;
+}
+size_t txn_msg_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:txn_msg_t)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint32 sender_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sender_id());
+
+    // required uint32 recver_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_recver_id());
+
+    // required float amount = 3;
+    total_size += 1 + 4;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000f8u) {
+    // optional bool bal_txn_flag = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool config_txn_flag = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint64 voters = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_voters());
+    }
+
+    // optional uint64 xshard_txn_id = 8;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_xshard_txn_id());
+    }
+
+    // optional uint32 xshard_phase = 7;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_xshard_phase());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData txn_msg_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    txn_msg_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*txn_msg_t::GetClassData() const { return &_class_data_; }
+
+
+void txn_msg_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<txn_msg_t*>(&to_msg);
+  auto& from = static_cast<const txn_msg_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:txn_msg_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.sender_id_ = from._impl_.sender_id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.recver_id_ = from._impl_.recver_id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.amount_ = from._impl_.amount_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.bal_txn_flag_ = from._impl_.bal_txn_flag_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.config_txn_flag_ = from._impl_.config_txn_flag_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.voters_ = from._impl_.voters_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.xshard_txn_id_ = from._impl_.xshard_txn_id_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.xshard_phase_ = from._impl_.xshard_phase_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void txn_msg_t::CopyFrom(const txn_msg_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:txn_msg_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool txn_msg_t::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void txn_msg_t::InternalSwap(txn_msg_t* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(txn_msg_t, _impl_.xshard_phase_)
+      + sizeof(txn_msg_t::_impl_.xshard_phase_)
+      - PROTOBUF_FIELD_OFFSET(txn_msg_t, _impl_.sender_id_)>(
+          reinterpret_cast<char*>(&_impl_.sender_id_),
+          reinterpret_cast<char*>(&other->_impl_.sender_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata txn_msg_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Msg_2eproto_getter, &descriptor_table_Msg_2eproto_once,
+      file_level_metadata_Msg_2eproto[2]);
+}
+
+// ===================================================================
+
+class block_msg_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<block_msg_t>()._impl_._has_bits_);
+  static void set_has_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_phash(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_nonce(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::txn_msg_t& txn(const block_msg_t* msg);
+  static void set_has_txn(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+const ::txn_msg_t&
+block_msg_t::_Internal::txn(const block_msg_t* msg) {
+  return *msg->_impl_.txn_;
+}
+block_msg_t::block_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:block_msg_t)
+}
+block_msg_t::block_msg_t(const block_msg_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  block_msg_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.phash_){}
+    , decltype(_impl_.nonce_){}
+    , decltype(_impl_.txn_){nullptr}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.index_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.phash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.phash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_phash()) {
+    _this->_impl_.phash_.Set(from._internal_phash(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.nonce_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nonce_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_nonce()) {
+    _this->_impl_.nonce_.Set(from._internal_nonce(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_txn()) {
+    _this->_impl_.txn_ = new ::txn_msg_t(*from._impl_.txn_);
+  }
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.index_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.index_));
+  // @@protoc_insertion_point(copy_constructor:block_msg_t)
+}
+
+inline void block_msg_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.phash_){}
+    , decltype(_impl_.nonce_){}
+    , decltype(_impl_.txn_){nullptr}
+    , decltype(_impl_.term_){0u}
+    , decltype(_impl_.index_){0}
+  };
+  _impl_.phash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.phash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.nonce_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nonce_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+block_msg_t::~block_msg_t() {
+  // @@protoc_insertion_point(destructor:block_msg_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void block_msg_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.phash_.Destroy();
+  _impl_.nonce_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.txn_;
+}
+
+void block_msg_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void block_msg_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:block_msg_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.phash_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.nonce_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.txn_ != nullptr);
+      _impl_.txn_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000018u) {
+    ::memset(&_impl_.term_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.index_) -
+        reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.index_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* block_msg_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_term(&has_bits);
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string phash = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_phash();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "block_msg_t.phash");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string nonce = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_nonce();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "block_msg_t.nonce");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .txn_msg_t txn = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_txn(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 index = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_index(&has_bits);
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* block_msg_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:block_msg_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 term = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // required string phash = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_phash().data(), static_cast<int>(this->_internal_phash().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "block_msg_t.phash");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_phash(), target);
+  }
+
+  // required string nonce = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_nonce().data(), static_cast<int>(this->_internal_nonce().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "block_msg_t.nonce");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_nonce(), target);
+  }
+
+  // required .txn_msg_t txn = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::txn(this),
+        _Internal::txn(this).GetCachedSize(), target, stream);
+  }
+
+  // required int32 index = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:block_msg_t)
+  return target;
+}
+
+size_t block_msg_t::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:block_msg_t)
+  size_t total_size = 0;
+
+  if (_internal_has_phash()) {
+    // required string phash = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_phash());
+  }
+
+  if (_internal_has_nonce()) {
+    // required string nonce = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_nonce());
+  }
+
+  if (_internal_has_txn()) {
+    // required .txn_msg_t txn = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.txn_);
+  }
+
+  if (_internal_has_term()) {
+    // required uint32 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_term());
+  }
+
+  if (_internal_has_index()) {
+    // required int32 index = 5;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_index());
+  }
+
+  return total_size;
+}
+size_t block_msg_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:block_msg_t)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required string phash = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_phash());
+
+    // required string nonce = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_nonce());
+
+    // required .txn_msg_t txn = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.txn_);
+
+    // required uint32 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_term());
+
+    // required int32 index = 5;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_index());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData block_msg_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    block_msg_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*block_msg_t::GetClassData() const { return &_class_data_; }
+
+
+void block_msg_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<block_msg_t*>(&to_msg);
+  auto& from = static_cast<const block_msg_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:block_msg_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_phash(from._internal_phash());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_nonce(from._internal_nonce());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_txn()->::txn_msg_t::MergeFrom(
+          from._internal_txn());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.term_ = from._impl_.term_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.index_ = from._impl_.index_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void block_msg_t::CopyFrom(const block_msg_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:block_msg_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool block_msg_t::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_txn()) {
+    if (!_impl_.txn_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void block_msg_t::InternalSwap(block_msg_t* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.phash_, lhs_arena,
+      &other->_impl_.phash_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.nonce_, lhs_arena,
+      &other->_impl_.nonce_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(block_msg_t, _impl_.index_)
+      + sizeof(block_msg_t::_impl_.index_)
+      - PROTOBUF_FIELD_OFFSET(block_msg_t, _impl_.txn_)>(
+          reinterpret_cast<char*>(&_impl_.txn_),
+          reinterpret_cast<char*>(&other->_impl_.txn_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata block_msg_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Msg_2eproto_getter, &descriptor_table_Msg_2eproto_once,
+      file_level_metadata_Msg_2eproto[3]);
+}
+
+// ===================================================================
+
+class bc_msg_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<bc_msg_t>()._impl_._has_bits_);
+  static void set_has_committed_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+bc_msg_t::bc_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:bc_msg_t)
+}
+bc_msg_t::bc_msg_t(const bc_msg_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  bc_msg_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.blocks_){from._impl_.blocks_}
+    , decltype(_impl_.committed_index_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.committed_index_ = from._impl_.committed_index_;
+  // @@protoc_insertion_point(copy_constructor:bc_msg_t)
+}
+
+inline void bc_msg_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.blocks_){arena}
+    , decltype(_impl_.committed_index_){0}
+  };
+}
+
+bc_msg_t::~bc_msg_t() {
+  // @@protoc_insertion_point(destructor:bc_msg_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void bc_msg_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.blocks_.~RepeatedPtrField();
+}
+
+void bc_msg_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void bc_msg_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:bc_msg_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.blocks_.Clear();
+  _impl_.committed_index_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* bc_msg_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int32 committed_index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_committed_index(&has_bits);
+          _impl_.committed_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .block_msg_t blocks = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_blocks(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* bc_msg_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:bc_msg_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int32 committed_index = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_committed_index(), target);
+  }
+
+  // repeated .block_msg_t blocks = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_blocks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_blocks(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:bc_msg_t)
+  return target;
+}
+
+size_t bc_msg_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:bc_msg_t)
+  size_t total_size = 0;
+
+  // required int32 committed_index = 1;
+  if (_internal_has_committed_index()) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_committed_index());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .block_msg_t blocks = 3;
+  total_size += 1UL * this->_internal_blocks_size();
+  for (const auto& msg : this->_impl_.blocks_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData bc_msg_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    bc_msg_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*bc_msg_t::GetClassData() const { return &_class_data_; }
+
+
+void bc_msg_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<bc_msg_t*>(&to_msg);
+  auto& from = static_cast<const bc_msg_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:bc_msg_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.blocks_.MergeFrom(from._impl_.blocks_);
+  if (from._internal_has_committed_index()) {
+    _this->_internal_set_committed_index(from._internal_committed_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void bc_msg_t::CopyFrom(const bc_msg_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:bc_msg_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool bc_msg_t::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.blocks_))
+    return false;
+  return true;
+}
+
+void bc_msg_t::InternalSwap(bc_msg_t* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.blocks_.InternalSwap(&other->_impl_.blocks_);
+  swap(_impl_.committed_index_, other->_impl_.committed_index_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata bc_msg_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Msg_2eproto_getter, &descriptor_table_Msg_2eproto_once,
+      file_level_metadata_Msg_2eproto[4]);
+}
+
+// ===================================================================
+
+class replica_msg_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<replica_msg_t>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_receiver_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static const ::request_vote_rpc_msg_t& request_vote_rpc_msg(const replica_msg_t* msg);
+  static void set_has_request_vote_rpc_msg(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::request_vote_reply_msg_t& request_vote_reply_msg(const replica_msg_t* msg);
+  static void set_has_request_vote_reply_msg(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::append_entry_rpc_msg_t& append_entry_rpc_msg(const replica_msg_t* msg);
+  static void set_has_append_entry_rpc_msg(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::append_entry_reply_msg_t& append_entry_reply_msg(const replica_msg_t* msg);
+  static void set_has_append_entry_reply_msg(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::timeout_now_msg_t& timeout_now_msg(const replica_msg_t* msg);
+  static void set_has_timeout_now_msg(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_shard_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::xshard_msg_t& xshard_msg(const replica_msg_t* msg);
+  static void set_has_xshard_msg(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000040) ^ 0x00000040) != 0;
+  }
+};
+
+const ::request_vote_rpc_msg_t&
+replica_msg_t::_Internal::request_vote_rpc_msg(const replica_msg_t* msg) {
+  return *msg->_impl_.request_vote_rpc_msg_;
+}
+const ::request_vote_reply_msg_t&
+replica_msg_t::_Internal::request_vote_reply_msg(const replica_msg_t* msg) {
+  return *msg->_impl_.request_vote_reply_msg_;
+}
+const ::append_entry_rpc_msg_t&
+replica_msg_t::_Internal::append_entry_rpc_msg(const replica_msg_t* msg) {
+  return *msg->_impl_.append_entry_rpc_msg_;
+}
+const ::append_entry_reply_msg_t&
+replica_msg_t::_Internal::append_entry_reply_msg(const replica_msg_t* msg) {
+  return *msg->_impl_.append_entry_reply_msg_;
+}
+const ::timeout_now_msg_t&
+replica_msg_t::_Internal::timeout_now_msg(const replica_msg_t* msg) {
+  return *msg->_impl_.timeout_now_msg_;
+}
+const ::xshard_msg_t&
+replica_msg_t::_Internal::xshard_msg(const replica_msg_t* msg) {
+  return *msg->_impl_.xshard_msg_;
+}
+replica_msg_t::replica_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:replica_msg_t)
+}
+replica_msg_t::replica_msg_t(const replica_msg_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  replica_msg_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.request_vote_rpc_msg_){nullptr}
+    , decltype(_impl_.request_vote_reply_msg_){nullptr}
+    , decltype(_impl_.append_entry_rpc_msg_){nullptr}
+    , decltype(_impl_.append_entry_reply_msg_){nullptr}
+    , decltype(_impl_.timeout_now_msg_){nullptr}
+    , decltype(_impl_.xshard_msg_){nullptr}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.receiver_id_){}
+    , decltype(_impl_.shard_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_request_vote_rpc_msg()) {
+    _this->_impl_.request_vote_rpc_msg_ = new ::request_vote_rpc_msg_t(*from._impl_.request_vote_rpc_msg_);
+  }
+  if (from._internal_has_request_vote_reply_msg()) {
+    _this->_impl_.request_vote_reply_msg_ = new ::request_vote_reply_msg_t(*from._impl_.request_vote_reply_msg_);
+  }
+  if (from._internal_has_append_entry_rpc_msg()) {
+    _this->_impl_.append_entry_rpc_msg_ = new ::append_entry_rpc_msg_t(*from._impl_.append_entry_rpc_msg_);
+  }
+  if (from._internal_has_append_entry_reply_msg()) {
+    _this->_impl_.append_entry_reply_msg_ = new ::append_entry_reply_msg_t(*from._impl_.append_entry_reply_msg_);
+  }
+  if (from._internal_has_timeout_now_msg()) {
+    _this->_impl_.timeout_now_msg_ = new ::timeout_now_msg_t(*from._impl_.timeout_now_msg_);
+  }
+  if (from._internal_has_xshard_msg()) {
+    _this->_impl_.xshard_msg_ = new ::xshard_msg_t(*from._impl_.xshard_msg_);
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.shard_id_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.shard_id_));
+  // @@protoc_insertion_point(copy_constructor:replica_msg_t)
+}
+
+inline void replica_msg_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.request_vote_rpc_msg_){nullptr}
+    , decltype(_impl_.request_vote_reply_msg_){nullptr}
+    , decltype(_impl_.append_entry_rpc_msg_){nullptr}
+    , decltype(_impl_.append_entry_reply_msg_){nullptr}
+    , decltype(_impl_.timeout_now_msg_){nullptr}
+    , decltype(_impl_.xshard_msg_){nullptr}
+    , decltype(_impl_.type_){0u}
+    , decltype(_impl_.receiver_id_){0u}
+    , decltype(_impl_.shard_id_){0u}
+  };
+}
+
+replica_msg_t::~replica_msg_t() {
+  // @@protoc_insertion_point(destructor:replica_msg_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void replica_msg_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.request_vote_rpc_msg_;
+  if (this != internal_default_instance()) delete _impl_.request_vote_reply_msg_;
+  if (this != internal_default_instance()) delete _impl_.append_entry_rpc_msg_;
+  if (this != internal_default_instance()) delete _impl_.append_entry_reply_msg_;
+  if (this != internal_default_instance()) delete _impl_.timeout_now_msg_;
+  if (this != internal_default_instance()) delete _impl_.xshard_msg_;
+}
+
+void replica_msg_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void replica_msg_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:replica_msg_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.request_vote_rpc_msg_ != nullptr);
+      _impl_.request_vote_rpc_msg_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.request_vote_reply_msg_ != nullptr);
+      _impl_.request_vote_reply_msg_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.append_entry_rpc_msg_ != nullptr);
+      _impl_.append_entry_rpc_msg_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.append_entry_reply_msg_ != nullptr);
+      _impl_.append_entry_reply_msg_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.timeout_now_msg_ != nullptr);
+      _impl_.timeout_now_msg_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.xshard_msg_ != nullptr);
+      _impl_.xshard_msg_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000c0u) {
+    ::memset(&_impl_.type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.receiver_id_) -
+        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.receiver_id_));
+  }
+  _impl_.shard_id_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* replica_msg_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_type(&has_bits);
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 receiver_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_receiver_id(&has_bits);
+          _impl_.receiver_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .request_vote_rpc_msg_t request_vote_rpc_msg = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request_vote_rpc_msg(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .request_vote_reply_msg_t request_vote_reply_msg = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request_vote_reply_msg(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .append_entry_rpc_msg_t append_entry_rpc_msg = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_append_entry_rpc_msg(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .append_entry_reply_msg_t append_entry_reply_msg = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_append_entry_reply_msg(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .timeout_now_msg_t timeout_now_msg = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_timeout_now_msg(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 shard_id = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_shard_id(&has_bits);
+          _impl_.shard_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .xshard_msg_t xshard_msg = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_xshard_msg(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* replica_msg_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:replica_msg_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 type = 1;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_type(), target);
+  }
+
+  // optional uint32 receiver_id = 2;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_receiver_id(), target);
+  }
+
+  // optional .request_vote_rpc_msg_t request_vote_rpc_msg = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::request_vote_rpc_msg(this),
+        _Internal::request_vote_rpc_msg(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .request_vote_reply_msg_t request_vote_reply_msg = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::request_vote_reply_msg(this),
+        _Internal::request_vote_reply_msg(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .append_entry_rpc_msg_t append_entry_rpc_msg = 5;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::append_entry_rpc_msg(this),
+        _Internal::append_entry_rpc_msg(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .append_entry_reply_msg_t append_entry_reply_msg = 6;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::append_entry_reply_msg(this),
+        _Internal::append_entry_reply_msg(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .timeout_now_msg_t timeout_now_msg = 7;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::timeout_now_msg(this),
+        _Internal::timeout_now_msg(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint32 shard_id = 8;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_shard_id(), target);
+  }
+
+  // optional .xshard_msg_t xshard_msg = 9;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::xshard_msg(this),
+        _Internal::xshard_msg(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:replica_msg_t)
+  return target;
+}
+
+size_t replica_msg_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:replica_msg_t)
+  size_t total_size = 0;
+
+  // required uint32 type = 1;
+  if (_internal_has_type()) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_type());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional .request_vote_rpc_msg_t request_vote_rpc_msg = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.request_vote_rpc_msg_);
+    }
+
+    // optional .request_vote_reply_msg_t request_vote_reply_msg = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.request_vote_reply_msg_);
+    }
+
+    // optional .append_entry_rpc_msg_t append_entry_rpc_msg = 5;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.append_entry_rpc_msg_);
+    }
+
+    // optional .append_entry_reply_msg_t append_entry_reply_msg = 6;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.append_entry_reply_msg_);
+    }
+
+    // optional .timeout_now_msg_t timeout_now_msg = 7;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.timeout_now_msg_);
+    }
+
+    // optional .xshard_msg_t xshard_msg = 9;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.xshard_msg_);
+    }
+
+  }
+  // optional uint32 receiver_id = 2;
+  if (cached_has_bits & 0x00000080u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_receiver_id());
+  }
+
+  // optional uint32 shard_id = 8;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shard_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData replica_msg_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    replica_msg_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*replica_msg_t::GetClassData() const { return &_class_data_; }
+
+
+void replica_msg_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<replica_msg_t*>(&to_msg);
+  auto& from = static_cast<const replica_msg_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:replica_msg_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_request_vote_rpc_msg()->::request_vote_rpc_msg_t::MergeFrom(
+          from._internal_request_vote_rpc_msg());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_request_vote_reply_msg()->::request_vote_reply_msg_t::MergeFrom(
+          from._internal_request_vote_reply_msg());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_append_entry_rpc_msg()->::append_entry_rpc_msg_t::MergeFrom(
+          from._internal_append_entry_rpc_msg());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_append_entry_reply_msg()->::append_entry_reply_msg_t::MergeFrom(
+          from._internal_append_entry_reply_msg());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_timeout_now_msg()->::timeout_now_msg_t::MergeFrom(
+          from._internal_timeout_now_msg());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_xshard_msg()->::xshard_msg_t::MergeFrom(
+          from._internal_xshard_msg());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.receiver_id_ = from._impl_.receiver_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_shard_id(from._internal_shard_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void replica_msg_t::CopyFrom(const replica_msg_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:replica_msg_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool replica_msg_t::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_request_vote_rpc_msg()) {
+    if (!_impl_.request_vote_rpc_msg_->IsInitialized()) return false;
+  }
+  if (_internal_has_request_vote_reply_msg()) {
+    if (!_impl_.request_vote_reply_msg_->IsInitialized()) return false;
+  }
+  if (_internal_has_append_entry_rpc_msg()) {
+    if (!_impl_.append_entry_rpc_msg_->IsInitialized()) return false;
+  }
+  if (_internal_has_append_entry_reply_msg()) {
+    if (!_impl_.append_entry_reply_msg_->IsInitialized()) return false;
+  }
+  if (_internal_has_timeout_now_msg()) {
+    if (!_impl_.timeout_now_msg_->IsInitialized()) return false;
+  }
+  if (_internal_has_xshard_msg()) {
+    if (!_impl_.xshard_msg_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void replica_msg_t::InternalSwap(replica_msg_t* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(replica_msg_t, _impl_.shard_id_)
+      + sizeof(replica_msg_t::_impl_.shard_id_)
+      - PROTOBUF_FIELD_OFFSET(replica_msg_t, _impl_.request_vote_rpc_msg_)>(
+          reinterpret_cast<char*>(&_impl_.request_vote_rpc_msg_),
+          reinterpret_cast<char*>(&other->_impl_.request_vote_rpc_msg_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata replica_msg_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Msg_2eproto_getter, &descriptor_table_Msg_2eproto_once,
+      file_level_metadata_Msg_2eproto[5]);
+}
+
+// ===================================================================
+
+class request_vote_rpc_msg_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<request_vote_rpc_msg_t>()._impl_._has_bits_);
+  static void set_has_candidate_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_last_log_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_last_log_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_leadership_transfer(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+request_vote_rpc_msg_t::request_vote_rpc_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:request_vote_rpc_msg_t)
+}
+request_vote_rpc_msg_t::request_vote_rpc_msg_t(const request_vote_rpc_msg_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  request_vote_rpc_msg_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.candidate_id_){}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.last_log_term_){}
+    , decltype(_impl_.last_log_index_){}
+    , decltype(_impl_.leadership_transfer_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.candidate_id_, &from._impl_.candidate_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.leadership_transfer_) -
+    reinterpret_cast<char*>(&_impl_.candidate_id_)) + sizeof(_impl_.leadership_transfer_));
+  // @@protoc_insertion_point(copy_constructor:request_vote_rpc_msg_t)
+}
+
+inline void request_vote_rpc_msg_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.candidate_id_){0u}
+    , decltype(_impl_.term_){0u}
+    , decltype(_impl_.last_log_term_){0u}
+    , decltype(_impl_.last_log_index_){0}
+    , decltype(_impl_.leadership_transfer_){false}
+  };
+}
+
+request_vote_rpc_msg_t::~request_vote_rpc_msg_t() {
+  // @@protoc_insertion_point(destructor:request_vote_rpc_msg_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void request_vote_rpc_msg_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void request_vote_rpc_msg_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void request_vote_rpc_msg_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:request_vote_rpc_msg_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.candidate_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.leadership_transfer_) -
+        reinterpret_cast<char*>(&_impl_.candidate_id_)) + sizeof(_impl_.leadership_transfer_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* request_vote_rpc_msg_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 candidate_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_candidate_id(&has_bits);
+          _impl_.candidate_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 term = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_term(&has_bits);
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 last_log_term = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_last_log_term(&has_bits);
+          _impl_.last_log_term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 last_log_index = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_last_log_index(&has_bits);
+          _impl_.last_log_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool leadership_transfer = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_leadership_transfer(&has_bits);
+          _impl_.leadership_transfer_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* request_vote_rpc_msg_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:request_vote_rpc_msg_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 candidate_id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_candidate_id(), target);
+  }
+
+  // required uint32 term = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_term(), target);
+  }
+
+  // required uint32 last_log_term = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_last_log_term(), target);
+  }
+
+  // required int32 last_log_index = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_last_log_index(), target);
+  }
+
+  // optional bool leadership_transfer = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_leadership_transfer(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:request_vote_rpc_msg_t)
+  return target;
+}
+
+size_t request_vote_rpc_msg_t::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:request_vote_rpc_msg_t)
+  size_t total_size = 0;
+
+  if (_internal_has_candidate_id()) {
+    // required uint32 candidate_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_candidate_id());
+  }
+
+  if (_internal_has_term()) {
+    // required uint32 term = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_term());
+  }
+
+  if (_internal_has_last_log_term()) {
+    // required uint32 last_log_term = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_last_log_term());
+  }
+
+  if (_internal_has_last_log_index()) {
+    // required int32 last_log_index = 4;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_last_log_index());
+  }
+
+  return total_size;
+}
+size_t request_vote_rpc_msg_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:request_vote_rpc_msg_t)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required uint32 candidate_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_candidate_id());
+
+    // required uint32 term = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_term());
+
+    // required uint32 last_log_term = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_last_log_term());
+
+    // required int32 last_log_index = 4;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_last_log_index());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bool leadership_transfer = 5;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000010u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData request_vote_rpc_msg_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    request_vote_rpc_msg_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*request_vote_rpc_msg_t::GetClassData() const { return &_class_data_; }
+
+
+void request_vote_rpc_msg_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<request_vote_rpc_msg_t*>(&to_msg);
+  auto& from = static_cast<const request_vote_rpc_msg_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:request_vote_rpc_msg_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.candidate_id_ = from._impl_.candidate_id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.term_ = from._impl_.term_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.last_log_term_ = from._impl_.last_log_term_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.last_log_index_ = from._impl_.last_log_index_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.leadership_transfer_ = from._impl_.leadership_transfer_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void request_vote_rpc_msg_t::CopyFrom(const request_vote_rpc_msg_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:request_vote_rpc_msg_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool request_vote_rpc_msg_t::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void request_vote_rpc_msg_t::InternalSwap(request_vote_rpc_msg_t* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(request_vote_rpc_msg_t, _impl_.leadership_transfer_)
+      + sizeof(request_vote_rpc_msg_t::_impl_.leadership_transfer_)
+      - PROTOBUF_FIELD_OFFSET(request_vote_rpc_msg_t, _impl_.candidate_id_)>(
+          reinterpret_cast<char*>(&_impl_.candidate_id_),
+          reinterpret_cast<char*>(&other->_impl_.candidate_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata request_vote_rpc_msg_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Msg_2eproto_getter, &descriptor_table_Msg_2eproto_once,
+      file_level_metadata_Msg_2eproto[6]);
+}
+
+// ===================================================================
+
+class request_vote_reply_msg_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<request_vote_reply_msg_t>()._impl_._has_bits_);
+  static void set_has_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_vote_granted(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_sender_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+request_vote_reply_msg_t::request_vote_reply_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:request_vote_reply_msg_t)
+}
+request_vote_reply_msg_t::request_vote_reply_msg_t(const request_vote_reply_msg_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  request_vote_reply_msg_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.vote_granted_){}
+    , decltype(_impl_.sender_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sender_id_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.sender_id_));
+  // @@protoc_insertion_point(copy_constructor:request_vote_reply_msg_t)
+}
+
+inline void request_vote_reply_msg_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.term_){0u}
+    , decltype(_impl_.vote_granted_){false}
+    , decltype(_impl_.sender_id_){0u}
+  };
+}
+
+request_vote_reply_msg_t::~request_vote_reply_msg_t() {
+  // @@protoc_insertion_point(destructor:request_vote_reply_msg_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void request_vote_reply_msg_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void request_vote_reply_msg_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void request_vote_reply_msg_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:request_vote_reply_msg_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.term_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.sender_id_) -
+        reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.sender_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* request_vote_reply_msg_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_term(&has_bits);
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool vote_granted = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_vote_granted(&has_bits);
+          _impl_.vote_granted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 sender_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_sender_id(&has_bits);
+          _impl_.sender_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* request_vote_reply_msg_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:request_vote_reply_msg_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 term = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // required bool vote_granted = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_vote_granted(), target);
+  }
+
+  // optional uint32 sender_id = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_sender_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:request_vote_reply_msg_t)
+  return target;
+}
+
+size_t request_vote_reply_msg_t::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:request_vote_reply_msg_t)
+  size_t total_size = 0;
+
+  if (_internal_has_term()) {
+    // required uint32 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_term());
+  }
+
+  if (_internal_has_vote_granted()) {
+    // required bool vote_granted = 2;
+    total_size += 1 + 1;
+  }
+
+  return total_size;
+}
+size_t request_vote_reply_msg_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:request_vote_reply_msg_t)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint32 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_term());
+
+    // required bool vote_granted = 2;
+    total_size += 1 + 1;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional uint32 sender_id = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000004u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sender_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData request_vote_reply_msg_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    request_vote_reply_msg_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*request_vote_reply_msg_t::GetClassData() const { return &_class_data_; }
+
+
+void request_vote_reply_msg_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<request_vote_reply_msg_t*>(&to_msg);
+  auto& from = static_cast<const request_vote_reply_msg_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:request_vote_reply_msg_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.term_ = from._impl_.term_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.vote_granted_ = from._impl_.vote_granted_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.sender_id_ = from._impl_.sender_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void request_vote_reply_msg_t::CopyFrom(const request_vote_reply_msg_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:request_vote_reply_msg_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool request_vote_reply_msg_t::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void request_vote_reply_msg_t::InternalSwap(request_vote_reply_msg_t* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(request_vote_reply_msg_t, _impl_.sender_id_)
+      + sizeof(request_vote_reply_msg_t::_impl_.sender_id_)
+      - PROTOBUF_FIELD_OFFSET(request_vote_reply_msg_t, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata request_vote_reply_msg_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Msg_2eproto_getter, &descriptor_table_Msg_2eproto_once,
+      file_level_metadata_Msg_2eproto[7]);
+}
+
+// ===================================================================
+
+class append_entry_rpc_msg_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<append_entry_rpc_msg_t>()._impl_._has_bits_);
+  static void set_has_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_leader_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_prev_log_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_prev_log_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_commit_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+append_entry_rpc_msg_t::append_entry_rpc_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:append_entry_rpc_msg_t)
+}
+append_entry_rpc_msg_t::append_entry_rpc_msg_t(const append_entry_rpc_msg_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  append_entry_rpc_msg_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.leader_id_){}
+    , decltype(_impl_.prev_log_term_){}
+    , decltype(_impl_.prev_log_index_){}
+    , decltype(_impl_.commit_index_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.commit_index_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.commit_index_));
+  // @@protoc_insertion_point(copy_constructor:append_entry_rpc_msg_t)
+}
+
+inline void append_entry_rpc_msg_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){arena}
+    , decltype(_impl_.term_){0u}
+    , decltype(_impl_.leader_id_){0u}
+    , decltype(_impl_.prev_log_term_){0u}
+    , decltype(_impl_.prev_log_index_){0}
+    , decltype(_impl_.commit_index_){0}
+  };
+}
+
+append_entry_rpc_msg_t::~append_entry_rpc_msg_t() {
+  // @@protoc_insertion_point(destructor:append_entry_rpc_msg_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void append_entry_rpc_msg_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+}
+
+void append_entry_rpc_msg_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void append_entry_rpc_msg_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:append_entry_rpc_msg_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.term_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.commit_index_) -
+        reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.commit_index_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* append_entry_rpc_msg_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_term(&has_bits);
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 leader_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_leader_id(&has_bits);
+          _impl_.leader_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 prev_log_term = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_prev_log_term(&has_bits);
+          _impl_.prev_log_term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 prev_log_index = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_prev_log_index(&has_bits);
+          _impl_.prev_log_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 commit_index = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_commit_index(&has_bits);
+          _impl_.commit_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes entries = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_entries();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* append_entry_rpc_msg_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:append_entry_rpc_msg_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 term = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // required uint32 leader_id = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_leader_id(), target);
+  }
+
+  // required uint32 prev_log_term = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_prev_log_term(), target);
+  }
+
+  // required int32 prev_log_index = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_prev_log_index(), target);
+  }
+
+  // required int32 commit_index = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_commit_index(), target);
+  }
+
+  // repeated bytes entries = 6;
+  for (int i = 0, n = this->_internal_entries_size(); i < n; i++) {
+    const auto& s = this->_internal_entries(i);
+    target = stream->WriteBytes(6, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:append_entry_rpc_msg_t)
+  return target;
+}
+
+size_t append_entry_rpc_msg_t::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:append_entry_rpc_msg_t)
+  size_t total_size = 0;
+
+  if (_internal_has_term()) {
+    // required uint32 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_term());
+  }
+
+  if (_internal_has_leader_id()) {
+    // required uint32 leader_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_leader_id());
+  }
+
+  if (_internal_has_prev_log_term()) {
+    // required uint32 prev_log_term = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_prev_log_term());
+  }
+
+  if (_internal_has_prev_log_index()) {
+    // required int32 prev_log_index = 4;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_prev_log_index());
+  }
+
+  if (_internal_has_commit_index()) {
+    // required int32 commit_index = 5;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_commit_index());
+  }
+
+  return total_size;
+}
+size_t append_entry_rpc_msg_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:append_entry_rpc_msg_t)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required uint32 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_term());
+
+    // required uint32 leader_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_leader_id());
+
+    // required uint32 prev_log_term = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_prev_log_term());
+
+    // required int32 prev_log_index = 4;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_prev_log_index());
+
+    // required int32 commit_index = 5;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_commit_index());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes entries = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.entries_.size());
+  for (int i = 0, n = _impl_.entries_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.entries_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData append_entry_rpc_msg_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    append_entry_rpc_msg_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*append_entry_rpc_msg_t::GetClassData() const { return &_class_data_; }
+
+
+void append_entry_rpc_msg_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<append_entry_rpc_msg_t*>(&to_msg);
+  auto& from = static_cast<const append_entry_rpc_msg_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:append_entry_rpc_msg_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.term_ = from._impl_.term_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.leader_id_ = from._impl_.leader_id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.prev_log_term_ = from._impl_.prev_log_term_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.prev_log_index_ = from._impl_.prev_log_index_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.commit_index_ = from._impl_.commit_index_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void append_entry_rpc_msg_t::CopyFrom(const append_entry_rpc_msg_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:append_entry_rpc_msg_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool append_entry_rpc_msg_t::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void append_entry_rpc_msg_t::InternalSwap(append_entry_rpc_msg_t* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(append_entry_rpc_msg_t, _impl_.commit_index_)
+      + sizeof(append_entry_rpc_msg_t::_impl_.commit_index_)
+      - PROTOBUF_FIELD_OFFSET(append_entry_rpc_msg_t, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata append_entry_rpc_msg_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Msg_2eproto_getter, &descriptor_table_Msg_2eproto_once,
+      file_level_metadata_Msg_2eproto[8]);
+}
+
+// ===================================================================
+
+class append_entry_reply_msg_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<append_entry_reply_msg_t>()._impl_._has_bits_);
+  static void set_has_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_sender_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_success(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_reply_heartbeat(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_match_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_commit_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+append_entry_reply_msg_t::append_entry_reply_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:append_entry_reply_msg_t)
+}
+append_entry_reply_msg_t::append_entry_reply_msg_t(const append_entry_reply_msg_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  append_entry_reply_msg_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.sender_id_){}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.reply_heartbeat_){}
+    , decltype(_impl_.match_index_){}
+    , decltype(_impl_.commit_index_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.commit_index_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.commit_index_));
+  // @@protoc_insertion_point(copy_constructor:append_entry_reply_msg_t)
+}
+
+inline void append_entry_reply_msg_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.term_){0u}
+    , decltype(_impl_.sender_id_){0u}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.reply_heartbeat_){false}
+    , decltype(_impl_.match_index_){0}
+    , decltype(_impl_.commit_index_){-1}
+  };
+}
+
+append_entry_reply_msg_t::~append_entry_reply_msg_t() {
+  // @@protoc_insertion_point(destructor:append_entry_reply_msg_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void append_entry_reply_msg_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void append_entry_reply_msg_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void append_entry_reply_msg_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:append_entry_reply_msg_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    ::memset(&_impl_.term_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.match_index_) -
+        reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.match_index_));
+    _impl_.commit_index_ = -1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* append_entry_reply_msg_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_term(&has_bits);
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 sender_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_sender_id(&has_bits);
+          _impl_.sender_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool success = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_success(&has_bits);
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool reply_heartbeat = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_reply_heartbeat(&has_bits);
+          _impl_.reply_heartbeat_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 match_index = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_match_index(&has_bits);
+          _impl_.match_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 commit_index = 6 [default = -1];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_commit_index(&has_bits);
+          _impl_.commit_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* append_entry_reply_msg_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:append_entry_reply_msg_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 term = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // required uint32 sender_id = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_sender_id(), target);
+  }
+
+  // required bool success = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_success(), target);
+  }
+
+  // required bool reply_heartbeat = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_reply_heartbeat(), target);
+  }
+
+  // optional int32 match_index = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_match_index(), target);
+  }
+
+  // optional int32 commit_index = 6 [default = -1];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_commit_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:append_entry_reply_msg_t)
+  return target;
+}
+
+size_t append_entry_reply_msg_t::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:append_entry_reply_msg_t)
+  size_t total_size = 0;
+
+  if (_internal_has_term()) {
+    // required uint32 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_term());
+  }
+
+  if (_internal_has_sender_id()) {
+    // required uint32 sender_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sender_id());
+  }
+
+  if (_internal_has_success()) {
+    // required bool success = 3;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_reply_heartbeat()) {
+    // required bool reply_heartbeat = 4;
+    total_size += 1 + 1;
+  }
+
+  return total_size;
+}
+size_t append_entry_reply_msg_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:append_entry_reply_msg_t)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required uint32 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_term());
+
+    // required uint32 sender_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sender_id());
+
+    // required bool success = 3;
+    total_size += 1 + 1;
+
+    // required bool reply_heartbeat = 4;
+    total_size += 1 + 1;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000030u) {
+    // optional int32 match_index = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_match_index());
+    }
+
+    // optional int32 commit_index = 6 [default = -1];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_commit_index());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData append_entry_reply_msg_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    append_entry_reply_msg_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*append_entry_reply_msg_t::GetClassData() const { return &_class_data_; }
+
+
+void append_entry_reply_msg_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<append_entry_reply_msg_t*>(&to_msg);
+  auto& from = static_cast<const append_entry_reply_msg_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:append_entry_reply_msg_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.term_ = from._impl_.term_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.sender_id_ = from._impl_.sender_id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.success_ = from._impl_.success_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.reply_heartbeat_ = from._impl_.reply_heartbeat_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.match_index_ = from._impl_.match_index_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.commit_index_ = from._impl_.commit_index_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void append_entry_reply_msg_t::CopyFrom(const append_entry_reply_msg_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:append_entry_reply_msg_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool append_entry_reply_msg_t::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void append_entry_reply_msg_t::InternalSwap(append_entry_reply_msg_t* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(append_entry_reply_msg_t, _impl_.match_index_)
+      + sizeof(append_entry_reply_msg_t::_impl_.match_index_)
+      - PROTOBUF_FIELD_OFFSET(append_entry_reply_msg_t, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+  swap(_impl_.commit_index_, other->_impl_.commit_index_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata append_entry_reply_msg_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Msg_2eproto_getter, &descriptor_table_Msg_2eproto_once,
+      file_level_metadata_Msg_2eproto[9]);
+}
+
+// ===================================================================
+
+class timeout_now_msg_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<timeout_now_msg_t>()._impl_._has_bits_);
+  static void set_has_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_leader_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+timeout_now_msg_t::timeout_now_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:timeout_now_msg_t)
+}
+timeout_now_msg_t::timeout_now_msg_t(const timeout_now_msg_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  timeout_now_msg_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.leader_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.leader_id_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.leader_id_));
+  // @@protoc_insertion_point(copy_constructor:timeout_now_msg_t)
+}
+
+inline void timeout_now_msg_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.term_){0u}
+    , decltype(_impl_.leader_id_){0u}
+  };
+}
+
+timeout_now_msg_t::~timeout_now_msg_t() {
+  // @@protoc_insertion_point(destructor:timeout_now_msg_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void timeout_now_msg_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void timeout_now_msg_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void timeout_now_msg_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:timeout_now_msg_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.term_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.leader_id_) -
+        reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.leader_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* timeout_now_msg_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_term(&has_bits);
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 leader_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_leader_id(&has_bits);
+          _impl_.leader_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* timeout_now_msg_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:timeout_now_msg_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 term = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // required uint32 leader_id = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_leader_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:timeout_now_msg_t)
+  return target;
+}
+
+size_t timeout_now_msg_t::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:timeout_now_msg_t)
+  size_t total_size = 0;
+
+  if (_internal_has_term()) {
+    // required uint32 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_term());
+  }
+
+  if (_internal_has_leader_id()) {
+    // required uint32 leader_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_leader_id());
+  }
+
+  return total_size;
+}
+size_t timeout_now_msg_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:timeout_now_msg_t)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint32 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_term());
+
+    // required uint32 leader_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_leader_id());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData timeout_now_msg_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    timeout_now_msg_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*timeout_now_msg_t::GetClassData() const { return &_class_data_; }
+
+
+void timeout_now_msg_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<timeout_now_msg_t*>(&to_msg);
+  auto& from = static_cast<const timeout_now_msg_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:timeout_now_msg_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.term_ = from._impl_.term_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.leader_id_ = from._impl_.leader_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void timeout_now_msg_t::CopyFrom(const timeout_now_msg_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:timeout_now_msg_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool timeout_now_msg_t::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void timeout_now_msg_t::InternalSwap(timeout_now_msg_t* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(timeout_now_msg_t, _impl_.leader_id_)
+      + sizeof(timeout_now_msg_t::_impl_.leader_id_)
+      - PROTOBUF_FIELD_OFFSET(timeout_now_msg_t, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata timeout_now_msg_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Msg_2eproto_getter, &descriptor_table_Msg_2eproto_once,
+      file_level_metadata_Msg_2eproto[10]);
+}
+
+// ===================================================================
+
+class xshard_msg_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<xshard_msg_t>()._impl_._has_bits_);
+  static void set_has_txn_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_from_shard(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_sender_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_recver_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_amount(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_commit(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+xshard_msg_t::xshard_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:xshard_msg_t)
+}
+xshard_msg_t::xshard_msg_t(const xshard_msg_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  xshard_msg_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.txn_id_){}
+    , decltype(_impl_.from_shard_){}
+    , decltype(_impl_.sender_id_){}
+    , decltype(_impl_.recver_id_){}
+    , decltype(_impl_.amount_){}
+    , decltype(_impl_.commit_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.txn_id_, &from._impl_.txn_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.commit_) -
+    reinterpret_cast<char*>(&_impl_.txn_id_)) + sizeof(_impl_.commit_));
+  // @@protoc_insertion_point(copy_constructor:xshard_msg_t)
+}
+
+inline void xshard_msg_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.txn_id_){uint64_t{0u}}
+    , decltype(_impl_.from_shard_){0u}
+    , decltype(_impl_.sender_id_){0u}
+    , decltype(_impl_.recver_id_){0u}
+    , decltype(_impl_.amount_){0}
+    , decltype(_impl_.commit_){false}
+  };
+}
+
+xshard_msg_t::~xshard_msg_t() {
+  // @@protoc_insertion_point(destructor:xshard_msg_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void xshard_msg_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void xshard_msg_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void xshard_msg_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:xshard_msg_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    ::memset(&_impl_.txn_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.commit_) -
+        reinterpret_cast<char*>(&_impl_.txn_id_)) + sizeof(_impl_.commit_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* xshard_msg_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 txn_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_txn_id(&has_bits);
+          _impl_.txn_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 from_shard = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_from_shard(&has_bits);
+          _impl_.from_shard_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 sender_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_sender_id(&has_bits);
+          _impl_.sender_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 recver_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_recver_id(&has_bits);
+          _impl_.recver_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float amount = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _Internal::set_has_amount(&has_bits);
+          _impl_.amount_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool commit = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_commit(&has_bits);
+          _impl_.commit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* xshard_msg_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:xshard_msg_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 txn_id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_txn_id(), target);
+  }
+
+  // required uint32 from_shard = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_from_shard(), target);
+  }
+
+  // optional uint32 sender_id = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_sender_id(), target);
+  }
+
+  // optional uint32 recver_id = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_recver_id(), target);
+  }
+
+  // optional float amount = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_amount(), target);
+  }
+
+  // optional bool commit = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_commit(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:xshard_msg_t)
+  return target;
+}
+
+size_t xshard_msg_t::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:xshard_msg_t)
+  size_t total_size = 0;
+
+  if (_internal_has_txn_id()) {
+    // required uint64 txn_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_txn_id());
+  }
+
+  if (_internal_has_from_shard()) {
+    // required uint32 from_shard = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_from_shard());
+  }
+
+  return total_size;
+}
+size_t xshard_msg_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:xshard_msg_t)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 txn_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_txn_id());
+
+    // required uint32 from_shard = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_from_shard());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003cu) {
+    // optional uint32 sender_id = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sender_id());
+    }
+
+    // optional uint32 recver_id = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_recver_id());
+    }
+
+    // optional float amount = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 4;
+    }
+
+    // optional bool commit = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData xshard_msg_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    xshard_msg_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*xshard_msg_t::GetClassData() const { return &_class_data_; }
+
+
+void xshard_msg_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<xshard_msg_t*>(&to_msg);
+  auto& from = static_cast<const xshard_msg_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:xshard_msg_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.txn_id_ = from._impl_.txn_id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.from_shard_ = from._impl_.from_shard_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.sender_id_ = from._impl_.sender_id_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.recver_id_ = from._impl_.recver_id_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.amount_ = from._impl_.amount_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.commit_ = from._impl_.commit_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void xshard_msg_t::CopyFrom(const xshard_msg_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:xshard_msg_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool xshard_msg_t::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void xshard_msg_t::InternalSwap(xshard_msg_t* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(xshard_msg_t, _impl_.commit_)
+      + sizeof(xshard_msg_t::_impl_.commit_)
+      - PROTOBUF_FIELD_OFFSET(xshard_msg_t, _impl_.txn_id_)>(
+          reinterpret_cast<char*>(&_impl_.txn_id_),
+          reinterpret_cast<char*>(&other->_impl_.txn_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata xshard_msg_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Msg_2eproto_getter, &descriptor_table_Msg_2eproto_once,
+      file_level_metadata_Msg_2eproto[11]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::request_msg_t*
+Arena::CreateMaybeMessage< ::request_msg_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::request_msg_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::response_msg_t*
+Arena::CreateMaybeMessage< ::response_msg_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::response_msg_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::txn_msg_t*
+Arena::CreateMaybeMessage< ::txn_msg_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::txn_msg_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::block_msg_t*
+Arena::CreateMaybeMessage< ::block_msg_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::block_msg_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::bc_msg_t*
+Arena::CreateMaybeMessage< ::bc_msg_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::bc_msg_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::replica_msg_t*
+Arena::CreateMaybeMessage< ::replica_msg_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::replica_msg_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::request_vote_rpc_msg_t*
+Arena::CreateMaybeMessage< ::request_vote_rpc_msg_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::request_vote_rpc_msg_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::request_vote_reply_msg_t*
+Arena::CreateMaybeMessage< ::request_vote_reply_msg_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::request_vote_reply_msg_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::append_entry_rpc_msg_t*
+Arena::CreateMaybeMessage< ::append_entry_rpc_msg_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::append_entry_rpc_msg_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::append_entry_reply_msg_t*
+Arena::CreateMaybeMessage< ::append_entry_reply_msg_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::append_entry_reply_msg_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::timeout_now_msg_t*
+Arena::CreateMaybeMessage< ::timeout_now_msg_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::timeout_now_msg_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::xshard_msg_t*
+Arena::CreateMaybeMessage< ::xshard_msg_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::xshard_msg_t >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
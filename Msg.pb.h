@@ -0,0 +1,5322 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: Msg.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_Msg_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_Msg_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_Msg_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_Msg_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_Msg_2eproto;
+class append_entry_reply_msg_t;
+struct append_entry_reply_msg_tDefaultTypeInternal;
+extern append_entry_reply_msg_tDefaultTypeInternal _append_entry_reply_msg_t_default_instance_;
+class append_entry_rpc_msg_t;
+struct append_entry_rpc_msg_tDefaultTypeInternal;
+extern append_entry_rpc_msg_tDefaultTypeInternal _append_entry_rpc_msg_t_default_instance_;
+class bc_msg_t;
+struct bc_msg_tDefaultTypeInternal;
+extern bc_msg_tDefaultTypeInternal _bc_msg_t_default_instance_;
+class block_msg_t;
+struct block_msg_tDefaultTypeInternal;
+extern block_msg_tDefaultTypeInternal _block_msg_t_default_instance_;
+class replica_msg_t;
+struct replica_msg_tDefaultTypeInternal;
+extern replica_msg_tDefaultTypeInternal _replica_msg_t_default_instance_;
+class request_msg_t;
+struct request_msg_tDefaultTypeInternal;
+extern request_msg_tDefaultTypeInternal _request_msg_t_default_instance_;
+class request_vote_reply_msg_t;
+struct request_vote_reply_msg_tDefaultTypeInternal;
+extern request_vote_reply_msg_tDefaultTypeInternal _request_vote_reply_msg_t_default_instance_;
+class request_vote_rpc_msg_t;
+struct request_vote_rpc_msg_tDefaultTypeInternal;
+extern request_vote_rpc_msg_tDefaultTypeInternal _request_vote_rpc_msg_t_default_instance_;
+class response_msg_t;
+struct response_msg_tDefaultTypeInternal;
+extern response_msg_tDefaultTypeInternal _response_msg_t_default_instance_;
+class timeout_now_msg_t;
+struct timeout_now_msg_tDefaultTypeInternal;
+extern timeout_now_msg_tDefaultTypeInternal _timeout_now_msg_t_default_instance_;
+class txn_msg_t;
+struct txn_msg_tDefaultTypeInternal;
+extern txn_msg_tDefaultTypeInternal _txn_msg_t_default_instance_;
+class xshard_msg_t;
+struct xshard_msg_tDefaultTypeInternal;
+extern xshard_msg_tDefaultTypeInternal _xshard_msg_t_default_instance_;
+PROTOBUF_NAMESPACE_OPEN
+template<> ::append_entry_reply_msg_t* Arena::CreateMaybeMessage<::append_entry_reply_msg_t>(Arena*);
+template<> ::append_entry_rpc_msg_t* Arena::CreateMaybeMessage<::append_entry_rpc_msg_t>(Arena*);
+template<> ::bc_msg_t* Arena::CreateMaybeMessage<::bc_msg_t>(Arena*);
+template<> ::block_msg_t* Arena::CreateMaybeMessage<::block_msg_t>(Arena*);
+template<> ::replica_msg_t* Arena::CreateMaybeMessage<::replica_msg_t>(Arena*);
+template<> ::request_msg_t* Arena::CreateMaybeMessage<::request_msg_t>(Arena*);
+template<> ::request_vote_reply_msg_t* Arena::CreateMaybeMessage<::request_vote_reply_msg_t>(Arena*);
+template<> ::request_vote_rpc_msg_t* Arena::CreateMaybeMessage<::request_vote_rpc_msg_t>(Arena*);
+template<> ::response_msg_t* Arena::CreateMaybeMessage<::response_msg_t>(Arena*);
+template<> ::timeout_now_msg_t* Arena::CreateMaybeMessage<::timeout_now_msg_t>(Arena*);
+template<> ::txn_msg_t* Arena::CreateMaybeMessage<::txn_msg_t>(Arena*);
+template<> ::xshard_msg_t* Arena::CreateMaybeMessage<::xshard_msg_t>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+
+// ===================================================================
+
+class request_msg_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:request_msg_t) */ {
+ public:
+  inline request_msg_t() : request_msg_t(nullptr) {}
+  ~request_msg_t() override;
+  explicit PROTOBUF_CONSTEXPR request_msg_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  request_msg_t(const request_msg_t& from);
+  request_msg_t(request_msg_t&& from) noexcept
+    : request_msg_t() {
+    *this = ::std::move(from);
+  }
+
+  inline request_msg_t& operator=(const request_msg_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline request_msg_t& operator=(request_msg_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const request_msg_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const request_msg_t* internal_default_instance() {
+    return reinterpret_cast<const request_msg_t*>(
+               &_request_msg_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(request_msg_t& a, request_msg_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(request_msg_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(request_msg_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  request_msg_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<request_msg_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const request_msg_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const request_msg_t& from) {
+    request_msg_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(request_msg_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "request_msg_t";
+  }
+  protected:
+  explicit request_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTransactionFieldNumber = 4,
+    kTypeFieldNumber = 1,
+    kClientIdFieldNumber = 2,
+    kRequestIdFieldNumber = 3,
+  };
+  // optional .txn_msg_t transaction = 4;
+  bool has_transaction() const;
+  private:
+  bool _internal_has_transaction() const;
+  public:
+  void clear_transaction();
+  const ::txn_msg_t& transaction() const;
+  PROTOBUF_NODISCARD ::txn_msg_t* release_transaction();
+  ::txn_msg_t* mutable_transaction();
+  void set_allocated_transaction(::txn_msg_t* transaction);
+  private:
+  const ::txn_msg_t& _internal_transaction() const;
+  ::txn_msg_t* _internal_mutable_transaction();
+  public:
+  void unsafe_arena_set_allocated_transaction(
+      ::txn_msg_t* transaction);
+  ::txn_msg_t* unsafe_arena_release_transaction();
+
+  // required uint32 type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  uint32_t type() const;
+  void set_type(uint32_t value);
+  private:
+  uint32_t _internal_type() const;
+  void _internal_set_type(uint32_t value);
+  public:
+
+  // required uint32 client_id = 2;
+  bool has_client_id() const;
+  private:
+  bool _internal_has_client_id() const;
+  public:
+  void clear_client_id();
+  uint32_t client_id() const;
+  void set_client_id(uint32_t value);
+  private:
+  uint32_t _internal_client_id() const;
+  void _internal_set_client_id(uint32_t value);
+  public:
+
+  // required uint64 request_id = 3;
+  bool has_request_id() const;
+  private:
+  bool _internal_has_request_id() const;
+  public:
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:request_msg_t)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::txn_msg_t* transaction_;
+    uint32_t type_;
+    uint32_t client_id_;
+    uint64_t request_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Msg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class response_msg_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:response_msg_t) */ {
+ public:
+  inline response_msg_t() : response_msg_t(nullptr) {}
+  ~response_msg_t() override;
+  explicit PROTOBUF_CONSTEXPR response_msg_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  response_msg_t(const response_msg_t& from);
+  response_msg_t(response_msg_t&& from) noexcept
+    : response_msg_t() {
+    *this = ::std::move(from);
+  }
+
+  inline response_msg_t& operator=(const response_msg_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline response_msg_t& operator=(response_msg_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const response_msg_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const response_msg_t* internal_default_instance() {
+    return reinterpret_cast<const response_msg_t*>(
+               &_response_msg_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(response_msg_t& a, response_msg_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(response_msg_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(response_msg_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  response_msg_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<response_msg_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const response_msg_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const response_msg_t& from) {
+    response_msg_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(response_msg_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "response_msg_t";
+  }
+  protected:
+  explicit response_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestIdFieldNumber = 2,
+    kTypeFieldNumber = 1,
+    kSucceedFieldNumber = 3,
+    kBalanceFieldNumber = 4,
+    kLeaderIdFieldNumber = 5,
+    kShardIdFieldNumber = 6,
+  };
+  // required uint64 request_id = 2;
+  bool has_request_id() const;
+  private:
+  bool _internal_has_request_id() const;
+  public:
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // required uint32 type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  uint32_t type() const;
+  void set_type(uint32_t value);
+  private:
+  uint32_t _internal_type() const;
+  void _internal_set_type(uint32_t value);
+  public:
+
+  // required bool succeed = 3;
+  bool has_succeed() const;
+  private:
+  bool _internal_has_succeed() const;
+  public:
+  void clear_succeed();
+  bool succeed() const;
+  void set_succeed(bool value);
+  private:
+  bool _internal_succeed() const;
+  void _internal_set_succeed(bool value);
+  public:
+
+  // optional float balance = 4;
+  bool has_balance() const;
+  private:
+  bool _internal_has_balance() const;
+  public:
+  void clear_balance();
+  float balance() const;
+  void set_balance(float value);
+  private:
+  float _internal_balance() const;
+  void _internal_set_balance(float value);
+  public:
+
+  // optional uint32 leader_id = 5;
+  bool has_leader_id() const;
+  private:
+  bool _internal_has_leader_id() const;
+  public:
+  void clear_leader_id();
+  uint32_t leader_id() const;
+  void set_leader_id(uint32_t value);
+  private:
+  uint32_t _internal_leader_id() const;
+  void _internal_set_leader_id(uint32_t value);
+  public:
+
+  // optional uint32 shard_id = 6;
+  bool has_shard_id() const;
+  private:
+  bool _internal_has_shard_id() const;
+  public:
+  void clear_shard_id();
+  uint32_t shard_id() const;
+  void set_shard_id(uint32_t value);
+  private:
+  uint32_t _internal_shard_id() const;
+  void _internal_set_shard_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:response_msg_t)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t request_id_;
+    uint32_t type_;
+    bool succeed_;
+    float balance_;
+    uint32_t leader_id_;
+    uint32_t shard_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Msg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class txn_msg_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:txn_msg_t) */ {
+ public:
+  inline txn_msg_t() : txn_msg_t(nullptr) {}
+  ~txn_msg_t() override;
+  explicit PROTOBUF_CONSTEXPR txn_msg_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  txn_msg_t(const txn_msg_t& from);
+  txn_msg_t(txn_msg_t&& from) noexcept
+    : txn_msg_t() {
+    *this = ::std::move(from);
+  }
+
+  inline txn_msg_t& operator=(const txn_msg_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline txn_msg_t& operator=(txn_msg_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const txn_msg_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const txn_msg_t* internal_default_instance() {
+    return reinterpret_cast<const txn_msg_t*>(
+               &_txn_msg_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(txn_msg_t& a, txn_msg_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(txn_msg_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(txn_msg_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  txn_msg_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<txn_msg_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const txn_msg_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const txn_msg_t& from) {
+    txn_msg_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(txn_msg_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "txn_msg_t";
+  }
+  protected:
+  explicit txn_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSenderIdFieldNumber = 1,
+    kRecverIdFieldNumber = 2,
+    kAmountFieldNumber = 3,
+    kBalTxnFlagFieldNumber = 4,
+    kConfigTxnFlagFieldNumber = 5,
+    kVotersFieldNumber = 6,
+    kXshardTxnIdFieldNumber = 8,
+    kXshardPhaseFieldNumber = 7,
+  };
+  // required uint32 sender_id = 1;
+  bool has_sender_id() const;
+  private:
+  bool _internal_has_sender_id() const;
+  public:
+  void clear_sender_id();
+  uint32_t sender_id() const;
+  void set_sender_id(uint32_t value);
+  private:
+  uint32_t _internal_sender_id() const;
+  void _internal_set_sender_id(uint32_t value);
+  public:
+
+  // required uint32 recver_id = 2;
+  bool has_recver_id() const;
+  private:
+  bool _internal_has_recver_id() const;
+  public:
+  void clear_recver_id();
+  uint32_t recver_id() const;
+  void set_recver_id(uint32_t value);
+  private:
+  uint32_t _internal_recver_id() const;
+  void _internal_set_recver_id(uint32_t value);
+  public:
+
+  // required float amount = 3;
+  bool has_amount() const;
+  private:
+  bool _internal_has_amount() const;
+  public:
+  void clear_amount();
+  float amount() const;
+  void set_amount(float value);
+  private:
+  float _internal_amount() const;
+  void _internal_set_amount(float value);
+  public:
+
+  // optional bool bal_txn_flag = 4;
+  bool has_bal_txn_flag() const;
+  private:
+  bool _internal_has_bal_txn_flag() const;
+  public:
+  void clear_bal_txn_flag();
+  bool bal_txn_flag() const;
+  void set_bal_txn_flag(bool value);
+  private:
+  bool _internal_bal_txn_flag() const;
+  void _internal_set_bal_txn_flag(bool value);
+  public:
+
+  // optional bool config_txn_flag = 5;
+  bool has_config_txn_flag() const;
+  private:
+  bool _internal_has_config_txn_flag() const;
+  public:
+  void clear_config_txn_flag();
+  bool config_txn_flag() const;
+  void set_config_txn_flag(bool value);
+  private:
+  bool _internal_config_txn_flag() const;
+  void _internal_set_config_txn_flag(bool value);
+  public:
+
+  // optional uint64 voters = 6;
+  bool has_voters() const;
+  private:
+  bool _internal_has_voters() const;
+  public:
+  void clear_voters();
+  uint64_t voters() const;
+  void set_voters(uint64_t value);
+  private:
+  uint64_t _internal_voters() const;
+  void _internal_set_voters(uint64_t value);
+  public:
+
+  // optional uint64 xshard_txn_id = 8;
+  bool has_xshard_txn_id() const;
+  private:
+  bool _internal_has_xshard_txn_id() const;
+  public:
+  void clear_xshard_txn_id();
+  uint64_t xshard_txn_id() const;
+  void set_xshard_txn_id(uint64_t value);
+  private:
+  uint64_t _internal_xshard_txn_id() const;
+  void _internal_set_xshard_txn_id(uint64_t value);
+  public:
+
+  // optional uint32 xshard_phase = 7;
+  bool has_xshard_phase() const;
+  private:
+  bool _internal_has_xshard_phase() const;
+  public:
+  void clear_xshard_phase();
+  uint32_t xshard_phase() const;
+  void set_xshard_phase(uint32_t value);
+  private:
+  uint32_t _internal_xshard_phase() const;
+  void _internal_set_xshard_phase(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:txn_msg_t)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t sender_id_;
+    uint32_t recver_id_;
+    float amount_;
+    bool bal_txn_flag_;
+    bool config_txn_flag_;
+    uint64_t voters_;
+    uint64_t xshard_txn_id_;
+    uint32_t xshard_phase_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Msg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class block_msg_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:block_msg_t) */ {
+ public:
+  inline block_msg_t() : block_msg_t(nullptr) {}
+  ~block_msg_t() override;
+  explicit PROTOBUF_CONSTEXPR block_msg_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  block_msg_t(const block_msg_t& from);
+  block_msg_t(block_msg_t&& from) noexcept
+    : block_msg_t() {
+    *this = ::std::move(from);
+  }
+
+  inline block_msg_t& operator=(const block_msg_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline block_msg_t& operator=(block_msg_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const block_msg_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const block_msg_t* internal_default_instance() {
+    return reinterpret_cast<const block_msg_t*>(
+               &_block_msg_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(block_msg_t& a, block_msg_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(block_msg_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(block_msg_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  block_msg_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<block_msg_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const block_msg_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const block_msg_t& from) {
+    block_msg_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(block_msg_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "block_msg_t";
+  }
+  protected:
+  explicit block_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPhashFieldNumber = 2,
+    kNonceFieldNumber = 3,
+    kTxnFieldNumber = 4,
+    kTermFieldNumber = 1,
+    kIndexFieldNumber = 5,
+  };
+  // required string phash = 2;
+  bool has_phash() const;
+  private:
+  bool _internal_has_phash() const;
+  public:
+  void clear_phash();
+  const std::string& phash() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_phash(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_phash();
+  PROTOBUF_NODISCARD std::string* release_phash();
+  void set_allocated_phash(std::string* phash);
+  private:
+  const std::string& _internal_phash() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_phash(const std::string& value);
+  std::string* _internal_mutable_phash();
+  public:
+
+  // required string nonce = 3;
+  bool has_nonce() const;
+  private:
+  bool _internal_has_nonce() const;
+  public:
+  void clear_nonce();
+  const std::string& nonce() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_nonce(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_nonce();
+  PROTOBUF_NODISCARD std::string* release_nonce();
+  void set_allocated_nonce(std::string* nonce);
+  private:
+  const std::string& _internal_nonce() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_nonce(const std::string& value);
+  std::string* _internal_mutable_nonce();
+  public:
+
+  // required .txn_msg_t txn = 4;
+  bool has_txn() const;
+  private:
+  bool _internal_has_txn() const;
+  public:
+  void clear_txn();
+  const ::txn_msg_t& txn() const;
+  PROTOBUF_NODISCARD ::txn_msg_t* release_txn();
+  ::txn_msg_t* mutable_txn();
+  void set_allocated_txn(::txn_msg_t* txn);
+  private:
+  const ::txn_msg_t& _internal_txn() const;
+  ::txn_msg_t* _internal_mutable_txn();
+  public:
+  void unsafe_arena_set_allocated_txn(
+      ::txn_msg_t* txn);
+  ::txn_msg_t* unsafe_arena_release_txn();
+
+  // required uint32 term = 1;
+  bool has_term() const;
+  private:
+  bool _internal_has_term() const;
+  public:
+  void clear_term();
+  uint32_t term() const;
+  void set_term(uint32_t value);
+  private:
+  uint32_t _internal_term() const;
+  void _internal_set_term(uint32_t value);
+  public:
+
+  // required int32 index = 5;
+  bool has_index() const;
+  private:
+  bool _internal_has_index() const;
+  public:
+  void clear_index();
+  int32_t index() const;
+  void set_index(int32_t value);
+  private:
+  int32_t _internal_index() const;
+  void _internal_set_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:block_msg_t)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr phash_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nonce_;
+    ::txn_msg_t* txn_;
+    uint32_t term_;
+    int32_t index_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Msg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class bc_msg_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:bc_msg_t) */ {
+ public:
+  inline bc_msg_t() : bc_msg_t(nullptr) {}
+  ~bc_msg_t() override;
+  explicit PROTOBUF_CONSTEXPR bc_msg_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  bc_msg_t(const bc_msg_t& from);
+  bc_msg_t(bc_msg_t&& from) noexcept
+    : bc_msg_t() {
+    *this = ::std::move(from);
+  }
+
+  inline bc_msg_t& operator=(const bc_msg_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline bc_msg_t& operator=(bc_msg_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const bc_msg_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const bc_msg_t* internal_default_instance() {
+    return reinterpret_cast<const bc_msg_t*>(
+               &_bc_msg_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(bc_msg_t& a, bc_msg_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(bc_msg_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(bc_msg_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  bc_msg_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<bc_msg_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const bc_msg_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const bc_msg_t& from) {
+    bc_msg_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(bc_msg_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "bc_msg_t";
+  }
+  protected:
+  explicit bc_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBlocksFieldNumber = 3,
+    kCommittedIndexFieldNumber = 1,
+  };
+  // repeated .block_msg_t blocks = 3;
+  int blocks_size() const;
+  private:
+  int _internal_blocks_size() const;
+  public:
+  void clear_blocks();
+  ::block_msg_t* mutable_blocks(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::block_msg_t >*
+      mutable_blocks();
+  private:
+  const ::block_msg_t& _internal_blocks(int index) const;
+  ::block_msg_t* _internal_add_blocks();
+  public:
+  const ::block_msg_t& blocks(int index) const;
+  ::block_msg_t* add_blocks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::block_msg_t >&
+      blocks() const;
+
+  // required int32 committed_index = 1;
+  bool has_committed_index() const;
+  private:
+  bool _internal_has_committed_index() const;
+  public:
+  void clear_committed_index();
+  int32_t committed_index() const;
+  void set_committed_index(int32_t value);
+  private:
+  int32_t _internal_committed_index() const;
+  void _internal_set_committed_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:bc_msg_t)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::block_msg_t > blocks_;
+    int32_t committed_index_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Msg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class replica_msg_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:replica_msg_t) */ {
+ public:
+  inline replica_msg_t() : replica_msg_t(nullptr) {}
+  ~replica_msg_t() override;
+  explicit PROTOBUF_CONSTEXPR replica_msg_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  replica_msg_t(const replica_msg_t& from);
+  replica_msg_t(replica_msg_t&& from) noexcept
+    : replica_msg_t() {
+    *this = ::std::move(from);
+  }
+
+  inline replica_msg_t& operator=(const replica_msg_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline replica_msg_t& operator=(replica_msg_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const replica_msg_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const replica_msg_t* internal_default_instance() {
+    return reinterpret_cast<const replica_msg_t*>(
+               &_replica_msg_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(replica_msg_t& a, replica_msg_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(replica_msg_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(replica_msg_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  replica_msg_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<replica_msg_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const replica_msg_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const replica_msg_t& from) {
+    replica_msg_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(replica_msg_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "replica_msg_t";
+  }
+  protected:
+  explicit replica_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestVoteRpcMsgFieldNumber = 3,
+    kRequestVoteReplyMsgFieldNumber = 4,
+    kAppendEntryRpcMsgFieldNumber = 5,
+    kAppendEntryReplyMsgFieldNumber = 6,
+    kTimeoutNowMsgFieldNumber = 7,
+    kXshardMsgFieldNumber = 9,
+    kTypeFieldNumber = 1,
+    kReceiverIdFieldNumber = 2,
+    kShardIdFieldNumber = 8,
+  };
+  // optional .request_vote_rpc_msg_t request_vote_rpc_msg = 3;
+  bool has_request_vote_rpc_msg() const;
+  private:
+  bool _internal_has_request_vote_rpc_msg() const;
+  public:
+  void clear_request_vote_rpc_msg();
+  const ::request_vote_rpc_msg_t& request_vote_rpc_msg() const;
+  PROTOBUF_NODISCARD ::request_vote_rpc_msg_t* release_request_vote_rpc_msg();
+  ::request_vote_rpc_msg_t* mutable_request_vote_rpc_msg();
+  void set_allocated_request_vote_rpc_msg(::request_vote_rpc_msg_t* request_vote_rpc_msg);
+  private:
+  const ::request_vote_rpc_msg_t& _internal_request_vote_rpc_msg() const;
+  ::request_vote_rpc_msg_t* _internal_mutable_request_vote_rpc_msg();
+  public:
+  void unsafe_arena_set_allocated_request_vote_rpc_msg(
+      ::request_vote_rpc_msg_t* request_vote_rpc_msg);
+  ::request_vote_rpc_msg_t* unsafe_arena_release_request_vote_rpc_msg();
+
+  // optional .request_vote_reply_msg_t request_vote_reply_msg = 4;
+  bool has_request_vote_reply_msg() const;
+  private:
+  bool _internal_has_request_vote_reply_msg() const;
+  public:
+  void clear_request_vote_reply_msg();
+  const ::request_vote_reply_msg_t& request_vote_reply_msg() const;
+  PROTOBUF_NODISCARD ::request_vote_reply_msg_t* release_request_vote_reply_msg();
+  ::request_vote_reply_msg_t* mutable_request_vote_reply_msg();
+  void set_allocated_request_vote_reply_msg(::request_vote_reply_msg_t* request_vote_reply_msg);
+  private:
+  const ::request_vote_reply_msg_t& _internal_request_vote_reply_msg() const;
+  ::request_vote_reply_msg_t* _internal_mutable_request_vote_reply_msg();
+  public:
+  void unsafe_arena_set_allocated_request_vote_reply_msg(
+      ::request_vote_reply_msg_t* request_vote_reply_msg);
+  ::request_vote_reply_msg_t* unsafe_arena_release_request_vote_reply_msg();
+
+  // optional .append_entry_rpc_msg_t append_entry_rpc_msg = 5;
+  bool has_append_entry_rpc_msg() const;
+  private:
+  bool _internal_has_append_entry_rpc_msg() const;
+  public:
+  void clear_append_entry_rpc_msg();
+  const ::append_entry_rpc_msg_t& append_entry_rpc_msg() const;
+  PROTOBUF_NODISCARD ::append_entry_rpc_msg_t* release_append_entry_rpc_msg();
+  ::append_entry_rpc_msg_t* mutable_append_entry_rpc_msg();
+  void set_allocated_append_entry_rpc_msg(::append_entry_rpc_msg_t* append_entry_rpc_msg);
+  private:
+  const ::append_entry_rpc_msg_t& _internal_append_entry_rpc_msg() const;
+  ::append_entry_rpc_msg_t* _internal_mutable_append_entry_rpc_msg();
+  public:
+  void unsafe_arena_set_allocated_append_entry_rpc_msg(
+      ::append_entry_rpc_msg_t* append_entry_rpc_msg);
+  ::append_entry_rpc_msg_t* unsafe_arena_release_append_entry_rpc_msg();
+
+  // optional .append_entry_reply_msg_t append_entry_reply_msg = 6;
+  bool has_append_entry_reply_msg() const;
+  private:
+  bool _internal_has_append_entry_reply_msg() const;
+  public:
+  void clear_append_entry_reply_msg();
+  const ::append_entry_reply_msg_t& append_entry_reply_msg() const;
+  PROTOBUF_NODISCARD ::append_entry_reply_msg_t* release_append_entry_reply_msg();
+  ::append_entry_reply_msg_t* mutable_append_entry_reply_msg();
+  void set_allocated_append_entry_reply_msg(::append_entry_reply_msg_t* append_entry_reply_msg);
+  private:
+  const ::append_entry_reply_msg_t& _internal_append_entry_reply_msg() const;
+  ::append_entry_reply_msg_t* _internal_mutable_append_entry_reply_msg();
+  public:
+  void unsafe_arena_set_allocated_append_entry_reply_msg(
+      ::append_entry_reply_msg_t* append_entry_reply_msg);
+  ::append_entry_reply_msg_t* unsafe_arena_release_append_entry_reply_msg();
+
+  // optional .timeout_now_msg_t timeout_now_msg = 7;
+  bool has_timeout_now_msg() const;
+  private:
+  bool _internal_has_timeout_now_msg() const;
+  public:
+  void clear_timeout_now_msg();
+  const ::timeout_now_msg_t& timeout_now_msg() const;
+  PROTOBUF_NODISCARD ::timeout_now_msg_t* release_timeout_now_msg();
+  ::timeout_now_msg_t* mutable_timeout_now_msg();
+  void set_allocated_timeout_now_msg(::timeout_now_msg_t* timeout_now_msg);
+  private:
+  const ::timeout_now_msg_t& _internal_timeout_now_msg() const;
+  ::timeout_now_msg_t* _internal_mutable_timeout_now_msg();
+  public:
+  void unsafe_arena_set_allocated_timeout_now_msg(
+      ::timeout_now_msg_t* timeout_now_msg);
+  ::timeout_now_msg_t* unsafe_arena_release_timeout_now_msg();
+
+  // optional .xshard_msg_t xshard_msg = 9;
+  bool has_xshard_msg() const;
+  private:
+  bool _internal_has_xshard_msg() const;
+  public:
+  void clear_xshard_msg();
+  const ::xshard_msg_t& xshard_msg() const;
+  PROTOBUF_NODISCARD ::xshard_msg_t* release_xshard_msg();
+  ::xshard_msg_t* mutable_xshard_msg();
+  void set_allocated_xshard_msg(::xshard_msg_t* xshard_msg);
+  private:
+  const ::xshard_msg_t& _internal_xshard_msg() const;
+  ::xshard_msg_t* _internal_mutable_xshard_msg();
+  public:
+  void unsafe_arena_set_allocated_xshard_msg(
+      ::xshard_msg_t* xshard_msg);
+  ::xshard_msg_t* unsafe_arena_release_xshard_msg();
+
+  // required uint32 type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  uint32_t type() const;
+  void set_type(uint32_t value);
+  private:
+  uint32_t _internal_type() const;
+  void _internal_set_type(uint32_t value);
+  public:
+
+  // optional uint32 receiver_id = 2;
+  bool has_receiver_id() const;
+  private:
+  bool _internal_has_receiver_id() const;
+  public:
+  void clear_receiver_id();
+  uint32_t receiver_id() const;
+  void set_receiver_id(uint32_t value);
+  private:
+  uint32_t _internal_receiver_id() const;
+  void _internal_set_receiver_id(uint32_t value);
+  public:
+
+  // optional uint32 shard_id = 8;
+  bool has_shard_id() const;
+  private:
+  bool _internal_has_shard_id() const;
+  public:
+  void clear_shard_id();
+  uint32_t shard_id() const;
+  void set_shard_id(uint32_t value);
+  private:
+  uint32_t _internal_shard_id() const;
+  void _internal_set_shard_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:replica_msg_t)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::request_vote_rpc_msg_t* request_vote_rpc_msg_;
+    ::request_vote_reply_msg_t* request_vote_reply_msg_;
+    ::append_entry_rpc_msg_t* append_entry_rpc_msg_;
+    ::append_entry_reply_msg_t* append_entry_reply_msg_;
+    ::timeout_now_msg_t* timeout_now_msg_;
+    ::xshard_msg_t* xshard_msg_;
+    uint32_t type_;
+    uint32_t receiver_id_;
+    uint32_t shard_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Msg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class request_vote_rpc_msg_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:request_vote_rpc_msg_t) */ {
+ public:
+  inline request_vote_rpc_msg_t() : request_vote_rpc_msg_t(nullptr) {}
+  ~request_vote_rpc_msg_t() override;
+  explicit PROTOBUF_CONSTEXPR request_vote_rpc_msg_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  request_vote_rpc_msg_t(const request_vote_rpc_msg_t& from);
+  request_vote_rpc_msg_t(request_vote_rpc_msg_t&& from) noexcept
+    : request_vote_rpc_msg_t() {
+    *this = ::std::move(from);
+  }
+
+  inline request_vote_rpc_msg_t& operator=(const request_vote_rpc_msg_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline request_vote_rpc_msg_t& operator=(request_vote_rpc_msg_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const request_vote_rpc_msg_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const request_vote_rpc_msg_t* internal_default_instance() {
+    return reinterpret_cast<const request_vote_rpc_msg_t*>(
+               &_request_vote_rpc_msg_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(request_vote_rpc_msg_t& a, request_vote_rpc_msg_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(request_vote_rpc_msg_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(request_vote_rpc_msg_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  request_vote_rpc_msg_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<request_vote_rpc_msg_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const request_vote_rpc_msg_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const request_vote_rpc_msg_t& from) {
+    request_vote_rpc_msg_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(request_vote_rpc_msg_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "request_vote_rpc_msg_t";
+  }
+  protected:
+  explicit request_vote_rpc_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCandidateIdFieldNumber = 1,
+    kTermFieldNumber = 2,
+    kLastLogTermFieldNumber = 3,
+    kLastLogIndexFieldNumber = 4,
+    kLeadershipTransferFieldNumber = 5,
+  };
+  // required uint32 candidate_id = 1;
+  bool has_candidate_id() const;
+  private:
+  bool _internal_has_candidate_id() const;
+  public:
+  void clear_candidate_id();
+  uint32_t candidate_id() const;
+  void set_candidate_id(uint32_t value);
+  private:
+  uint32_t _internal_candidate_id() const;
+  void _internal_set_candidate_id(uint32_t value);
+  public:
+
+  // required uint32 term = 2;
+  bool has_term() const;
+  private:
+  bool _internal_has_term() const;
+  public:
+  void clear_term();
+  uint32_t term() const;
+  void set_term(uint32_t value);
+  private:
+  uint32_t _internal_term() const;
+  void _internal_set_term(uint32_t value);
+  public:
+
+  // required uint32 last_log_term = 3;
+  bool has_last_log_term() const;
+  private:
+  bool _internal_has_last_log_term() const;
+  public:
+  void clear_last_log_term();
+  uint32_t last_log_term() const;
+  void set_last_log_term(uint32_t value);
+  private:
+  uint32_t _internal_last_log_term() const;
+  void _internal_set_last_log_term(uint32_t value);
+  public:
+
+  // required int32 last_log_index = 4;
+  bool has_last_log_index() const;
+  private:
+  bool _internal_has_last_log_index() const;
+  public:
+  void clear_last_log_index();
+  int32_t last_log_index() const;
+  void set_last_log_index(int32_t value);
+  private:
+  int32_t _internal_last_log_index() const;
+  void _internal_set_last_log_index(int32_t value);
+  public:
+
+  // optional bool leadership_transfer = 5;
+  bool has_leadership_transfer() const;
+  private:
+  bool _internal_has_leadership_transfer() const;
+  public:
+  void clear_leadership_transfer();
+  bool leadership_transfer() const;
+  void set_leadership_transfer(bool value);
+  private:
+  bool _internal_leadership_transfer() const;
+  void _internal_set_leadership_transfer(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:request_vote_rpc_msg_t)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t candidate_id_;
+    uint32_t term_;
+    uint32_t last_log_term_;
+    int32_t last_log_index_;
+    bool leadership_transfer_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Msg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class request_vote_reply_msg_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:request_vote_reply_msg_t) */ {
+ public:
+  inline request_vote_reply_msg_t() : request_vote_reply_msg_t(nullptr) {}
+  ~request_vote_reply_msg_t() override;
+  explicit PROTOBUF_CONSTEXPR request_vote_reply_msg_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  request_vote_reply_msg_t(const request_vote_reply_msg_t& from);
+  request_vote_reply_msg_t(request_vote_reply_msg_t&& from) noexcept
+    : request_vote_reply_msg_t() {
+    *this = ::std::move(from);
+  }
+
+  inline request_vote_reply_msg_t& operator=(const request_vote_reply_msg_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline request_vote_reply_msg_t& operator=(request_vote_reply_msg_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const request_vote_reply_msg_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const request_vote_reply_msg_t* internal_default_instance() {
+    return reinterpret_cast<const request_vote_reply_msg_t*>(
+               &_request_vote_reply_msg_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(request_vote_reply_msg_t& a, request_vote_reply_msg_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(request_vote_reply_msg_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(request_vote_reply_msg_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  request_vote_reply_msg_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<request_vote_reply_msg_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const request_vote_reply_msg_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const request_vote_reply_msg_t& from) {
+    request_vote_reply_msg_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(request_vote_reply_msg_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "request_vote_reply_msg_t";
+  }
+  protected:
+  explicit request_vote_reply_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kVoteGrantedFieldNumber = 2,
+    kSenderIdFieldNumber = 3,
+  };
+  // required uint32 term = 1;
+  bool has_term() const;
+  private:
+  bool _internal_has_term() const;
+  public:
+  void clear_term();
+  uint32_t term() const;
+  void set_term(uint32_t value);
+  private:
+  uint32_t _internal_term() const;
+  void _internal_set_term(uint32_t value);
+  public:
+
+  // required bool vote_granted = 2;
+  bool has_vote_granted() const;
+  private:
+  bool _internal_has_vote_granted() const;
+  public:
+  void clear_vote_granted();
+  bool vote_granted() const;
+  void set_vote_granted(bool value);
+  private:
+  bool _internal_vote_granted() const;
+  void _internal_set_vote_granted(bool value);
+  public:
+
+  // optional uint32 sender_id = 3;
+  bool has_sender_id() const;
+  private:
+  bool _internal_has_sender_id() const;
+  public:
+  void clear_sender_id();
+  uint32_t sender_id() const;
+  void set_sender_id(uint32_t value);
+  private:
+  uint32_t _internal_sender_id() const;
+  void _internal_set_sender_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:request_vote_reply_msg_t)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t term_;
+    bool vote_granted_;
+    uint32_t sender_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Msg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class append_entry_rpc_msg_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:append_entry_rpc_msg_t) */ {
+ public:
+  inline append_entry_rpc_msg_t() : append_entry_rpc_msg_t(nullptr) {}
+  ~append_entry_rpc_msg_t() override;
+  explicit PROTOBUF_CONSTEXPR append_entry_rpc_msg_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  append_entry_rpc_msg_t(const append_entry_rpc_msg_t& from);
+  append_entry_rpc_msg_t(append_entry_rpc_msg_t&& from) noexcept
+    : append_entry_rpc_msg_t() {
+    *this = ::std::move(from);
+  }
+
+  inline append_entry_rpc_msg_t& operator=(const append_entry_rpc_msg_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline append_entry_rpc_msg_t& operator=(append_entry_rpc_msg_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const append_entry_rpc_msg_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const append_entry_rpc_msg_t* internal_default_instance() {
+    return reinterpret_cast<const append_entry_rpc_msg_t*>(
+               &_append_entry_rpc_msg_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(append_entry_rpc_msg_t& a, append_entry_rpc_msg_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(append_entry_rpc_msg_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(append_entry_rpc_msg_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  append_entry_rpc_msg_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<append_entry_rpc_msg_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const append_entry_rpc_msg_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const append_entry_rpc_msg_t& from) {
+    append_entry_rpc_msg_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(append_entry_rpc_msg_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "append_entry_rpc_msg_t";
+  }
+  protected:
+  explicit append_entry_rpc_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 6,
+    kTermFieldNumber = 1,
+    kLeaderIdFieldNumber = 2,
+    kPrevLogTermFieldNumber = 3,
+    kPrevLogIndexFieldNumber = 4,
+    kCommitIndexFieldNumber = 5,
+  };
+  // repeated bytes entries = 6;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  const std::string& entries(int index) const;
+  std::string* mutable_entries(int index);
+  void set_entries(int index, const std::string& value);
+  void set_entries(int index, std::string&& value);
+  void set_entries(int index, const char* value);
+  void set_entries(int index, const void* value, size_t size);
+  std::string* add_entries();
+  void add_entries(const std::string& value);
+  void add_entries(std::string&& value);
+  void add_entries(const char* value);
+  void add_entries(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& entries() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_entries();
+  private:
+  const std::string& _internal_entries(int index) const;
+  std::string* _internal_add_entries();
+  public:
+
+  // required uint32 term = 1;
+  bool has_term() const;
+  private:
+  bool _internal_has_term() const;
+  public:
+  void clear_term();
+  uint32_t term() const;
+  void set_term(uint32_t value);
+  private:
+  uint32_t _internal_term() const;
+  void _internal_set_term(uint32_t value);
+  public:
+
+  // required uint32 leader_id = 2;
+  bool has_leader_id() const;
+  private:
+  bool _internal_has_leader_id() const;
+  public:
+  void clear_leader_id();
+  uint32_t leader_id() const;
+  void set_leader_id(uint32_t value);
+  private:
+  uint32_t _internal_leader_id() const;
+  void _internal_set_leader_id(uint32_t value);
+  public:
+
+  // required uint32 prev_log_term = 3;
+  bool has_prev_log_term() const;
+  private:
+  bool _internal_has_prev_log_term() const;
+  public:
+  void clear_prev_log_term();
+  uint32_t prev_log_term() const;
+  void set_prev_log_term(uint32_t value);
+  private:
+  uint32_t _internal_prev_log_term() const;
+  void _internal_set_prev_log_term(uint32_t value);
+  public:
+
+  // required int32 prev_log_index = 4;
+  bool has_prev_log_index() const;
+  private:
+  bool _internal_has_prev_log_index() const;
+  public:
+  void clear_prev_log_index();
+  int32_t prev_log_index() const;
+  void set_prev_log_index(int32_t value);
+  private:
+  int32_t _internal_prev_log_index() const;
+  void _internal_set_prev_log_index(int32_t value);
+  public:
+
+  // required int32 commit_index = 5;
+  bool has_commit_index() const;
+  private:
+  bool _internal_has_commit_index() const;
+  public:
+  void clear_commit_index();
+  int32_t commit_index() const;
+  void set_commit_index(int32_t value);
+  private:
+  int32_t _internal_commit_index() const;
+  void _internal_set_commit_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:append_entry_rpc_msg_t)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> entries_;
+    uint32_t term_;
+    uint32_t leader_id_;
+    uint32_t prev_log_term_;
+    int32_t prev_log_index_;
+    int32_t commit_index_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Msg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class append_entry_reply_msg_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:append_entry_reply_msg_t) */ {
+ public:
+  inline append_entry_reply_msg_t() : append_entry_reply_msg_t(nullptr) {}
+  ~append_entry_reply_msg_t() override;
+  explicit PROTOBUF_CONSTEXPR append_entry_reply_msg_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  append_entry_reply_msg_t(const append_entry_reply_msg_t& from);
+  append_entry_reply_msg_t(append_entry_reply_msg_t&& from) noexcept
+    : append_entry_reply_msg_t() {
+    *this = ::std::move(from);
+  }
+
+  inline append_entry_reply_msg_t& operator=(const append_entry_reply_msg_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline append_entry_reply_msg_t& operator=(append_entry_reply_msg_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const append_entry_reply_msg_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const append_entry_reply_msg_t* internal_default_instance() {
+    return reinterpret_cast<const append_entry_reply_msg_t*>(
+               &_append_entry_reply_msg_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(append_entry_reply_msg_t& a, append_entry_reply_msg_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(append_entry_reply_msg_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(append_entry_reply_msg_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  append_entry_reply_msg_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<append_entry_reply_msg_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const append_entry_reply_msg_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const append_entry_reply_msg_t& from) {
+    append_entry_reply_msg_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(append_entry_reply_msg_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "append_entry_reply_msg_t";
+  }
+  protected:
+  explicit append_entry_reply_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kSenderIdFieldNumber = 2,
+    kSuccessFieldNumber = 3,
+    kReplyHeartbeatFieldNumber = 4,
+    kMatchIndexFieldNumber = 5,
+    kCommitIndexFieldNumber = 6,
+  };
+  // required uint32 term = 1;
+  bool has_term() const;
+  private:
+  bool _internal_has_term() const;
+  public:
+  void clear_term();
+  uint32_t term() const;
+  void set_term(uint32_t value);
+  private:
+  uint32_t _internal_term() const;
+  void _internal_set_term(uint32_t value);
+  public:
+
+  // required uint32 sender_id = 2;
+  bool has_sender_id() const;
+  private:
+  bool _internal_has_sender_id() const;
+  public:
+  void clear_sender_id();
+  uint32_t sender_id() const;
+  void set_sender_id(uint32_t value);
+  private:
+  uint32_t _internal_sender_id() const;
+  void _internal_set_sender_id(uint32_t value);
+  public:
+
+  // required bool success = 3;
+  bool has_success() const;
+  private:
+  bool _internal_has_success() const;
+  public:
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // required bool reply_heartbeat = 4;
+  bool has_reply_heartbeat() const;
+  private:
+  bool _internal_has_reply_heartbeat() const;
+  public:
+  void clear_reply_heartbeat();
+  bool reply_heartbeat() const;
+  void set_reply_heartbeat(bool value);
+  private:
+  bool _internal_reply_heartbeat() const;
+  void _internal_set_reply_heartbeat(bool value);
+  public:
+
+  // optional int32 match_index = 5;
+  bool has_match_index() const;
+  private:
+  bool _internal_has_match_index() const;
+  public:
+  void clear_match_index();
+  int32_t match_index() const;
+  void set_match_index(int32_t value);
+  private:
+  int32_t _internal_match_index() const;
+  void _internal_set_match_index(int32_t value);
+  public:
+
+  // optional int32 commit_index = 6 [default = -1];
+  bool has_commit_index() const;
+  private:
+  bool _internal_has_commit_index() const;
+  public:
+  void clear_commit_index();
+  int32_t commit_index() const;
+  void set_commit_index(int32_t value);
+  private:
+  int32_t _internal_commit_index() const;
+  void _internal_set_commit_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:append_entry_reply_msg_t)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t term_;
+    uint32_t sender_id_;
+    bool success_;
+    bool reply_heartbeat_;
+    int32_t match_index_;
+    int32_t commit_index_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Msg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class timeout_now_msg_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:timeout_now_msg_t) */ {
+ public:
+  inline timeout_now_msg_t() : timeout_now_msg_t(nullptr) {}
+  ~timeout_now_msg_t() override;
+  explicit PROTOBUF_CONSTEXPR timeout_now_msg_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  timeout_now_msg_t(const timeout_now_msg_t& from);
+  timeout_now_msg_t(timeout_now_msg_t&& from) noexcept
+    : timeout_now_msg_t() {
+    *this = ::std::move(from);
+  }
+
+  inline timeout_now_msg_t& operator=(const timeout_now_msg_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline timeout_now_msg_t& operator=(timeout_now_msg_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const timeout_now_msg_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const timeout_now_msg_t* internal_default_instance() {
+    return reinterpret_cast<const timeout_now_msg_t*>(
+               &_timeout_now_msg_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(timeout_now_msg_t& a, timeout_now_msg_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(timeout_now_msg_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(timeout_now_msg_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  timeout_now_msg_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<timeout_now_msg_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const timeout_now_msg_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const timeout_now_msg_t& from) {
+    timeout_now_msg_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(timeout_now_msg_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "timeout_now_msg_t";
+  }
+  protected:
+  explicit timeout_now_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kLeaderIdFieldNumber = 2,
+  };
+  // required uint32 term = 1;
+  bool has_term() const;
+  private:
+  bool _internal_has_term() const;
+  public:
+  void clear_term();
+  uint32_t term() const;
+  void set_term(uint32_t value);
+  private:
+  uint32_t _internal_term() const;
+  void _internal_set_term(uint32_t value);
+  public:
+
+  // required uint32 leader_id = 2;
+  bool has_leader_id() const;
+  private:
+  bool _internal_has_leader_id() const;
+  public:
+  void clear_leader_id();
+  uint32_t leader_id() const;
+  void set_leader_id(uint32_t value);
+  private:
+  uint32_t _internal_leader_id() const;
+  void _internal_set_leader_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:timeout_now_msg_t)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t term_;
+    uint32_t leader_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Msg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class xshard_msg_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:xshard_msg_t) */ {
+ public:
+  inline xshard_msg_t() : xshard_msg_t(nullptr) {}
+  ~xshard_msg_t() override;
+  explicit PROTOBUF_CONSTEXPR xshard_msg_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  xshard_msg_t(const xshard_msg_t& from);
+  xshard_msg_t(xshard_msg_t&& from) noexcept
+    : xshard_msg_t() {
+    *this = ::std::move(from);
+  }
+
+  inline xshard_msg_t& operator=(const xshard_msg_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline xshard_msg_t& operator=(xshard_msg_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const xshard_msg_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const xshard_msg_t* internal_default_instance() {
+    return reinterpret_cast<const xshard_msg_t*>(
+               &_xshard_msg_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(xshard_msg_t& a, xshard_msg_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(xshard_msg_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(xshard_msg_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  xshard_msg_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<xshard_msg_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const xshard_msg_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const xshard_msg_t& from) {
+    xshard_msg_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(xshard_msg_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "xshard_msg_t";
+  }
+  protected:
+  explicit xshard_msg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTxnIdFieldNumber = 1,
+    kFromShardFieldNumber = 2,
+    kSenderIdFieldNumber = 3,
+    kRecverIdFieldNumber = 4,
+    kAmountFieldNumber = 5,
+    kCommitFieldNumber = 6,
+  };
+  // required uint64 txn_id = 1;
+  bool has_txn_id() const;
+  private:
+  bool _internal_has_txn_id() const;
+  public:
+  void clear_txn_id();
+  uint64_t txn_id() const;
+  void set_txn_id(uint64_t value);
+  private:
+  uint64_t _internal_txn_id() const;
+  void _internal_set_txn_id(uint64_t value);
+  public:
+
+  // required uint32 from_shard = 2;
+  bool has_from_shard() const;
+  private:
+  bool _internal_has_from_shard() const;
+  public:
+  void clear_from_shard();
+  uint32_t from_shard() const;
+  void set_from_shard(uint32_t value);
+  private:
+  uint32_t _internal_from_shard() const;
+  void _internal_set_from_shard(uint32_t value);
+  public:
+
+  // optional uint32 sender_id = 3;
+  bool has_sender_id() const;
+  private:
+  bool _internal_has_sender_id() const;
+  public:
+  void clear_sender_id();
+  uint32_t sender_id() const;
+  void set_sender_id(uint32_t value);
+  private:
+  uint32_t _internal_sender_id() const;
+  void _internal_set_sender_id(uint32_t value);
+  public:
+
+  // optional uint32 recver_id = 4;
+  bool has_recver_id() const;
+  private:
+  bool _internal_has_recver_id() const;
+  public:
+  void clear_recver_id();
+  uint32_t recver_id() const;
+  void set_recver_id(uint32_t value);
+  private:
+  uint32_t _internal_recver_id() const;
+  void _internal_set_recver_id(uint32_t value);
+  public:
+
+  // optional float amount = 5;
+  bool has_amount() const;
+  private:
+  bool _internal_has_amount() const;
+  public:
+  void clear_amount();
+  float amount() const;
+  void set_amount(float value);
+  private:
+  float _internal_amount() const;
+  void _internal_set_amount(float value);
+  public:
+
+  // optional bool commit = 6;
+  bool has_commit() const;
+  private:
+  bool _internal_has_commit() const;
+  public:
+  void clear_commit();
+  bool commit() const;
+  void set_commit(bool value);
+  private:
+  bool _internal_commit() const;
+  void _internal_set_commit(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:xshard_msg_t)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t txn_id_;
+    uint32_t from_shard_;
+    uint32_t sender_id_;
+    uint32_t recver_id_;
+    float amount_;
+    bool commit_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Msg_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// request_msg_t
+
+// required uint32 type = 1;
+inline bool request_msg_t::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool request_msg_t::has_type() const {
+  return _internal_has_type();
+}
+inline void request_msg_t::clear_type() {
+  _impl_.type_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t request_msg_t::_internal_type() const {
+  return _impl_.type_;
+}
+inline uint32_t request_msg_t::type() const {
+  // @@protoc_insertion_point(field_get:request_msg_t.type)
+  return _internal_type();
+}
+inline void request_msg_t::_internal_set_type(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_ = value;
+}
+inline void request_msg_t::set_type(uint32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:request_msg_t.type)
+}
+
+// required uint32 client_id = 2;
+inline bool request_msg_t::_internal_has_client_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool request_msg_t::has_client_id() const {
+  return _internal_has_client_id();
+}
+inline void request_msg_t::clear_client_id() {
+  _impl_.client_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t request_msg_t::_internal_client_id() const {
+  return _impl_.client_id_;
+}
+inline uint32_t request_msg_t::client_id() const {
+  // @@protoc_insertion_point(field_get:request_msg_t.client_id)
+  return _internal_client_id();
+}
+inline void request_msg_t::_internal_set_client_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.client_id_ = value;
+}
+inline void request_msg_t::set_client_id(uint32_t value) {
+  _internal_set_client_id(value);
+  // @@protoc_insertion_point(field_set:request_msg_t.client_id)
+}
+
+// required uint64 request_id = 3;
+inline bool request_msg_t::_internal_has_request_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool request_msg_t::has_request_id() const {
+  return _internal_has_request_id();
+}
+inline void request_msg_t::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t request_msg_t::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t request_msg_t::request_id() const {
+  // @@protoc_insertion_point(field_get:request_msg_t.request_id)
+  return _internal_request_id();
+}
+inline void request_msg_t::_internal_set_request_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.request_id_ = value;
+}
+inline void request_msg_t::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:request_msg_t.request_id)
+}
+
+// optional .txn_msg_t transaction = 4;
+inline bool request_msg_t::_internal_has_transaction() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.transaction_ != nullptr);
+  return value;
+}
+inline bool request_msg_t::has_transaction() const {
+  return _internal_has_transaction();
+}
+inline void request_msg_t::clear_transaction() {
+  if (_impl_.transaction_ != nullptr) _impl_.transaction_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::txn_msg_t& request_msg_t::_internal_transaction() const {
+  const ::txn_msg_t* p = _impl_.transaction_;
+  return p != nullptr ? *p : reinterpret_cast<const ::txn_msg_t&>(
+      ::_txn_msg_t_default_instance_);
+}
+inline const ::txn_msg_t& request_msg_t::transaction() const {
+  // @@protoc_insertion_point(field_get:request_msg_t.transaction)
+  return _internal_transaction();
+}
+inline void request_msg_t::unsafe_arena_set_allocated_transaction(
+    ::txn_msg_t* transaction) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.transaction_);
+  }
+  _impl_.transaction_ = transaction;
+  if (transaction) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:request_msg_t.transaction)
+}
+inline ::txn_msg_t* request_msg_t::release_transaction() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::txn_msg_t* temp = _impl_.transaction_;
+  _impl_.transaction_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::txn_msg_t* request_msg_t::unsafe_arena_release_transaction() {
+  // @@protoc_insertion_point(field_release:request_msg_t.transaction)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::txn_msg_t* temp = _impl_.transaction_;
+  _impl_.transaction_ = nullptr;
+  return temp;
+}
+inline ::txn_msg_t* request_msg_t::_internal_mutable_transaction() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.transaction_ == nullptr) {
+    auto* p = CreateMaybeMessage<::txn_msg_t>(GetArenaForAllocation());
+    _impl_.transaction_ = p;
+  }
+  return _impl_.transaction_;
+}
+inline ::txn_msg_t* request_msg_t::mutable_transaction() {
+  ::txn_msg_t* _msg = _internal_mutable_transaction();
+  // @@protoc_insertion_point(field_mutable:request_msg_t.transaction)
+  return _msg;
+}
+inline void request_msg_t::set_allocated_transaction(::txn_msg_t* transaction) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.transaction_;
+  }
+  if (transaction) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(transaction);
+    if (message_arena != submessage_arena) {
+      transaction = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, transaction, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.transaction_ = transaction;
+  // @@protoc_insertion_point(field_set_allocated:request_msg_t.transaction)
+}
+
+// -------------------------------------------------------------------
+
+// response_msg_t
+
+// required uint32 type = 1;
+inline bool response_msg_t::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool response_msg_t::has_type() const {
+  return _internal_has_type();
+}
+inline void response_msg_t::clear_type() {
+  _impl_.type_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t response_msg_t::_internal_type() const {
+  return _impl_.type_;
+}
+inline uint32_t response_msg_t::type() const {
+  // @@protoc_insertion_point(field_get:response_msg_t.type)
+  return _internal_type();
+}
+inline void response_msg_t::_internal_set_type(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_ = value;
+}
+inline void response_msg_t::set_type(uint32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:response_msg_t.type)
+}
+
+// required uint64 request_id = 2;
+inline bool response_msg_t::_internal_has_request_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool response_msg_t::has_request_id() const {
+  return _internal_has_request_id();
+}
+inline void response_msg_t::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t response_msg_t::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t response_msg_t::request_id() const {
+  // @@protoc_insertion_point(field_get:response_msg_t.request_id)
+  return _internal_request_id();
+}
+inline void response_msg_t::_internal_set_request_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.request_id_ = value;
+}
+inline void response_msg_t::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:response_msg_t.request_id)
+}
+
+// required bool succeed = 3;
+inline bool response_msg_t::_internal_has_succeed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool response_msg_t::has_succeed() const {
+  return _internal_has_succeed();
+}
+inline void response_msg_t::clear_succeed() {
+  _impl_.succeed_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool response_msg_t::_internal_succeed() const {
+  return _impl_.succeed_;
+}
+inline bool response_msg_t::succeed() const {
+  // @@protoc_insertion_point(field_get:response_msg_t.succeed)
+  return _internal_succeed();
+}
+inline void response_msg_t::_internal_set_succeed(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.succeed_ = value;
+}
+inline void response_msg_t::set_succeed(bool value) {
+  _internal_set_succeed(value);
+  // @@protoc_insertion_point(field_set:response_msg_t.succeed)
+}
+
+// optional float balance = 4;
+inline bool response_msg_t::_internal_has_balance() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool response_msg_t::has_balance() const {
+  return _internal_has_balance();
+}
+inline void response_msg_t::clear_balance() {
+  _impl_.balance_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline float response_msg_t::_internal_balance() const {
+  return _impl_.balance_;
+}
+inline float response_msg_t::balance() const {
+  // @@protoc_insertion_point(field_get:response_msg_t.balance)
+  return _internal_balance();
+}
+inline void response_msg_t::_internal_set_balance(float value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.balance_ = value;
+}
+inline void response_msg_t::set_balance(float value) {
+  _internal_set_balance(value);
+  // @@protoc_insertion_point(field_set:response_msg_t.balance)
+}
+
+// optional uint32 leader_id = 5;
+inline bool response_msg_t::_internal_has_leader_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool response_msg_t::has_leader_id() const {
+  return _internal_has_leader_id();
+}
+inline void response_msg_t::clear_leader_id() {
+  _impl_.leader_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t response_msg_t::_internal_leader_id() const {
+  return _impl_.leader_id_;
+}
+inline uint32_t response_msg_t::leader_id() const {
+  // @@protoc_insertion_point(field_get:response_msg_t.leader_id)
+  return _internal_leader_id();
+}
+inline void response_msg_t::_internal_set_leader_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.leader_id_ = value;
+}
+inline void response_msg_t::set_leader_id(uint32_t value) {
+  _internal_set_leader_id(value);
+  // @@protoc_insertion_point(field_set:response_msg_t.leader_id)
+}
+
+// optional uint32 shard_id = 6;
+inline bool response_msg_t::_internal_has_shard_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool response_msg_t::has_shard_id() const {
+  return _internal_has_shard_id();
+}
+inline void response_msg_t::clear_shard_id() {
+  _impl_.shard_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t response_msg_t::_internal_shard_id() const {
+  return _impl_.shard_id_;
+}
+inline uint32_t response_msg_t::shard_id() const {
+  // @@protoc_insertion_point(field_get:response_msg_t.shard_id)
+  return _internal_shard_id();
+}
+inline void response_msg_t::_internal_set_shard_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.shard_id_ = value;
+}
+inline void response_msg_t::set_shard_id(uint32_t value) {
+  _internal_set_shard_id(value);
+  // @@protoc_insertion_point(field_set:response_msg_t.shard_id)
+}
+
+// -------------------------------------------------------------------
+
+// txn_msg_t
+
+// required uint32 sender_id = 1;
+inline bool txn_msg_t::_internal_has_sender_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool txn_msg_t::has_sender_id() const {
+  return _internal_has_sender_id();
+}
+inline void txn_msg_t::clear_sender_id() {
+  _impl_.sender_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t txn_msg_t::_internal_sender_id() const {
+  return _impl_.sender_id_;
+}
+inline uint32_t txn_msg_t::sender_id() const {
+  // @@protoc_insertion_point(field_get:txn_msg_t.sender_id)
+  return _internal_sender_id();
+}
+inline void txn_msg_t::_internal_set_sender_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sender_id_ = value;
+}
+inline void txn_msg_t::set_sender_id(uint32_t value) {
+  _internal_set_sender_id(value);
+  // @@protoc_insertion_point(field_set:txn_msg_t.sender_id)
+}
+
+// required uint32 recver_id = 2;
+inline bool txn_msg_t::_internal_has_recver_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool txn_msg_t::has_recver_id() const {
+  return _internal_has_recver_id();
+}
+inline void txn_msg_t::clear_recver_id() {
+  _impl_.recver_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t txn_msg_t::_internal_recver_id() const {
+  return _impl_.recver_id_;
+}
+inline uint32_t txn_msg_t::recver_id() const {
+  // @@protoc_insertion_point(field_get:txn_msg_t.recver_id)
+  return _internal_recver_id();
+}
+inline void txn_msg_t::_internal_set_recver_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.recver_id_ = value;
+}
+inline void txn_msg_t::set_recver_id(uint32_t value) {
+  _internal_set_recver_id(value);
+  // @@protoc_insertion_point(field_set:txn_msg_t.recver_id)
+}
+
+// required float amount = 3;
+inline bool txn_msg_t::_internal_has_amount() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool txn_msg_t::has_amount() const {
+  return _internal_has_amount();
+}
+inline void txn_msg_t::clear_amount() {
+  _impl_.amount_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float txn_msg_t::_internal_amount() const {
+  return _impl_.amount_;
+}
+inline float txn_msg_t::amount() const {
+  // @@protoc_insertion_point(field_get:txn_msg_t.amount)
+  return _internal_amount();
+}
+inline void txn_msg_t::_internal_set_amount(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.amount_ = value;
+}
+inline void txn_msg_t::set_amount(float value) {
+  _internal_set_amount(value);
+  // @@protoc_insertion_point(field_set:txn_msg_t.amount)
+}
+
+// optional bool bal_txn_flag = 4;
+inline bool txn_msg_t::_internal_has_bal_txn_flag() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool txn_msg_t::has_bal_txn_flag() const {
+  return _internal_has_bal_txn_flag();
+}
+inline void txn_msg_t::clear_bal_txn_flag() {
+  _impl_.bal_txn_flag_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool txn_msg_t::_internal_bal_txn_flag() const {
+  return _impl_.bal_txn_flag_;
+}
+inline bool txn_msg_t::bal_txn_flag() const {
+  // @@protoc_insertion_point(field_get:txn_msg_t.bal_txn_flag)
+  return _internal_bal_txn_flag();
+}
+inline void txn_msg_t::_internal_set_bal_txn_flag(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.bal_txn_flag_ = value;
+}
+inline void txn_msg_t::set_bal_txn_flag(bool value) {
+  _internal_set_bal_txn_flag(value);
+  // @@protoc_insertion_point(field_set:txn_msg_t.bal_txn_flag)
+}
+
+// optional bool config_txn_flag = 5;
+inline bool txn_msg_t::_internal_has_config_txn_flag() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool txn_msg_t::has_config_txn_flag() const {
+  return _internal_has_config_txn_flag();
+}
+inline void txn_msg_t::clear_config_txn_flag() {
+  _impl_.config_txn_flag_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool txn_msg_t::_internal_config_txn_flag() const {
+  return _impl_.config_txn_flag_;
+}
+inline bool txn_msg_t::config_txn_flag() const {
+  // @@protoc_insertion_point(field_get:txn_msg_t.config_txn_flag)
+  return _internal_config_txn_flag();
+}
+inline void txn_msg_t::_internal_set_config_txn_flag(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.config_txn_flag_ = value;
+}
+inline void txn_msg_t::set_config_txn_flag(bool value) {
+  _internal_set_config_txn_flag(value);
+  // @@protoc_insertion_point(field_set:txn_msg_t.config_txn_flag)
+}
+
+// optional uint64 voters = 6;
+inline bool txn_msg_t::_internal_has_voters() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool txn_msg_t::has_voters() const {
+  return _internal_has_voters();
+}
+inline void txn_msg_t::clear_voters() {
+  _impl_.voters_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t txn_msg_t::_internal_voters() const {
+  return _impl_.voters_;
+}
+inline uint64_t txn_msg_t::voters() const {
+  // @@protoc_insertion_point(field_get:txn_msg_t.voters)
+  return _internal_voters();
+}
+inline void txn_msg_t::_internal_set_voters(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.voters_ = value;
+}
+inline void txn_msg_t::set_voters(uint64_t value) {
+  _internal_set_voters(value);
+  // @@protoc_insertion_point(field_set:txn_msg_t.voters)
+}
+
+// optional uint32 xshard_phase = 7;
+inline bool txn_msg_t::_internal_has_xshard_phase() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool txn_msg_t::has_xshard_phase() const {
+  return _internal_has_xshard_phase();
+}
+inline void txn_msg_t::clear_xshard_phase() {
+  _impl_.xshard_phase_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t txn_msg_t::_internal_xshard_phase() const {
+  return _impl_.xshard_phase_;
+}
+inline uint32_t txn_msg_t::xshard_phase() const {
+  // @@protoc_insertion_point(field_get:txn_msg_t.xshard_phase)
+  return _internal_xshard_phase();
+}
+inline void txn_msg_t::_internal_set_xshard_phase(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.xshard_phase_ = value;
+}
+inline void txn_msg_t::set_xshard_phase(uint32_t value) {
+  _internal_set_xshard_phase(value);
+  // @@protoc_insertion_point(field_set:txn_msg_t.xshard_phase)
+}
+
+// optional uint64 xshard_txn_id = 8;
+inline bool txn_msg_t::_internal_has_xshard_txn_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool txn_msg_t::has_xshard_txn_id() const {
+  return _internal_has_xshard_txn_id();
+}
+inline void txn_msg_t::clear_xshard_txn_id() {
+  _impl_.xshard_txn_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t txn_msg_t::_internal_xshard_txn_id() const {
+  return _impl_.xshard_txn_id_;
+}
+inline uint64_t txn_msg_t::xshard_txn_id() const {
+  // @@protoc_insertion_point(field_get:txn_msg_t.xshard_txn_id)
+  return _internal_xshard_txn_id();
+}
+inline void txn_msg_t::_internal_set_xshard_txn_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.xshard_txn_id_ = value;
+}
+inline void txn_msg_t::set_xshard_txn_id(uint64_t value) {
+  _internal_set_xshard_txn_id(value);
+  // @@protoc_insertion_point(field_set:txn_msg_t.xshard_txn_id)
+}
+
+// -------------------------------------------------------------------
+
+// block_msg_t
+
+// required uint32 term = 1;
+inline bool block_msg_t::_internal_has_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool block_msg_t::has_term() const {
+  return _internal_has_term();
+}
+inline void block_msg_t::clear_term() {
+  _impl_.term_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t block_msg_t::_internal_term() const {
+  return _impl_.term_;
+}
+inline uint32_t block_msg_t::term() const {
+  // @@protoc_insertion_point(field_get:block_msg_t.term)
+  return _internal_term();
+}
+inline void block_msg_t::_internal_set_term(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.term_ = value;
+}
+inline void block_msg_t::set_term(uint32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:block_msg_t.term)
+}
+
+// required string phash = 2;
+inline bool block_msg_t::_internal_has_phash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool block_msg_t::has_phash() const {
+  return _internal_has_phash();
+}
+inline void block_msg_t::clear_phash() {
+  _impl_.phash_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& block_msg_t::phash() const {
+  // @@protoc_insertion_point(field_get:block_msg_t.phash)
+  return _internal_phash();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void block_msg_t::set_phash(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.phash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:block_msg_t.phash)
+}
+inline std::string* block_msg_t::mutable_phash() {
+  std::string* _s = _internal_mutable_phash();
+  // @@protoc_insertion_point(field_mutable:block_msg_t.phash)
+  return _s;
+}
+inline const std::string& block_msg_t::_internal_phash() const {
+  return _impl_.phash_.Get();
+}
+inline void block_msg_t::_internal_set_phash(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.phash_.Set(value, GetArenaForAllocation());
+}
+inline std::string* block_msg_t::_internal_mutable_phash() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.phash_.Mutable(GetArenaForAllocation());
+}
+inline std::string* block_msg_t::release_phash() {
+  // @@protoc_insertion_point(field_release:block_msg_t.phash)
+  if (!_internal_has_phash()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.phash_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.phash_.IsDefault()) {
+    _impl_.phash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void block_msg_t::set_allocated_phash(std::string* phash) {
+  if (phash != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.phash_.SetAllocated(phash, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.phash_.IsDefault()) {
+    _impl_.phash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:block_msg_t.phash)
+}
+
+// required string nonce = 3;
+inline bool block_msg_t::_internal_has_nonce() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool block_msg_t::has_nonce() const {
+  return _internal_has_nonce();
+}
+inline void block_msg_t::clear_nonce() {
+  _impl_.nonce_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& block_msg_t::nonce() const {
+  // @@protoc_insertion_point(field_get:block_msg_t.nonce)
+  return _internal_nonce();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void block_msg_t::set_nonce(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.nonce_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:block_msg_t.nonce)
+}
+inline std::string* block_msg_t::mutable_nonce() {
+  std::string* _s = _internal_mutable_nonce();
+  // @@protoc_insertion_point(field_mutable:block_msg_t.nonce)
+  return _s;
+}
+inline const std::string& block_msg_t::_internal_nonce() const {
+  return _impl_.nonce_.Get();
+}
+inline void block_msg_t::_internal_set_nonce(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.nonce_.Set(value, GetArenaForAllocation());
+}
+inline std::string* block_msg_t::_internal_mutable_nonce() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.nonce_.Mutable(GetArenaForAllocation());
+}
+inline std::string* block_msg_t::release_nonce() {
+  // @@protoc_insertion_point(field_release:block_msg_t.nonce)
+  if (!_internal_has_nonce()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.nonce_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nonce_.IsDefault()) {
+    _impl_.nonce_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void block_msg_t::set_allocated_nonce(std::string* nonce) {
+  if (nonce != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.nonce_.SetAllocated(nonce, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nonce_.IsDefault()) {
+    _impl_.nonce_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:block_msg_t.nonce)
+}
+
+// required .txn_msg_t txn = 4;
+inline bool block_msg_t::_internal_has_txn() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.txn_ != nullptr);
+  return value;
+}
+inline bool block_msg_t::has_txn() const {
+  return _internal_has_txn();
+}
+inline void block_msg_t::clear_txn() {
+  if (_impl_.txn_ != nullptr) _impl_.txn_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::txn_msg_t& block_msg_t::_internal_txn() const {
+  const ::txn_msg_t* p = _impl_.txn_;
+  return p != nullptr ? *p : reinterpret_cast<const ::txn_msg_t&>(
+      ::_txn_msg_t_default_instance_);
+}
+inline const ::txn_msg_t& block_msg_t::txn() const {
+  // @@protoc_insertion_point(field_get:block_msg_t.txn)
+  return _internal_txn();
+}
+inline void block_msg_t::unsafe_arena_set_allocated_txn(
+    ::txn_msg_t* txn) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.txn_);
+  }
+  _impl_.txn_ = txn;
+  if (txn) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:block_msg_t.txn)
+}
+inline ::txn_msg_t* block_msg_t::release_txn() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::txn_msg_t* temp = _impl_.txn_;
+  _impl_.txn_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::txn_msg_t* block_msg_t::unsafe_arena_release_txn() {
+  // @@protoc_insertion_point(field_release:block_msg_t.txn)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::txn_msg_t* temp = _impl_.txn_;
+  _impl_.txn_ = nullptr;
+  return temp;
+}
+inline ::txn_msg_t* block_msg_t::_internal_mutable_txn() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.txn_ == nullptr) {
+    auto* p = CreateMaybeMessage<::txn_msg_t>(GetArenaForAllocation());
+    _impl_.txn_ = p;
+  }
+  return _impl_.txn_;
+}
+inline ::txn_msg_t* block_msg_t::mutable_txn() {
+  ::txn_msg_t* _msg = _internal_mutable_txn();
+  // @@protoc_insertion_point(field_mutable:block_msg_t.txn)
+  return _msg;
+}
+inline void block_msg_t::set_allocated_txn(::txn_msg_t* txn) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.txn_;
+  }
+  if (txn) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(txn);
+    if (message_arena != submessage_arena) {
+      txn = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, txn, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.txn_ = txn;
+  // @@protoc_insertion_point(field_set_allocated:block_msg_t.txn)
+}
+
+// required int32 index = 5;
+inline bool block_msg_t::_internal_has_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool block_msg_t::has_index() const {
+  return _internal_has_index();
+}
+inline void block_msg_t::clear_index() {
+  _impl_.index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t block_msg_t::_internal_index() const {
+  return _impl_.index_;
+}
+inline int32_t block_msg_t::index() const {
+  // @@protoc_insertion_point(field_get:block_msg_t.index)
+  return _internal_index();
+}
+inline void block_msg_t::_internal_set_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.index_ = value;
+}
+inline void block_msg_t::set_index(int32_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:block_msg_t.index)
+}
+
+// -------------------------------------------------------------------
+
+// bc_msg_t
+
+// required int32 committed_index = 1;
+inline bool bc_msg_t::_internal_has_committed_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool bc_msg_t::has_committed_index() const {
+  return _internal_has_committed_index();
+}
+inline void bc_msg_t::clear_committed_index() {
+  _impl_.committed_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t bc_msg_t::_internal_committed_index() const {
+  return _impl_.committed_index_;
+}
+inline int32_t bc_msg_t::committed_index() const {
+  // @@protoc_insertion_point(field_get:bc_msg_t.committed_index)
+  return _internal_committed_index();
+}
+inline void bc_msg_t::_internal_set_committed_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.committed_index_ = value;
+}
+inline void bc_msg_t::set_committed_index(int32_t value) {
+  _internal_set_committed_index(value);
+  // @@protoc_insertion_point(field_set:bc_msg_t.committed_index)
+}
+
+// repeated .block_msg_t blocks = 3;
+inline int bc_msg_t::_internal_blocks_size() const {
+  return _impl_.blocks_.size();
+}
+inline int bc_msg_t::blocks_size() const {
+  return _internal_blocks_size();
+}
+inline void bc_msg_t::clear_blocks() {
+  _impl_.blocks_.Clear();
+}
+inline ::block_msg_t* bc_msg_t::mutable_blocks(int index) {
+  // @@protoc_insertion_point(field_mutable:bc_msg_t.blocks)
+  return _impl_.blocks_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::block_msg_t >*
+bc_msg_t::mutable_blocks() {
+  // @@protoc_insertion_point(field_mutable_list:bc_msg_t.blocks)
+  return &_impl_.blocks_;
+}
+inline const ::block_msg_t& bc_msg_t::_internal_blocks(int index) const {
+  return _impl_.blocks_.Get(index);
+}
+inline const ::block_msg_t& bc_msg_t::blocks(int index) const {
+  // @@protoc_insertion_point(field_get:bc_msg_t.blocks)
+  return _internal_blocks(index);
+}
+inline ::block_msg_t* bc_msg_t::_internal_add_blocks() {
+  return _impl_.blocks_.Add();
+}
+inline ::block_msg_t* bc_msg_t::add_blocks() {
+  ::block_msg_t* _add = _internal_add_blocks();
+  // @@protoc_insertion_point(field_add:bc_msg_t.blocks)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::block_msg_t >&
+bc_msg_t::blocks() const {
+  // @@protoc_insertion_point(field_list:bc_msg_t.blocks)
+  return _impl_.blocks_;
+}
+
+// -------------------------------------------------------------------
+
+// replica_msg_t
+
+// required uint32 type = 1;
+inline bool replica_msg_t::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool replica_msg_t::has_type() const {
+  return _internal_has_type();
+}
+inline void replica_msg_t::clear_type() {
+  _impl_.type_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t replica_msg_t::_internal_type() const {
+  return _impl_.type_;
+}
+inline uint32_t replica_msg_t::type() const {
+  // @@protoc_insertion_point(field_get:replica_msg_t.type)
+  return _internal_type();
+}
+inline void replica_msg_t::_internal_set_type(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.type_ = value;
+}
+inline void replica_msg_t::set_type(uint32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:replica_msg_t.type)
+}
+
+// optional uint32 receiver_id = 2;
+inline bool replica_msg_t::_internal_has_receiver_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool replica_msg_t::has_receiver_id() const {
+  return _internal_has_receiver_id();
+}
+inline void replica_msg_t::clear_receiver_id() {
+  _impl_.receiver_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t replica_msg_t::_internal_receiver_id() const {
+  return _impl_.receiver_id_;
+}
+inline uint32_t replica_msg_t::receiver_id() const {
+  // @@protoc_insertion_point(field_get:replica_msg_t.receiver_id)
+  return _internal_receiver_id();
+}
+inline void replica_msg_t::_internal_set_receiver_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.receiver_id_ = value;
+}
+inline void replica_msg_t::set_receiver_id(uint32_t value) {
+  _internal_set_receiver_id(value);
+  // @@protoc_insertion_point(field_set:replica_msg_t.receiver_id)
+}
+
+// optional .request_vote_rpc_msg_t request_vote_rpc_msg = 3;
+inline bool replica_msg_t::_internal_has_request_vote_rpc_msg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.request_vote_rpc_msg_ != nullptr);
+  return value;
+}
+inline bool replica_msg_t::has_request_vote_rpc_msg() const {
+  return _internal_has_request_vote_rpc_msg();
+}
+inline void replica_msg_t::clear_request_vote_rpc_msg() {
+  if (_impl_.request_vote_rpc_msg_ != nullptr) _impl_.request_vote_rpc_msg_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::request_vote_rpc_msg_t& replica_msg_t::_internal_request_vote_rpc_msg() const {
+  const ::request_vote_rpc_msg_t* p = _impl_.request_vote_rpc_msg_;
+  return p != nullptr ? *p : reinterpret_cast<const ::request_vote_rpc_msg_t&>(
+      ::_request_vote_rpc_msg_t_default_instance_);
+}
+inline const ::request_vote_rpc_msg_t& replica_msg_t::request_vote_rpc_msg() const {
+  // @@protoc_insertion_point(field_get:replica_msg_t.request_vote_rpc_msg)
+  return _internal_request_vote_rpc_msg();
+}
+inline void replica_msg_t::unsafe_arena_set_allocated_request_vote_rpc_msg(
+    ::request_vote_rpc_msg_t* request_vote_rpc_msg) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_vote_rpc_msg_);
+  }
+  _impl_.request_vote_rpc_msg_ = request_vote_rpc_msg;
+  if (request_vote_rpc_msg) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:replica_msg_t.request_vote_rpc_msg)
+}
+inline ::request_vote_rpc_msg_t* replica_msg_t::release_request_vote_rpc_msg() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::request_vote_rpc_msg_t* temp = _impl_.request_vote_rpc_msg_;
+  _impl_.request_vote_rpc_msg_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::request_vote_rpc_msg_t* replica_msg_t::unsafe_arena_release_request_vote_rpc_msg() {
+  // @@protoc_insertion_point(field_release:replica_msg_t.request_vote_rpc_msg)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::request_vote_rpc_msg_t* temp = _impl_.request_vote_rpc_msg_;
+  _impl_.request_vote_rpc_msg_ = nullptr;
+  return temp;
+}
+inline ::request_vote_rpc_msg_t* replica_msg_t::_internal_mutable_request_vote_rpc_msg() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.request_vote_rpc_msg_ == nullptr) {
+    auto* p = CreateMaybeMessage<::request_vote_rpc_msg_t>(GetArenaForAllocation());
+    _impl_.request_vote_rpc_msg_ = p;
+  }
+  return _impl_.request_vote_rpc_msg_;
+}
+inline ::request_vote_rpc_msg_t* replica_msg_t::mutable_request_vote_rpc_msg() {
+  ::request_vote_rpc_msg_t* _msg = _internal_mutable_request_vote_rpc_msg();
+  // @@protoc_insertion_point(field_mutable:replica_msg_t.request_vote_rpc_msg)
+  return _msg;
+}
+inline void replica_msg_t::set_allocated_request_vote_rpc_msg(::request_vote_rpc_msg_t* request_vote_rpc_msg) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.request_vote_rpc_msg_;
+  }
+  if (request_vote_rpc_msg) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request_vote_rpc_msg);
+    if (message_arena != submessage_arena) {
+      request_vote_rpc_msg = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request_vote_rpc_msg, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.request_vote_rpc_msg_ = request_vote_rpc_msg;
+  // @@protoc_insertion_point(field_set_allocated:replica_msg_t.request_vote_rpc_msg)
+}
+
+// optional .request_vote_reply_msg_t request_vote_reply_msg = 4;
+inline bool replica_msg_t::_internal_has_request_vote_reply_msg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.request_vote_reply_msg_ != nullptr);
+  return value;
+}
+inline bool replica_msg_t::has_request_vote_reply_msg() const {
+  return _internal_has_request_vote_reply_msg();
+}
+inline void replica_msg_t::clear_request_vote_reply_msg() {
+  if (_impl_.request_vote_reply_msg_ != nullptr) _impl_.request_vote_reply_msg_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::request_vote_reply_msg_t& replica_msg_t::_internal_request_vote_reply_msg() const {
+  const ::request_vote_reply_msg_t* p = _impl_.request_vote_reply_msg_;
+  return p != nullptr ? *p : reinterpret_cast<const ::request_vote_reply_msg_t&>(
+      ::_request_vote_reply_msg_t_default_instance_);
+}
+inline const ::request_vote_reply_msg_t& replica_msg_t::request_vote_reply_msg() const {
+  // @@protoc_insertion_point(field_get:replica_msg_t.request_vote_reply_msg)
+  return _internal_request_vote_reply_msg();
+}
+inline void replica_msg_t::unsafe_arena_set_allocated_request_vote_reply_msg(
+    ::request_vote_reply_msg_t* request_vote_reply_msg) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_vote_reply_msg_);
+  }
+  _impl_.request_vote_reply_msg_ = request_vote_reply_msg;
+  if (request_vote_reply_msg) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:replica_msg_t.request_vote_reply_msg)
+}
+inline ::request_vote_reply_msg_t* replica_msg_t::release_request_vote_reply_msg() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::request_vote_reply_msg_t* temp = _impl_.request_vote_reply_msg_;
+  _impl_.request_vote_reply_msg_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::request_vote_reply_msg_t* replica_msg_t::unsafe_arena_release_request_vote_reply_msg() {
+  // @@protoc_insertion_point(field_release:replica_msg_t.request_vote_reply_msg)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::request_vote_reply_msg_t* temp = _impl_.request_vote_reply_msg_;
+  _impl_.request_vote_reply_msg_ = nullptr;
+  return temp;
+}
+inline ::request_vote_reply_msg_t* replica_msg_t::_internal_mutable_request_vote_reply_msg() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.request_vote_reply_msg_ == nullptr) {
+    auto* p = CreateMaybeMessage<::request_vote_reply_msg_t>(GetArenaForAllocation());
+    _impl_.request_vote_reply_msg_ = p;
+  }
+  return _impl_.request_vote_reply_msg_;
+}
+inline ::request_vote_reply_msg_t* replica_msg_t::mutable_request_vote_reply_msg() {
+  ::request_vote_reply_msg_t* _msg = _internal_mutable_request_vote_reply_msg();
+  // @@protoc_insertion_point(field_mutable:replica_msg_t.request_vote_reply_msg)
+  return _msg;
+}
+inline void replica_msg_t::set_allocated_request_vote_reply_msg(::request_vote_reply_msg_t* request_vote_reply_msg) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.request_vote_reply_msg_;
+  }
+  if (request_vote_reply_msg) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request_vote_reply_msg);
+    if (message_arena != submessage_arena) {
+      request_vote_reply_msg = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request_vote_reply_msg, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.request_vote_reply_msg_ = request_vote_reply_msg;
+  // @@protoc_insertion_point(field_set_allocated:replica_msg_t.request_vote_reply_msg)
+}
+
+// optional .append_entry_rpc_msg_t append_entry_rpc_msg = 5;
+inline bool replica_msg_t::_internal_has_append_entry_rpc_msg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.append_entry_rpc_msg_ != nullptr);
+  return value;
+}
+inline bool replica_msg_t::has_append_entry_rpc_msg() const {
+  return _internal_has_append_entry_rpc_msg();
+}
+inline void replica_msg_t::clear_append_entry_rpc_msg() {
+  if (_impl_.append_entry_rpc_msg_ != nullptr) _impl_.append_entry_rpc_msg_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::append_entry_rpc_msg_t& replica_msg_t::_internal_append_entry_rpc_msg() const {
+  const ::append_entry_rpc_msg_t* p = _impl_.append_entry_rpc_msg_;
+  return p != nullptr ? *p : reinterpret_cast<const ::append_entry_rpc_msg_t&>(
+      ::_append_entry_rpc_msg_t_default_instance_);
+}
+inline const ::append_entry_rpc_msg_t& replica_msg_t::append_entry_rpc_msg() const {
+  // @@protoc_insertion_point(field_get:replica_msg_t.append_entry_rpc_msg)
+  return _internal_append_entry_rpc_msg();
+}
+inline void replica_msg_t::unsafe_arena_set_allocated_append_entry_rpc_msg(
+    ::append_entry_rpc_msg_t* append_entry_rpc_msg) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.append_entry_rpc_msg_);
+  }
+  _impl_.append_entry_rpc_msg_ = append_entry_rpc_msg;
+  if (append_entry_rpc_msg) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:replica_msg_t.append_entry_rpc_msg)
+}
+inline ::append_entry_rpc_msg_t* replica_msg_t::release_append_entry_rpc_msg() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::append_entry_rpc_msg_t* temp = _impl_.append_entry_rpc_msg_;
+  _impl_.append_entry_rpc_msg_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::append_entry_rpc_msg_t* replica_msg_t::unsafe_arena_release_append_entry_rpc_msg() {
+  // @@protoc_insertion_point(field_release:replica_msg_t.append_entry_rpc_msg)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::append_entry_rpc_msg_t* temp = _impl_.append_entry_rpc_msg_;
+  _impl_.append_entry_rpc_msg_ = nullptr;
+  return temp;
+}
+inline ::append_entry_rpc_msg_t* replica_msg_t::_internal_mutable_append_entry_rpc_msg() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.append_entry_rpc_msg_ == nullptr) {
+    auto* p = CreateMaybeMessage<::append_entry_rpc_msg_t>(GetArenaForAllocation());
+    _impl_.append_entry_rpc_msg_ = p;
+  }
+  return _impl_.append_entry_rpc_msg_;
+}
+inline ::append_entry_rpc_msg_t* replica_msg_t::mutable_append_entry_rpc_msg() {
+  ::append_entry_rpc_msg_t* _msg = _internal_mutable_append_entry_rpc_msg();
+  // @@protoc_insertion_point(field_mutable:replica_msg_t.append_entry_rpc_msg)
+  return _msg;
+}
+inline void replica_msg_t::set_allocated_append_entry_rpc_msg(::append_entry_rpc_msg_t* append_entry_rpc_msg) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.append_entry_rpc_msg_;
+  }
+  if (append_entry_rpc_msg) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(append_entry_rpc_msg);
+    if (message_arena != submessage_arena) {
+      append_entry_rpc_msg = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, append_entry_rpc_msg, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.append_entry_rpc_msg_ = append_entry_rpc_msg;
+  // @@protoc_insertion_point(field_set_allocated:replica_msg_t.append_entry_rpc_msg)
+}
+
+// optional .append_entry_reply_msg_t append_entry_reply_msg = 6;
+inline bool replica_msg_t::_internal_has_append_entry_reply_msg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.append_entry_reply_msg_ != nullptr);
+  return value;
+}
+inline bool replica_msg_t::has_append_entry_reply_msg() const {
+  return _internal_has_append_entry_reply_msg();
+}
+inline void replica_msg_t::clear_append_entry_reply_msg() {
+  if (_impl_.append_entry_reply_msg_ != nullptr) _impl_.append_entry_reply_msg_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::append_entry_reply_msg_t& replica_msg_t::_internal_append_entry_reply_msg() const {
+  const ::append_entry_reply_msg_t* p = _impl_.append_entry_reply_msg_;
+  return p != nullptr ? *p : reinterpret_cast<const ::append_entry_reply_msg_t&>(
+      ::_append_entry_reply_msg_t_default_instance_);
+}
+inline const ::append_entry_reply_msg_t& replica_msg_t::append_entry_reply_msg() const {
+  // @@protoc_insertion_point(field_get:replica_msg_t.append_entry_reply_msg)
+  return _internal_append_entry_reply_msg();
+}
+inline void replica_msg_t::unsafe_arena_set_allocated_append_entry_reply_msg(
+    ::append_entry_reply_msg_t* append_entry_reply_msg) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.append_entry_reply_msg_);
+  }
+  _impl_.append_entry_reply_msg_ = append_entry_reply_msg;
+  if (append_entry_reply_msg) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:replica_msg_t.append_entry_reply_msg)
+}
+inline ::append_entry_reply_msg_t* replica_msg_t::release_append_entry_reply_msg() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::append_entry_reply_msg_t* temp = _impl_.append_entry_reply_msg_;
+  _impl_.append_entry_reply_msg_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::append_entry_reply_msg_t* replica_msg_t::unsafe_arena_release_append_entry_reply_msg() {
+  // @@protoc_insertion_point(field_release:replica_msg_t.append_entry_reply_msg)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::append_entry_reply_msg_t* temp = _impl_.append_entry_reply_msg_;
+  _impl_.append_entry_reply_msg_ = nullptr;
+  return temp;
+}
+inline ::append_entry_reply_msg_t* replica_msg_t::_internal_mutable_append_entry_reply_msg() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.append_entry_reply_msg_ == nullptr) {
+    auto* p = CreateMaybeMessage<::append_entry_reply_msg_t>(GetArenaForAllocation());
+    _impl_.append_entry_reply_msg_ = p;
+  }
+  return _impl_.append_entry_reply_msg_;
+}
+inline ::append_entry_reply_msg_t* replica_msg_t::mutable_append_entry_reply_msg() {
+  ::append_entry_reply_msg_t* _msg = _internal_mutable_append_entry_reply_msg();
+  // @@protoc_insertion_point(field_mutable:replica_msg_t.append_entry_reply_msg)
+  return _msg;
+}
+inline void replica_msg_t::set_allocated_append_entry_reply_msg(::append_entry_reply_msg_t* append_entry_reply_msg) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.append_entry_reply_msg_;
+  }
+  if (append_entry_reply_msg) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(append_entry_reply_msg);
+    if (message_arena != submessage_arena) {
+      append_entry_reply_msg = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, append_entry_reply_msg, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.append_entry_reply_msg_ = append_entry_reply_msg;
+  // @@protoc_insertion_point(field_set_allocated:replica_msg_t.append_entry_reply_msg)
+}
+
+// optional .timeout_now_msg_t timeout_now_msg = 7;
+inline bool replica_msg_t::_internal_has_timeout_now_msg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.timeout_now_msg_ != nullptr);
+  return value;
+}
+inline bool replica_msg_t::has_timeout_now_msg() const {
+  return _internal_has_timeout_now_msg();
+}
+inline void replica_msg_t::clear_timeout_now_msg() {
+  if (_impl_.timeout_now_msg_ != nullptr) _impl_.timeout_now_msg_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::timeout_now_msg_t& replica_msg_t::_internal_timeout_now_msg() const {
+  const ::timeout_now_msg_t* p = _impl_.timeout_now_msg_;
+  return p != nullptr ? *p : reinterpret_cast<const ::timeout_now_msg_t&>(
+      ::_timeout_now_msg_t_default_instance_);
+}
+inline const ::timeout_now_msg_t& replica_msg_t::timeout_now_msg() const {
+  // @@protoc_insertion_point(field_get:replica_msg_t.timeout_now_msg)
+  return _internal_timeout_now_msg();
+}
+inline void replica_msg_t::unsafe_arena_set_allocated_timeout_now_msg(
+    ::timeout_now_msg_t* timeout_now_msg) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.timeout_now_msg_);
+  }
+  _impl_.timeout_now_msg_ = timeout_now_msg;
+  if (timeout_now_msg) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:replica_msg_t.timeout_now_msg)
+}
+inline ::timeout_now_msg_t* replica_msg_t::release_timeout_now_msg() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::timeout_now_msg_t* temp = _impl_.timeout_now_msg_;
+  _impl_.timeout_now_msg_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::timeout_now_msg_t* replica_msg_t::unsafe_arena_release_timeout_now_msg() {
+  // @@protoc_insertion_point(field_release:replica_msg_t.timeout_now_msg)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::timeout_now_msg_t* temp = _impl_.timeout_now_msg_;
+  _impl_.timeout_now_msg_ = nullptr;
+  return temp;
+}
+inline ::timeout_now_msg_t* replica_msg_t::_internal_mutable_timeout_now_msg() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.timeout_now_msg_ == nullptr) {
+    auto* p = CreateMaybeMessage<::timeout_now_msg_t>(GetArenaForAllocation());
+    _impl_.timeout_now_msg_ = p;
+  }
+  return _impl_.timeout_now_msg_;
+}
+inline ::timeout_now_msg_t* replica_msg_t::mutable_timeout_now_msg() {
+  ::timeout_now_msg_t* _msg = _internal_mutable_timeout_now_msg();
+  // @@protoc_insertion_point(field_mutable:replica_msg_t.timeout_now_msg)
+  return _msg;
+}
+inline void replica_msg_t::set_allocated_timeout_now_msg(::timeout_now_msg_t* timeout_now_msg) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.timeout_now_msg_;
+  }
+  if (timeout_now_msg) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(timeout_now_msg);
+    if (message_arena != submessage_arena) {
+      timeout_now_msg = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timeout_now_msg, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.timeout_now_msg_ = timeout_now_msg;
+  // @@protoc_insertion_point(field_set_allocated:replica_msg_t.timeout_now_msg)
+}
+
+// optional uint32 shard_id = 8;
+inline bool replica_msg_t::_internal_has_shard_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool replica_msg_t::has_shard_id() const {
+  return _internal_has_shard_id();
+}
+inline void replica_msg_t::clear_shard_id() {
+  _impl_.shard_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t replica_msg_t::_internal_shard_id() const {
+  return _impl_.shard_id_;
+}
+inline uint32_t replica_msg_t::shard_id() const {
+  // @@protoc_insertion_point(field_get:replica_msg_t.shard_id)
+  return _internal_shard_id();
+}
+inline void replica_msg_t::_internal_set_shard_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.shard_id_ = value;
+}
+inline void replica_msg_t::set_shard_id(uint32_t value) {
+  _internal_set_shard_id(value);
+  // @@protoc_insertion_point(field_set:replica_msg_t.shard_id)
+}
+
+// optional .xshard_msg_t xshard_msg = 9;
+inline bool replica_msg_t::_internal_has_xshard_msg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.xshard_msg_ != nullptr);
+  return value;
+}
+inline bool replica_msg_t::has_xshard_msg() const {
+  return _internal_has_xshard_msg();
+}
+inline void replica_msg_t::clear_xshard_msg() {
+  if (_impl_.xshard_msg_ != nullptr) _impl_.xshard_msg_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::xshard_msg_t& replica_msg_t::_internal_xshard_msg() const {
+  const ::xshard_msg_t* p = _impl_.xshard_msg_;
+  return p != nullptr ? *p : reinterpret_cast<const ::xshard_msg_t&>(
+      ::_xshard_msg_t_default_instance_);
+}
+inline const ::xshard_msg_t& replica_msg_t::xshard_msg() const {
+  // @@protoc_insertion_point(field_get:replica_msg_t.xshard_msg)
+  return _internal_xshard_msg();
+}
+inline void replica_msg_t::unsafe_arena_set_allocated_xshard_msg(
+    ::xshard_msg_t* xshard_msg) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.xshard_msg_);
+  }
+  _impl_.xshard_msg_ = xshard_msg;
+  if (xshard_msg) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:replica_msg_t.xshard_msg)
+}
+inline ::xshard_msg_t* replica_msg_t::release_xshard_msg() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::xshard_msg_t* temp = _impl_.xshard_msg_;
+  _impl_.xshard_msg_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::xshard_msg_t* replica_msg_t::unsafe_arena_release_xshard_msg() {
+  // @@protoc_insertion_point(field_release:replica_msg_t.xshard_msg)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::xshard_msg_t* temp = _impl_.xshard_msg_;
+  _impl_.xshard_msg_ = nullptr;
+  return temp;
+}
+inline ::xshard_msg_t* replica_msg_t::_internal_mutable_xshard_msg() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.xshard_msg_ == nullptr) {
+    auto* p = CreateMaybeMessage<::xshard_msg_t>(GetArenaForAllocation());
+    _impl_.xshard_msg_ = p;
+  }
+  return _impl_.xshard_msg_;
+}
+inline ::xshard_msg_t* replica_msg_t::mutable_xshard_msg() {
+  ::xshard_msg_t* _msg = _internal_mutable_xshard_msg();
+  // @@protoc_insertion_point(field_mutable:replica_msg_t.xshard_msg)
+  return _msg;
+}
+inline void replica_msg_t::set_allocated_xshard_msg(::xshard_msg_t* xshard_msg) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.xshard_msg_;
+  }
+  if (xshard_msg) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(xshard_msg);
+    if (message_arena != submessage_arena) {
+      xshard_msg = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, xshard_msg, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.xshard_msg_ = xshard_msg;
+  // @@protoc_insertion_point(field_set_allocated:replica_msg_t.xshard_msg)
+}
+
+// -------------------------------------------------------------------
+
+// request_vote_rpc_msg_t
+
+// required uint32 candidate_id = 1;
+inline bool request_vote_rpc_msg_t::_internal_has_candidate_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool request_vote_rpc_msg_t::has_candidate_id() const {
+  return _internal_has_candidate_id();
+}
+inline void request_vote_rpc_msg_t::clear_candidate_id() {
+  _impl_.candidate_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t request_vote_rpc_msg_t::_internal_candidate_id() const {
+  return _impl_.candidate_id_;
+}
+inline uint32_t request_vote_rpc_msg_t::candidate_id() const {
+  // @@protoc_insertion_point(field_get:request_vote_rpc_msg_t.candidate_id)
+  return _internal_candidate_id();
+}
+inline void request_vote_rpc_msg_t::_internal_set_candidate_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.candidate_id_ = value;
+}
+inline void request_vote_rpc_msg_t::set_candidate_id(uint32_t value) {
+  _internal_set_candidate_id(value);
+  // @@protoc_insertion_point(field_set:request_vote_rpc_msg_t.candidate_id)
+}
+
+// required uint32 term = 2;
+inline bool request_vote_rpc_msg_t::_internal_has_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool request_vote_rpc_msg_t::has_term() const {
+  return _internal_has_term();
+}
+inline void request_vote_rpc_msg_t::clear_term() {
+  _impl_.term_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t request_vote_rpc_msg_t::_internal_term() const {
+  return _impl_.term_;
+}
+inline uint32_t request_vote_rpc_msg_t::term() const {
+  // @@protoc_insertion_point(field_get:request_vote_rpc_msg_t.term)
+  return _internal_term();
+}
+inline void request_vote_rpc_msg_t::_internal_set_term(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.term_ = value;
+}
+inline void request_vote_rpc_msg_t::set_term(uint32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:request_vote_rpc_msg_t.term)
+}
+
+// required uint32 last_log_term = 3;
+inline bool request_vote_rpc_msg_t::_internal_has_last_log_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool request_vote_rpc_msg_t::has_last_log_term() const {
+  return _internal_has_last_log_term();
+}
+inline void request_vote_rpc_msg_t::clear_last_log_term() {
+  _impl_.last_log_term_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t request_vote_rpc_msg_t::_internal_last_log_term() const {
+  return _impl_.last_log_term_;
+}
+inline uint32_t request_vote_rpc_msg_t::last_log_term() const {
+  // @@protoc_insertion_point(field_get:request_vote_rpc_msg_t.last_log_term)
+  return _internal_last_log_term();
+}
+inline void request_vote_rpc_msg_t::_internal_set_last_log_term(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.last_log_term_ = value;
+}
+inline void request_vote_rpc_msg_t::set_last_log_term(uint32_t value) {
+  _internal_set_last_log_term(value);
+  // @@protoc_insertion_point(field_set:request_vote_rpc_msg_t.last_log_term)
+}
+
+// required int32 last_log_index = 4;
+inline bool request_vote_rpc_msg_t::_internal_has_last_log_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool request_vote_rpc_msg_t::has_last_log_index() const {
+  return _internal_has_last_log_index();
+}
+inline void request_vote_rpc_msg_t::clear_last_log_index() {
+  _impl_.last_log_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t request_vote_rpc_msg_t::_internal_last_log_index() const {
+  return _impl_.last_log_index_;
+}
+inline int32_t request_vote_rpc_msg_t::last_log_index() const {
+  // @@protoc_insertion_point(field_get:request_vote_rpc_msg_t.last_log_index)
+  return _internal_last_log_index();
+}
+inline void request_vote_rpc_msg_t::_internal_set_last_log_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.last_log_index_ = value;
+}
+inline void request_vote_rpc_msg_t::set_last_log_index(int32_t value) {
+  _internal_set_last_log_index(value);
+  // @@protoc_insertion_point(field_set:request_vote_rpc_msg_t.last_log_index)
+}
+
+// optional bool leadership_transfer = 5;
+inline bool request_vote_rpc_msg_t::_internal_has_leadership_transfer() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool request_vote_rpc_msg_t::has_leadership_transfer() const {
+  return _internal_has_leadership_transfer();
+}
+inline void request_vote_rpc_msg_t::clear_leadership_transfer() {
+  _impl_.leadership_transfer_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool request_vote_rpc_msg_t::_internal_leadership_transfer() const {
+  return _impl_.leadership_transfer_;
+}
+inline bool request_vote_rpc_msg_t::leadership_transfer() const {
+  // @@protoc_insertion_point(field_get:request_vote_rpc_msg_t.leadership_transfer)
+  return _internal_leadership_transfer();
+}
+inline void request_vote_rpc_msg_t::_internal_set_leadership_transfer(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.leadership_transfer_ = value;
+}
+inline void request_vote_rpc_msg_t::set_leadership_transfer(bool value) {
+  _internal_set_leadership_transfer(value);
+  // @@protoc_insertion_point(field_set:request_vote_rpc_msg_t.leadership_transfer)
+}
+
+// -------------------------------------------------------------------
+
+// request_vote_reply_msg_t
+
+// required uint32 term = 1;
+inline bool request_vote_reply_msg_t::_internal_has_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool request_vote_reply_msg_t::has_term() const {
+  return _internal_has_term();
+}
+inline void request_vote_reply_msg_t::clear_term() {
+  _impl_.term_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t request_vote_reply_msg_t::_internal_term() const {
+  return _impl_.term_;
+}
+inline uint32_t request_vote_reply_msg_t::term() const {
+  // @@protoc_insertion_point(field_get:request_vote_reply_msg_t.term)
+  return _internal_term();
+}
+inline void request_vote_reply_msg_t::_internal_set_term(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.term_ = value;
+}
+inline void request_vote_reply_msg_t::set_term(uint32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:request_vote_reply_msg_t.term)
+}
+
+// required bool vote_granted = 2;
+inline bool request_vote_reply_msg_t::_internal_has_vote_granted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool request_vote_reply_msg_t::has_vote_granted() const {
+  return _internal_has_vote_granted();
+}
+inline void request_vote_reply_msg_t::clear_vote_granted() {
+  _impl_.vote_granted_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool request_vote_reply_msg_t::_internal_vote_granted() const {
+  return _impl_.vote_granted_;
+}
+inline bool request_vote_reply_msg_t::vote_granted() const {
+  // @@protoc_insertion_point(field_get:request_vote_reply_msg_t.vote_granted)
+  return _internal_vote_granted();
+}
+inline void request_vote_reply_msg_t::_internal_set_vote_granted(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.vote_granted_ = value;
+}
+inline void request_vote_reply_msg_t::set_vote_granted(bool value) {
+  _internal_set_vote_granted(value);
+  // @@protoc_insertion_point(field_set:request_vote_reply_msg_t.vote_granted)
+}
+
+// optional uint32 sender_id = 3;
+inline bool request_vote_reply_msg_t::_internal_has_sender_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool request_vote_reply_msg_t::has_sender_id() const {
+  return _internal_has_sender_id();
+}
+inline void request_vote_reply_msg_t::clear_sender_id() {
+  _impl_.sender_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t request_vote_reply_msg_t::_internal_sender_id() const {
+  return _impl_.sender_id_;
+}
+inline uint32_t request_vote_reply_msg_t::sender_id() const {
+  // @@protoc_insertion_point(field_get:request_vote_reply_msg_t.sender_id)
+  return _internal_sender_id();
+}
+inline void request_vote_reply_msg_t::_internal_set_sender_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.sender_id_ = value;
+}
+inline void request_vote_reply_msg_t::set_sender_id(uint32_t value) {
+  _internal_set_sender_id(value);
+  // @@protoc_insertion_point(field_set:request_vote_reply_msg_t.sender_id)
+}
+
+// -------------------------------------------------------------------
+
+// append_entry_rpc_msg_t
+
+// required uint32 term = 1;
+inline bool append_entry_rpc_msg_t::_internal_has_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool append_entry_rpc_msg_t::has_term() const {
+  return _internal_has_term();
+}
+inline void append_entry_rpc_msg_t::clear_term() {
+  _impl_.term_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t append_entry_rpc_msg_t::_internal_term() const {
+  return _impl_.term_;
+}
+inline uint32_t append_entry_rpc_msg_t::term() const {
+  // @@protoc_insertion_point(field_get:append_entry_rpc_msg_t.term)
+  return _internal_term();
+}
+inline void append_entry_rpc_msg_t::_internal_set_term(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.term_ = value;
+}
+inline void append_entry_rpc_msg_t::set_term(uint32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:append_entry_rpc_msg_t.term)
+}
+
+// required uint32 leader_id = 2;
+inline bool append_entry_rpc_msg_t::_internal_has_leader_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool append_entry_rpc_msg_t::has_leader_id() const {
+  return _internal_has_leader_id();
+}
+inline void append_entry_rpc_msg_t::clear_leader_id() {
+  _impl_.leader_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t append_entry_rpc_msg_t::_internal_leader_id() const {
+  return _impl_.leader_id_;
+}
+inline uint32_t append_entry_rpc_msg_t::leader_id() const {
+  // @@protoc_insertion_point(field_get:append_entry_rpc_msg_t.leader_id)
+  return _internal_leader_id();
+}
+inline void append_entry_rpc_msg_t::_internal_set_leader_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.leader_id_ = value;
+}
+inline void append_entry_rpc_msg_t::set_leader_id(uint32_t value) {
+  _internal_set_leader_id(value);
+  // @@protoc_insertion_point(field_set:append_entry_rpc_msg_t.leader_id)
+}
+
+// required uint32 prev_log_term = 3;
+inline bool append_entry_rpc_msg_t::_internal_has_prev_log_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool append_entry_rpc_msg_t::has_prev_log_term() const {
+  return _internal_has_prev_log_term();
+}
+inline void append_entry_rpc_msg_t::clear_prev_log_term() {
+  _impl_.prev_log_term_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t append_entry_rpc_msg_t::_internal_prev_log_term() const {
+  return _impl_.prev_log_term_;
+}
+inline uint32_t append_entry_rpc_msg_t::prev_log_term() const {
+  // @@protoc_insertion_point(field_get:append_entry_rpc_msg_t.prev_log_term)
+  return _internal_prev_log_term();
+}
+inline void append_entry_rpc_msg_t::_internal_set_prev_log_term(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.prev_log_term_ = value;
+}
+inline void append_entry_rpc_msg_t::set_prev_log_term(uint32_t value) {
+  _internal_set_prev_log_term(value);
+  // @@protoc_insertion_point(field_set:append_entry_rpc_msg_t.prev_log_term)
+}
+
+// required int32 prev_log_index = 4;
+inline bool append_entry_rpc_msg_t::_internal_has_prev_log_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool append_entry_rpc_msg_t::has_prev_log_index() const {
+  return _internal_has_prev_log_index();
+}
+inline void append_entry_rpc_msg_t::clear_prev_log_index() {
+  _impl_.prev_log_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t append_entry_rpc_msg_t::_internal_prev_log_index() const {
+  return _impl_.prev_log_index_;
+}
+inline int32_t append_entry_rpc_msg_t::prev_log_index() const {
+  // @@protoc_insertion_point(field_get:append_entry_rpc_msg_t.prev_log_index)
+  return _internal_prev_log_index();
+}
+inline void append_entry_rpc_msg_t::_internal_set_prev_log_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.prev_log_index_ = value;
+}
+inline void append_entry_rpc_msg_t::set_prev_log_index(int32_t value) {
+  _internal_set_prev_log_index(value);
+  // @@protoc_insertion_point(field_set:append_entry_rpc_msg_t.prev_log_index)
+}
+
+// required int32 commit_index = 5;
+inline bool append_entry_rpc_msg_t::_internal_has_commit_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool append_entry_rpc_msg_t::has_commit_index() const {
+  return _internal_has_commit_index();
+}
+inline void append_entry_rpc_msg_t::clear_commit_index() {
+  _impl_.commit_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t append_entry_rpc_msg_t::_internal_commit_index() const {
+  return _impl_.commit_index_;
+}
+inline int32_t append_entry_rpc_msg_t::commit_index() const {
+  // @@protoc_insertion_point(field_get:append_entry_rpc_msg_t.commit_index)
+  return _internal_commit_index();
+}
+inline void append_entry_rpc_msg_t::_internal_set_commit_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.commit_index_ = value;
+}
+inline void append_entry_rpc_msg_t::set_commit_index(int32_t value) {
+  _internal_set_commit_index(value);
+  // @@protoc_insertion_point(field_set:append_entry_rpc_msg_t.commit_index)
+}
+
+// repeated bytes entries = 6;
+inline int append_entry_rpc_msg_t::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int append_entry_rpc_msg_t::entries_size() const {
+  return _internal_entries_size();
+}
+inline void append_entry_rpc_msg_t::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline std::string* append_entry_rpc_msg_t::add_entries() {
+  std::string* _s = _internal_add_entries();
+  // @@protoc_insertion_point(field_add_mutable:append_entry_rpc_msg_t.entries)
+  return _s;
+}
+inline const std::string& append_entry_rpc_msg_t::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const std::string& append_entry_rpc_msg_t::entries(int index) const {
+  // @@protoc_insertion_point(field_get:append_entry_rpc_msg_t.entries)
+  return _internal_entries(index);
+}
+inline std::string* append_entry_rpc_msg_t::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:append_entry_rpc_msg_t.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline void append_entry_rpc_msg_t::set_entries(int index, const std::string& value) {
+  _impl_.entries_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:append_entry_rpc_msg_t.entries)
+}
+inline void append_entry_rpc_msg_t::set_entries(int index, std::string&& value) {
+  _impl_.entries_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:append_entry_rpc_msg_t.entries)
+}
+inline void append_entry_rpc_msg_t::set_entries(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.entries_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:append_entry_rpc_msg_t.entries)
+}
+inline void append_entry_rpc_msg_t::set_entries(int index, const void* value, size_t size) {
+  _impl_.entries_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:append_entry_rpc_msg_t.entries)
+}
+inline std::string* append_entry_rpc_msg_t::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline void append_entry_rpc_msg_t::add_entries(const std::string& value) {
+  _impl_.entries_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:append_entry_rpc_msg_t.entries)
+}
+inline void append_entry_rpc_msg_t::add_entries(std::string&& value) {
+  _impl_.entries_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:append_entry_rpc_msg_t.entries)
+}
+inline void append_entry_rpc_msg_t::add_entries(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.entries_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:append_entry_rpc_msg_t.entries)
+}
+inline void append_entry_rpc_msg_t::add_entries(const void* value, size_t size) {
+  _impl_.entries_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:append_entry_rpc_msg_t.entries)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+append_entry_rpc_msg_t::entries() const {
+  // @@protoc_insertion_point(field_list:append_entry_rpc_msg_t.entries)
+  return _impl_.entries_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+append_entry_rpc_msg_t::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:append_entry_rpc_msg_t.entries)
+  return &_impl_.entries_;
+}
+
+// -------------------------------------------------------------------
+
+// append_entry_reply_msg_t
+
+// required uint32 term = 1;
+inline bool append_entry_reply_msg_t::_internal_has_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool append_entry_reply_msg_t::has_term() const {
+  return _internal_has_term();
+}
+inline void append_entry_reply_msg_t::clear_term() {
+  _impl_.term_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t append_entry_reply_msg_t::_internal_term() const {
+  return _impl_.term_;
+}
+inline uint32_t append_entry_reply_msg_t::term() const {
+  // @@protoc_insertion_point(field_get:append_entry_reply_msg_t.term)
+  return _internal_term();
+}
+inline void append_entry_reply_msg_t::_internal_set_term(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.term_ = value;
+}
+inline void append_entry_reply_msg_t::set_term(uint32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:append_entry_reply_msg_t.term)
+}
+
+// required uint32 sender_id = 2;
+inline bool append_entry_reply_msg_t::_internal_has_sender_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool append_entry_reply_msg_t::has_sender_id() const {
+  return _internal_has_sender_id();
+}
+inline void append_entry_reply_msg_t::clear_sender_id() {
+  _impl_.sender_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t append_entry_reply_msg_t::_internal_sender_id() const {
+  return _impl_.sender_id_;
+}
+inline uint32_t append_entry_reply_msg_t::sender_id() const {
+  // @@protoc_insertion_point(field_get:append_entry_reply_msg_t.sender_id)
+  return _internal_sender_id();
+}
+inline void append_entry_reply_msg_t::_internal_set_sender_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.sender_id_ = value;
+}
+inline void append_entry_reply_msg_t::set_sender_id(uint32_t value) {
+  _internal_set_sender_id(value);
+  // @@protoc_insertion_point(field_set:append_entry_reply_msg_t.sender_id)
+}
+
+// required bool success = 3;
+inline bool append_entry_reply_msg_t::_internal_has_success() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool append_entry_reply_msg_t::has_success() const {
+  return _internal_has_success();
+}
+inline void append_entry_reply_msg_t::clear_success() {
+  _impl_.success_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool append_entry_reply_msg_t::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool append_entry_reply_msg_t::success() const {
+  // @@protoc_insertion_point(field_get:append_entry_reply_msg_t.success)
+  return _internal_success();
+}
+inline void append_entry_reply_msg_t::_internal_set_success(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.success_ = value;
+}
+inline void append_entry_reply_msg_t::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:append_entry_reply_msg_t.success)
+}
+
+// required bool reply_heartbeat = 4;
+inline bool append_entry_reply_msg_t::_internal_has_reply_heartbeat() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool append_entry_reply_msg_t::has_reply_heartbeat() const {
+  return _internal_has_reply_heartbeat();
+}
+inline void append_entry_reply_msg_t::clear_reply_heartbeat() {
+  _impl_.reply_heartbeat_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool append_entry_reply_msg_t::_internal_reply_heartbeat() const {
+  return _impl_.reply_heartbeat_;
+}
+inline bool append_entry_reply_msg_t::reply_heartbeat() const {
+  // @@protoc_insertion_point(field_get:append_entry_reply_msg_t.reply_heartbeat)
+  return _internal_reply_heartbeat();
+}
+inline void append_entry_reply_msg_t::_internal_set_reply_heartbeat(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.reply_heartbeat_ = value;
+}
+inline void append_entry_reply_msg_t::set_reply_heartbeat(bool value) {
+  _internal_set_reply_heartbeat(value);
+  // @@protoc_insertion_point(field_set:append_entry_reply_msg_t.reply_heartbeat)
+}
+
+// optional int32 match_index = 5;
+inline bool append_entry_reply_msg_t::_internal_has_match_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool append_entry_reply_msg_t::has_match_index() const {
+  return _internal_has_match_index();
+}
+inline void append_entry_reply_msg_t::clear_match_index() {
+  _impl_.match_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t append_entry_reply_msg_t::_internal_match_index() const {
+  return _impl_.match_index_;
+}
+inline int32_t append_entry_reply_msg_t::match_index() const {
+  // @@protoc_insertion_point(field_get:append_entry_reply_msg_t.match_index)
+  return _internal_match_index();
+}
+inline void append_entry_reply_msg_t::_internal_set_match_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.match_index_ = value;
+}
+inline void append_entry_reply_msg_t::set_match_index(int32_t value) {
+  _internal_set_match_index(value);
+  // @@protoc_insertion_point(field_set:append_entry_reply_msg_t.match_index)
+}
+
+// optional int32 commit_index = 6 [default = -1];
+inline bool append_entry_reply_msg_t::_internal_has_commit_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool append_entry_reply_msg_t::has_commit_index() const {
+  return _internal_has_commit_index();
+}
+inline void append_entry_reply_msg_t::clear_commit_index() {
+  _impl_.commit_index_ = -1;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t append_entry_reply_msg_t::_internal_commit_index() const {
+  return _impl_.commit_index_;
+}
+inline int32_t append_entry_reply_msg_t::commit_index() const {
+  // @@protoc_insertion_point(field_get:append_entry_reply_msg_t.commit_index)
+  return _internal_commit_index();
+}
+inline void append_entry_reply_msg_t::_internal_set_commit_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.commit_index_ = value;
+}
+inline void append_entry_reply_msg_t::set_commit_index(int32_t value) {
+  _internal_set_commit_index(value);
+  // @@protoc_insertion_point(field_set:append_entry_reply_msg_t.commit_index)
+}
+
+// -------------------------------------------------------------------
+
+// timeout_now_msg_t
+
+// required uint32 term = 1;
+inline bool timeout_now_msg_t::_internal_has_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool timeout_now_msg_t::has_term() const {
+  return _internal_has_term();
+}
+inline void timeout_now_msg_t::clear_term() {
+  _impl_.term_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t timeout_now_msg_t::_internal_term() const {
+  return _impl_.term_;
+}
+inline uint32_t timeout_now_msg_t::term() const {
+  // @@protoc_insertion_point(field_get:timeout_now_msg_t.term)
+  return _internal_term();
+}
+inline void timeout_now_msg_t::_internal_set_term(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.term_ = value;
+}
+inline void timeout_now_msg_t::set_term(uint32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:timeout_now_msg_t.term)
+}
+
+// required uint32 leader_id = 2;
+inline bool timeout_now_msg_t::_internal_has_leader_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool timeout_now_msg_t::has_leader_id() const {
+  return _internal_has_leader_id();
+}
+inline void timeout_now_msg_t::clear_leader_id() {
+  _impl_.leader_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t timeout_now_msg_t::_internal_leader_id() const {
+  return _impl_.leader_id_;
+}
+inline uint32_t timeout_now_msg_t::leader_id() const {
+  // @@protoc_insertion_point(field_get:timeout_now_msg_t.leader_id)
+  return _internal_leader_id();
+}
+inline void timeout_now_msg_t::_internal_set_leader_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.leader_id_ = value;
+}
+inline void timeout_now_msg_t::set_leader_id(uint32_t value) {
+  _internal_set_leader_id(value);
+  // @@protoc_insertion_point(field_set:timeout_now_msg_t.leader_id)
+}
+
+// -------------------------------------------------------------------
+
+// xshard_msg_t
+
+// required uint64 txn_id = 1;
+inline bool xshard_msg_t::_internal_has_txn_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool xshard_msg_t::has_txn_id() const {
+  return _internal_has_txn_id();
+}
+inline void xshard_msg_t::clear_txn_id() {
+  _impl_.txn_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t xshard_msg_t::_internal_txn_id() const {
+  return _impl_.txn_id_;
+}
+inline uint64_t xshard_msg_t::txn_id() const {
+  // @@protoc_insertion_point(field_get:xshard_msg_t.txn_id)
+  return _internal_txn_id();
+}
+inline void xshard_msg_t::_internal_set_txn_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.txn_id_ = value;
+}
+inline void xshard_msg_t::set_txn_id(uint64_t value) {
+  _internal_set_txn_id(value);
+  // @@protoc_insertion_point(field_set:xshard_msg_t.txn_id)
+}
+
+// required uint32 from_shard = 2;
+inline bool xshard_msg_t::_internal_has_from_shard() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool xshard_msg_t::has_from_shard() const {
+  return _internal_has_from_shard();
+}
+inline void xshard_msg_t::clear_from_shard() {
+  _impl_.from_shard_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t xshard_msg_t::_internal_from_shard() const {
+  return _impl_.from_shard_;
+}
+inline uint32_t xshard_msg_t::from_shard() const {
+  // @@protoc_insertion_point(field_get:xshard_msg_t.from_shard)
+  return _internal_from_shard();
+}
+inline void xshard_msg_t::_internal_set_from_shard(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.from_shard_ = value;
+}
+inline void xshard_msg_t::set_from_shard(uint32_t value) {
+  _internal_set_from_shard(value);
+  // @@protoc_insertion_point(field_set:xshard_msg_t.from_shard)
+}
+
+// optional uint32 sender_id = 3;
+inline bool xshard_msg_t::_internal_has_sender_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool xshard_msg_t::has_sender_id() const {
+  return _internal_has_sender_id();
+}
+inline void xshard_msg_t::clear_sender_id() {
+  _impl_.sender_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t xshard_msg_t::_internal_sender_id() const {
+  return _impl_.sender_id_;
+}
+inline uint32_t xshard_msg_t::sender_id() const {
+  // @@protoc_insertion_point(field_get:xshard_msg_t.sender_id)
+  return _internal_sender_id();
+}
+inline void xshard_msg_t::_internal_set_sender_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.sender_id_ = value;
+}
+inline void xshard_msg_t::set_sender_id(uint32_t value) {
+  _internal_set_sender_id(value);
+  // @@protoc_insertion_point(field_set:xshard_msg_t.sender_id)
+}
+
+// optional uint32 recver_id = 4;
+inline bool xshard_msg_t::_internal_has_recver_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool xshard_msg_t::has_recver_id() const {
+  return _internal_has_recver_id();
+}
+inline void xshard_msg_t::clear_recver_id() {
+  _impl_.recver_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t xshard_msg_t::_internal_recver_id() const {
+  return _impl_.recver_id_;
+}
+inline uint32_t xshard_msg_t::recver_id() const {
+  // @@protoc_insertion_point(field_get:xshard_msg_t.recver_id)
+  return _internal_recver_id();
+}
+inline void xshard_msg_t::_internal_set_recver_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.recver_id_ = value;
+}
+inline void xshard_msg_t::set_recver_id(uint32_t value) {
+  _internal_set_recver_id(value);
+  // @@protoc_insertion_point(field_set:xshard_msg_t.recver_id)
+}
+
+// optional float amount = 5;
+inline bool xshard_msg_t::_internal_has_amount() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool xshard_msg_t::has_amount() const {
+  return _internal_has_amount();
+}
+inline void xshard_msg_t::clear_amount() {
+  _impl_.amount_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline float xshard_msg_t::_internal_amount() const {
+  return _impl_.amount_;
+}
+inline float xshard_msg_t::amount() const {
+  // @@protoc_insertion_point(field_get:xshard_msg_t.amount)
+  return _internal_amount();
+}
+inline void xshard_msg_t::_internal_set_amount(float value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.amount_ = value;
+}
+inline void xshard_msg_t::set_amount(float value) {
+  _internal_set_amount(value);
+  // @@protoc_insertion_point(field_set:xshard_msg_t.amount)
+}
+
+// optional bool commit = 6;
+inline bool xshard_msg_t::_internal_has_commit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool xshard_msg_t::has_commit() const {
+  return _internal_has_commit();
+}
+inline void xshard_msg_t::clear_commit() {
+  _impl_.commit_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool xshard_msg_t::_internal_commit() const {
+  return _impl_.commit_;
+}
+inline bool xshard_msg_t::commit() const {
+  // @@protoc_insertion_point(field_get:xshard_msg_t.commit)
+  return _internal_commit();
+}
+inline void xshard_msg_t::_internal_set_commit(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.commit_ = value;
+}
+inline void xshard_msg_t::set_commit(bool value) {
+  _internal_set_commit(value);
+  // @@protoc_insertion_point(field_set:xshard_msg_t.commit)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_Msg_2eproto
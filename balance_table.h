@@ -1,21 +1,27 @@
+#pragma once
 #include <cstdlib>
+#include <cstdio>
 #include <iostream>
 #include <fstream>
 #include <string>
 #include <vector>
 #include "Msg.pb.h"
 #include "parameter.h"
+#include "config.h"
 
 class BalanceTable {
     /**
-     * note: balance table file format
+     * note: balance table file format, one amount for each of the client_count clients
      * line #1: amount_client_0 amount_client_1 amount_client_2 <- note: there is a space at the end.
+     * line #2: the last log index applied to the amounts, written with them. Missing in the files of older versions.
      */
     public:
         // BalanceTable () {}
         
         void load_file(std::string fname) {
             filename = fname;
+            bal_tab.assign(get_config().client_count, 0);
+            applied_index = UNKNOWN_APPLIED_INDEX;
             
             std::ifstream file(filename);
             // check if the open is failed (file doesn't exist)
@@ -24,9 +30,10 @@ class BalanceTable {
                 std::fstream fs;
                 fs.open(filename, std::ios::out | std::ios::app);
                 std::stringstream ss;
-                for (int i = 0; i < CLIENT_COUNT; i++) {
+                for (int i = 0; i < get_config().client_count; i++) {
                     ss << "10.0 ";
                 }
+                ss << std::endl << -1;
                 fs.write(ss.str().c_str(), ss.str().size());
                 fs.close();
             }
@@ -46,7 +53,7 @@ class BalanceTable {
                     clients_balance_strs.push_back(amount_str);
                 }
                 
-                for (int client_id = 0; client_id < clients_balance_strs.size(); client_id++) {
+                for (int client_id = 0; client_id < clients_balance_strs.size() && client_id < bal_tab.size(); client_id++) {
                     float amount;
                     try {
                         amount = stof(clients_balance_strs.at(client_id));
@@ -57,6 +64,13 @@ class BalanceTable {
                     }
                     bal_tab[client_id] = amount; 
                 }
+                if (getline(file, line)) {
+                    try {
+                        applied_index = std::stoi(line);
+                    } catch(...) {
+                        applied_index = UNKNOWN_APPLIED_INDEX;
+                    }
+                }
             }
             else {
                 std::cerr << "[BalanceTable::load_file] error: unable to open file!" << std::endl;
@@ -67,52 +81,68 @@ class BalanceTable {
         }
 
         float get_balance(uint32_t id) {
-            if (id >= CLIENT_COUNT || id < 0) {
+            if (id >= bal_tab.size() || id < 0) {
                 std::cerr << "Error: balance_table.h: << get_balance() : Invalid id!" << std::endl;
                 exit(0);
             }
             return bal_tab[id];
         }
 
-        void set_balance(uint32_t id, float new_bal) {
-            if (id >= CLIENT_COUNT || id < 0) {
+        void set_balance(uint32_t id, float new_bal, bool flush = true) {
+            if (id >= bal_tab.size() || id < 0) {
                 std::cerr << "Error: balance_table.h: << get_balance() : Invalid id!" << std::endl;
                 exit(0);
             }
             bal_tab[id] = new_bal;
-            write_bal_tab_to_file();
+            if (flush) {
+                write_bal_tab_to_file();
+            }
         }
 
-        void update_balance(uint32_t sid, uint32_t rid, float bal_change) {
-            if (sid >= CLIENT_COUNT || sid < 0 || rid >= CLIENT_COUNT || sid < 0) {
+        // flush = false only updates the table in memory, the caller need to write the file later.
+        void update_balance(uint32_t sid, uint32_t rid, float bal_change, bool flush = true) {
+            if (sid >= bal_tab.size() || sid < 0 || rid >= bal_tab.size() || sid < 0) {
                 std::cerr << "Error: balance_table.h: << get_balance() : Invalid id!" << std::endl;
                 exit(0);
             }
             bal_tab[sid] -= bal_change;
             bal_tab[rid] += bal_change;
-            write_bal_tab_to_file();
+            if (flush) {
+                write_bal_tab_to_file();
+            }
         }
 
+        // the amounts and the applied index are written to a temporary file first and renamed over the table,
+        // a crash leaves either the old table or the new one.
         void write_bal_tab_to_file() {
-            // Disregard all the existing context and write from the start
-            std::ofstream outfile(filename, std::ios::trunc);
+            std::string temp_filename = filename + ".tmp";
+            std::ofstream outfile(temp_filename, std::ios::trunc);
 
             std::string bal_tab_str = "";
-            for (int i = 0; i < CLIENT_COUNT; i++) {
+            for (int i = 0; i < bal_tab.size(); i++) {
                 bal_tab_str += std::to_string(bal_tab[i]) + " ";
             }
 
-            outfile << bal_tab_str;
+            outfile << bal_tab_str << std::endl << applied_index << std::endl;
 
             outfile.close();
+            if (outfile.fail() || rename(temp_filename.c_str(), filename.c_str()) != 0) {
+                std::cerr << "[BalanceTable::write_bal_tab_to_file] failed to write " << filename << std::endl;
+            }
         }
 
+        // UNKNOWN_APPLIED_INDEX if the file didn't say, it then reflects the committed entries of the log.
+        int get_applied_index() {return applied_index;}
+        void set_applied_index(int index) {applied_index = index;}       // Written with the amounts by the next write_bal_tab_to_file().
+
         void print_bal_tab() {
-            std::cout << "client 0 : $" << bal_tab[0] << "; ";
-            std::cout << "client 1 : $" << bal_tab[1] << "; ";
-            std::cout << "client 2 : $" << bal_tab[2] << std::endl;
+            for (int i = 0; i < bal_tab.size(); i++) {
+                std::cout << "client " << i << " : $" << bal_tab[i] << ((i + 1 < bal_tab.size()) ? "; " : "");
+            }
+            std::cout << std::endl;
         }
     private:
-        float bal_tab[CLIENT_COUNT];
+        std::vector<float> bal_tab;
         std::string filename;
+        int applied_index = UNKNOWN_APPLIED_INDEX;
 };
\ No newline at end of file
@@ -1,3 +1,4 @@
+#pragma once
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
@@ -7,8 +8,20 @@
 #include <iomanip>
 #include <sstream>
 #include <openssl/sha.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
 #include "Msg.pb.h"
 #include "raft.h"
+#include "clock.h"
+#include "msg_arena.h"
+
+// the entries of a cross shard transfer, both shards log a prepare entry and then the decision.
+typedef enum {
+    XSHARD_NONE,
+    XSHARD_PREPARE,
+    XSHARD_COMMIT,              // applied to the accounts owned by the shard
+    XSHARD_ABORT
+} xshard_phase_t;
 
 class Transaction {
     public:
@@ -20,10 +33,17 @@ class Transaction {
         void set_recver_id(uint32_t rid) {recver_id = rid;}
         void set_amount(float amt) {amount = amt;}
         void set_flag(bool flag) {bal_txn_flag = flag;}
+        void set_config(uint64_t new_voters) {config_txn_flag = true; voters = new_voters;}
+        void set_xshard(uint32_t phase, uint64_t txn_id) {xshard_phase = phase; xshard_txn_id = txn_id;}
         uint32_t get_sender_id() {return sender_id;}
         uint32_t get_recver_id() {return recver_id;}
         float get_amount() {return amount;}
         bool get_bal_txn_flag() {return bal_txn_flag;}
+        bool get_config_txn_flag() {return config_txn_flag;}
+        uint64_t get_voters() {return voters;}
+        uint32_t get_xshard_phase() {return xshard_phase;}
+        uint64_t get_xshard_txn_id() {return xshard_txn_id;}
+        bool is_xshard() {return xshard_phase != XSHARD_NONE;}
 
         // review: why is this needed
         std::string serialize_transaction() {
@@ -32,7 +52,14 @@ class Transaction {
 
         void print_transaction() {
             std::string flag_str;
+            if (config_txn_flag) {
+                std::cout << "Config Transation : voters mask " << voters << std::endl;
+                return;
+            }
             if (bal_txn_flag) flag_str = "Balance";
+            else if (xshard_phase == XSHARD_PREPARE) flag_str = "Cross Shard Prepare " + std::to_string(xshard_txn_id);
+            else if (xshard_phase == XSHARD_COMMIT) flag_str = "Cross Shard Commit " + std::to_string(xshard_txn_id);
+            else if (xshard_phase == XSHARD_ABORT) flag_str = "Cross Shard Abort " + std::to_string(xshard_txn_id);
             else flag_str = "Transfer";
             std::cout<< flag_str << " Transation : " << "Client " << sender_id << " send $" << amount << " To Client " << recver_id << std::endl;
         }
@@ -42,6 +69,10 @@ class Transaction {
         uint32_t recver_id = 0;
         float amount = 0;
         bool bal_txn_flag = false;
+        bool config_txn_flag = false;       // membership change entry, not applied to the balance table
+        uint64_t voters = 0;                // bit i set if server i is a voter in the new configuration
+        uint32_t xshard_phase = XSHARD_NONE;
+        uint64_t xshard_txn_id = 0;
 };
 
 class Block {
@@ -59,16 +90,82 @@ class Block {
         }
 
         void set_term(uint32_t t) {term = t;}
-        void set_nonce(std::string n) {nonce = n;}
+        void set_nonce(const std::string &n) {nonce = n;}
         void set_txn(Transaction &T) {txn = T;}
-        void set_phash(std::string h) {phash = h;}
+        void set_phash(const std::string &h) {phash = h;}
         void set_index(int i) {index = i;}
 
         uint32_t get_term() {return term;}
-        std::string get_phash() {return phash;}
-        std::string get_nonce() {return nonce;}
+        const std::string& get_phash() {return phash;}
+        const std::string& get_nonce() {return nonce;}
         Transaction& get_txn() {return txn;}
         int get_index() {return index;}
+
+        // the block as a block_msg_t, the way it's written in the log file and sent to the followers.
+        void encode(std::string &out) {
+            // reused rather than in the arena, the hash is copied into the storage of the previous one.
+            static thread_local block_msg_t block_msg;
+            block_msg.Clear();
+            txn_msg_t* txn_msg = block_msg.mutable_txn();
+            // because each block just have one transaction
+            // so just parse the transaction and add to the block
+            txn_msg->set_sender_id(txn.get_sender_id());
+            txn_msg->set_recver_id(txn.get_recver_id());
+            txn_msg->set_amount(txn.get_amount());
+            txn_msg->set_bal_txn_flag(txn.get_bal_txn_flag());
+            if (txn.get_config_txn_flag()) {
+                txn_msg->set_config_txn_flag(true);
+                txn_msg->set_voters(txn.get_voters());
+            }
+            if (txn.is_xshard()) {
+                txn_msg->set_xshard_phase(txn.get_xshard_phase());
+                txn_msg->set_xshard_txn_id(txn.get_xshard_txn_id());
+            }
+            block_msg.set_term(term);
+            block_msg.set_phash(phash);
+            block_msg.set_nonce(nonce);
+            block_msg.set_index(index);
+            block_msg.SerializeToString(&out);
+        }
+
+        // false if the bytes aren't an encoded block.
+        bool decode(const char* data, size_t size) {
+            ArenaBatch batch;
+            block_msg_t &block_msg = *MsgArena::create<block_msg_t>();
+            if (!block_msg.ParseFromArray(data, size)) {
+                return false;
+            }
+            txn = Transaction();
+            txn.set_sender_id(block_msg.txn().sender_id());
+            txn.set_recver_id(block_msg.txn().recver_id());
+            txn.set_amount(block_msg.txn().amount());
+            txn.set_flag(block_msg.txn().bal_txn_flag());
+            if (block_msg.txn().config_txn_flag()) {
+                txn.set_config(block_msg.txn().voters());
+            }
+            txn.set_xshard(block_msg.txn().xshard_phase(), block_msg.txn().xshard_txn_id());
+            term = block_msg.term();
+            phash = block_msg.phash();
+            nonce = block_msg.nonce();
+            index = block_msg.index();
+            return true;
+        }
+
+        // the term of an encoded block, the rest of it isn't decoded.
+        static bool peek_term(const std::string &data, term_t &term) {
+            using google::protobuf::internal::WireFormatLite;
+            google::protobuf::io::CodedInputStream input((const uint8_t*) data.data(), data.size());
+            uint32_t tag;
+            while ((tag = input.ReadTag()) != 0) {
+                if (tag == WireFormatLite::MakeTag(block_msg_t::kTermFieldNumber, WireFormatLite::WIRETYPE_VARINT)) {
+                    return input.ReadVarint32(&term);
+                }
+                if (!WireFormatLite::SkipField(&input, tag)) {
+                    return false;
+                }
+            }
+            return false;
+        }
     
         std::string sha256(const std::string str){
             unsigned char hash[SHA256_DIGEST_LENGTH];
@@ -110,7 +207,6 @@ class Block {
             std::string txns_hash = "";
             std::string tempNounce;
             std::string hashInfo;
-            srand(time(NULL));
             txns_hash += txn.serialize_transaction();
             do{
                 tempNounce = std::string(1, char(rand()%26 + 97));
@@ -185,19 +281,8 @@ class Blockchain {
 
                 // note: read the rest of the lines and parse each of them to transactions
                 while (getline (infile, line)){
-                    block_msg_t block_msg;
-                    block_msg.ParseFromString(line);
                     Block blo;
-                    Transaction txn;
-                    txn.set_sender_id(block_msg.txn().sender_id());
-                    txn.set_recver_id(block_msg.txn().recver_id());
-                    txn.set_amount(block_msg.txn().amount());
-                    txn.set_flag(block_msg.txn().bal_txn_flag());
-                    blo.set_txn(txn);
-                    blo.set_phash(block_msg.phash());
-                    blo.set_nonce(block_msg.nonce());
-                    blo.set_term(block_msg.term());
-                    blo.set_index(block_msg.index());
+                    blo.decode(line.data(), line.size());
                     blocks.push_back(blo);
                 }
             } else {
@@ -210,42 +295,43 @@ class Blockchain {
 
         void write_block_to_file(Block &newblo) {
             std::ofstream outfile(filename, std::ios::app);
-
-            block_msg_t block_msg;
-            txn_msg_t* txn_msg_ptr = new txn_msg_t();
-            
-            // because each block just have one transaction
-            // so just parse the transaction and add to the block
-            txn_msg_ptr->set_sender_id(newblo.get_txn().get_sender_id());
-            txn_msg_ptr->set_recver_id(newblo.get_txn().get_recver_id());
-            txn_msg_ptr->set_amount(newblo.get_txn().get_amount());
-            txn_msg_ptr->set_bal_txn_flag(newblo.get_txn().get_bal_txn_flag());
-
-            block_msg.set_allocated_txn(txn_msg_ptr);
-            block_msg.set_term(newblo.get_term());
-            block_msg.set_phash(newblo.get_phash());
-            block_msg.set_nonce(newblo.get_nonce());
-            block_msg.set_index(newblo.get_index());
-            
-            std::string block_str = block_msg.SerializeAsString();
-        
+            std::string block_str;
+            newblo.encode(block_str);
             outfile << block_str << std::endl;
-
             outfile.close();
         }
 
         /*  
         *   Client send Server a single transction to add into blockchain.
         *   Because finding nonce is trival, we consider each block contains only one real transaction and two NULLs.
+        *   With persist == false the block is only added in memory, the caller writes it with persist_block,
+        *   ie. the leader while the block is being replicated.
         */
-        void add_transaction(uint32_t term, Transaction new_txn) {
+        void add_transaction(uint32_t term, Transaction new_txn, bool persist = true) {
             Block newblo(term, {new_txn});
             if (!blocks.empty()) {
                 newblo.set_phash(blocks.back().find_hash());
             }
             newblo.set_index(blocks.size());
             blocks.push_back(newblo);
+            if (persist) {
+                persist_block(newblo);
+            }
+        }
+
+        // append the block to the file and wait until it's on disk.
+        void persist_block(Block newblo) {
             write_block_to_file(newblo);
+            sync_to_disk();
+        }
+
+        // the log files aren't fsynced, a slow disk is simulated by waiting sync_delay_ms after every log write
+        // the same way the mesh simulates the network delay.
+        void set_sync_delay(int delay_ms) {sync_delay_ms = delay_ms;}
+        void sync_to_disk() {
+            if (sync_delay_ms > 0) {
+                clock_sleep_ms(sync_delay_ms);
+            }
         }
 
         void set_committed_index(int index) {
@@ -329,6 +415,42 @@ class Blockchain {
             write_bc_to_file();
         }
 
+        /**
+         * @brief the follower's clean_up_blocks for the entries it received: the blocks from index on are replaced
+         *        by the entries from first on. The entries are written to the file as the leader encoded them,
+         *        the whole file is only rewritten if blocks were cut off.
+         *
+         * @return the entries appended, less than asked if one of them is broken.
+         */
+        size_t append_encoded(int index, const encoded_entries_t &encoded, size_t first) {
+            bool cut = index < (int) blocks.size();
+            while ((int) blocks.size() > index) {
+                blocks.pop_back();
+            }
+            size_t appended = 0;
+            for (size_t i = first; i < encoded.size(); i++) {
+                blocks.emplace_back();
+                if (!blocks.back().decode(encoded.data(i), encoded.length(i))) {
+                    std::cerr << "[blockchain::append_encoded] broken entry at index: " << blocks.size() - 1 << std::endl;
+                    blocks.pop_back();
+                    break;
+                }
+                appended++;
+            }
+            if (cut) {
+                write_bc_to_file();
+                return appended;
+            }
+            std::ofstream outfile(filename, std::ios::app);
+            for (size_t i = first; i < first + appended; i++) {
+                outfile.write(encoded.data(i), encoded.length(i));
+                outfile << '\n';
+            }
+            outfile.close();
+            sync_to_disk();
+            return appended;
+        }
+
         void write_bc_to_file() {
             std::ofstream outfile(filename, std::ios::out | std::ios::trunc);
             
@@ -366,7 +488,7 @@ class Blockchain {
             for (auto& b : blocks) {
                 write_block_to_file(b);
             }
-
+            sync_to_disk();
         }
 
         Block& get_block_by_index(int index) {
@@ -407,4 +529,5 @@ class Blockchain {
         std::vector<Block> blocks;
         int committed_index;
         std::string filename;
+        int sync_delay_ms = 0;
 };
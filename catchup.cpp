@@ -0,0 +1,163 @@
+/**
+ * @file catchup.cpp
+ * @brief streams the missing log to a follower lagging behind the leader, ie. after a restart or a partition,
+ *        or to a learner. Instead of one AppendEntries from nextIndex to the tail per failed reply:
+ *        1) the stream starts where the follower's failed reply hints its log ends or diverges.
+ *        2) the log is cut in chunks of CATCHUP_CHUNK_SIZE entries, up to CATCHUP_WINDOW of them are sent
+ *           before the first one is acknowledged. Every ack lets the next chunk go.
+ *        3) the chunks are sent by a thread of the follower's own, the leader's thread only copies the entries.
+ *        4) a failed chunk moves the stream back to the hint, a stream without any ack for CATCHUP_RETRY_MS
+ *           restarts from the last acknowledged entry.
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <chrono>
+#include <iostream>
+#include <algorithm>
+#include "state.h"
+
+CatchupSender::CatchupSender(ShardNetwork* network, int id) : network(network), id(id), stop_flag(false), done(false) {
+    thread = clock_thread([this]() { send_handler(); });
+}
+
+CatchupSender::~CatchupSender() {
+    stop_flag = true;
+    // sleep rather than block in join, the simulator runs the sender only while this thread sleeps.
+    while (!done) {
+        clock_sleep_ms(CATCHUP_CHECK_SLEEP_MS);
+    }
+    thread.join();
+    append_entry_rpc_t* chunk = NULL;
+    while (queue.pop(chunk)) {
+        delete chunk;
+    }
+}
+
+bool CatchupSender::push(append_entry_rpc_t* chunk) {
+    return queue.push(chunk);
+}
+
+void CatchupSender::send_handler() {
+    while (!stop_flag) {
+        append_entry_rpc_t* chunk = NULL;
+        if (!queue.pop(chunk)) {
+            clock_sleep_ms(CATCHUP_CHECK_SLEEP_MS);
+            continue;
+        }
+        replica_msg_wrapper_t msg;
+        msg.type = APP_ENTR_RPC;
+        std::swap(msg.append_rpc, *chunk);
+        network->replica_send_message(msg, id);
+        delete chunk;
+    }
+    done = true;
+}
+
+LeaderState::~LeaderState() {
+    for (auto &stream : catchup_streams) {
+        if (stream.sender != NULL) {
+            delete stream.sender;
+        }
+    }
+}
+
+void LeaderState::start_catchup(int id, int from_index) {
+    catchup_stream_t &stream = catchup_streams[id];
+    if (!stream.active) {
+        std::cout << "[State::LeaderState::start_catchup] server " << id << " lags behind, streaming the log from " << from_index << std::endl;
+    }
+    stream.active = true;
+    stream.next_index = std::max(0, from_index);
+    stream.base_index = stream.next_index;
+    stream.in_flight.clear();
+    stream.progress_time = clock_now();
+    if (stream.sender == NULL) {
+        stream.sender = new CatchupSender(get_context()->get_network(), id);
+    }
+    pump_catchup(id);
+}
+
+void LeaderState::pump_catchup(int id) {
+    catchup_stream_t &stream = catchup_streams[id];
+    Blockchain &log = get_context()->get_bc_log();
+    while (stream.active && stream.in_flight.size() < CATCHUP_WINDOW && stream.next_index <= log.get_last_index()) {
+        int prev_log_index = stream.next_index - 1;
+        int last_index = std::min(stream.next_index + CATCHUP_CHUNK_SIZE - 1, log.get_last_index());
+        append_entry_rpc_t* chunk = new append_entry_rpc_t();
+        chunk->term = get_context()->get_curr_term();
+        chunk->leader_id = get_context()->get_id();
+        chunk->prev_log_index = prev_log_index;
+        chunk->prev_log_term = (prev_log_index == -1) ? 0 : log.get_block_by_index(prev_log_index).get_term();
+        chunk->commit_index = log.get_committed_index();
+        for (int j = stream.next_index; j <= last_index; j++) {
+            chunk->entries.push_back(log.get_block_by_index(j));
+        }
+        // the sender thread owns the chunk once it's pushed, it may be sent and deleted already.
+        int commit_index = chunk->commit_index;
+        if (!stream.sender->push(chunk)) {
+            delete chunk;
+            break;
+        }
+        mark_append_sent(id, commit_index);
+        stream.in_flight.push_back(last_index);
+        stream.next_index = last_index + 1;
+    }
+}
+
+void LeaderState::stream_entries(int id) {
+    if (catchup_streams[id].active) {
+        pump_catchup(id);
+        return;
+    }
+    // assume the follower holds everything but the tail, its failed reply tells otherwise.
+    start_catchup(id, std::max(matchIndex[id] + 1, get_context()->get_bc_log().get_last_index()));
+}
+
+/**
+ * @brief A failed reply only moves the stream back: the chunks sent before a restart fail too,
+ *        with hints at or after the restart point.
+ *
+ * @param reply
+ */
+void LeaderState::handle_catchup_reply(append_entry_reply_t* reply) {
+    int id = reply->sender_id;
+    catchup_stream_t &stream = catchup_streams[id];
+    if (!reply->success) {
+        if (reply->match_index + 1 < stream.base_index) {
+            start_catchup(id, reply->match_index + 1);
+        }
+        return;
+    }
+    matchIndex[id] = std::max(matchIndex[id], reply->match_index);
+    nextIndex[id] = matchIndex[id] + 1;
+    while (!stream.in_flight.empty() && stream.in_flight.front() <= matchIndex[id]) {
+        stream.in_flight.pop_front();
+        stream.progress_time = clock_now();
+    }
+    if (stream.in_flight.empty() && matchIndex[id] >= get_context()->get_bc_log().get_last_index()) {
+        stream.active = false;
+        return;
+    }
+    pump_catchup(id);
+}
+
+void LeaderState::check_catchup_streams() {
+    for (int id = 0; id < catchup_streams.size(); id++) {
+        catchup_stream_t &stream = catchup_streams[id];
+        if (!stream.active) {
+            continue;
+        }
+        if (!is_replication_target(id)) {
+            stream.active = false;
+            continue;
+        }
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(clock_now() - stream.progress_time);
+        if (ms.count() >= CATCHUP_RETRY_MS) {
+            std::cout << "[State::LeaderState::check_catchup_streams] no ack from server " << id << ", restart from " << matchIndex[id] + 1 << std::endl;
+            start_catchup(id, matchIndex[id] + 1);
+            continue;
+        }
+        pump_catchup(id);
+    }
+}
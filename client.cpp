@@ -5,9 +5,12 @@
 #include <unistd.h>
 #include <stdint.h>
 #include <sstream>
+#include <map>
+#include <algorithm>
 #include "client.h"
 #include "message.h"
 #include "Msg.pb.h"
+#include "msg_arena.h"
 #include "parameter.h"
 
 using namespace RaftClient;
@@ -15,10 +18,12 @@ using namespace RaftClient;
 #define DEBUG_MODE
 
 const char* usage = 
-"Run the program by typing ./client <client_id> where client_id is within range [0, 2].\n"
+"Run the program by typing ./client <client_id> [config_file] where client_id is within range [0, client_count - 1].\n"
 "Commands: \n"
 "transfer: [transfer or t or T] <recv_id> <amount>\n"
-"balance: [balance or b or B]\n";
+"balance: [balance or b or B]\n"
+"stale balance: [stale_balance or sb] <server_id>, read from any server, maybe a little behind the leader\n"
+"bench: bench <seconds> [recv_id] [window], keep sending $0 transfers and print the committed count of every second\n";
 
 inline void print_usage() {
     printf("%s\n", usage);
@@ -35,17 +40,18 @@ Client::~Client() {
 
 Network::Network(Client *client) {
     this->client = client;
+    servers.reserve(get_config().server_count);
+    for (int i = 0; i < get_config().server_count; i++) {
+        servers.push_back({.connected = false, .id = i, .port = get_config().server_base_port + i, .conn = NULL});
+    }
     conn_thread = std::thread(&Network::conn_handler, this);
 }
 
 Network::~Network() {
-    for (int i = 0; i < SERVER_COUNT; i++) {
+    // the connections are closed with the loop.
+    loop.stop();
+    for (int i = 0; i < servers.size(); i++) {
         servers[i].connected = false;
-        try {
-            servers[i].recv_task->join();
-        } catch(...) {}
-        delete servers[i].recv_task;
-        close(servers[i].port);
     }
 }
 
@@ -55,7 +61,7 @@ Network::~Network() {
  */
 void Network::conn_handler() {
     while (true) {
-        for (int i = 0; i < SERVER_COUNT; i++) {
+        for (int i = 0; i < servers.size(); i++) {
             // check the next one if the server is connected
             if (servers[i].connected)
                 continue;
@@ -74,8 +80,8 @@ void Network::conn_handler() {
 
             sockaddr_in self_addr = {0}; 
             self_addr.sin_family = AF_INET;
-            self_addr.sin_addr.s_addr = inet_addr(CLIENT_IP);
-            self_addr.sin_port = htons(CLIENT_BASE_PORT + get_client()->get_client_id() * CLIENT_PORT_MULT + i);
+            self_addr.sin_addr.s_addr = inet_addr(get_config().client_ip.c_str());
+            self_addr.sin_port = htons(get_config().client_base_port + get_client()->get_client_id() * get_config().client_port_mult + i);
 
             if (bind(sock, (sockaddr*) &self_addr, sizeof(self_addr)) < 0) {
                 std::cerr << "[Network::conn_handler] failed to bind the self port." << std::endl;
@@ -85,7 +91,7 @@ void Network::conn_handler() {
 
             sockaddr_in addr = {0};
             addr.sin_family = AF_INET;
-            addr.sin_addr.s_addr = inet_addr(SERVER_IP);
+            addr.sin_addr.s_addr = inet_addr(get_config().get_server_ip(i).c_str());
             addr.sin_port = htons(servers[i].port);
             
             if (connect(sock, (sockaddr*) &addr, sizeof(sockaddr_in)) < 0) {
@@ -96,104 +102,82 @@ void Network::conn_handler() {
                 continue;
             }
             
-            // need to check if the previous task is still running
-            // need to stop it and free the memory if it's running
-            if (servers[i].recv_task != NULL) {
-                try {
-                    servers[i].recv_task->join();
-                    free(servers[i].recv_task);
-                    servers[i].recv_task = NULL;
-                } catch (...) {};
-            }
-
-            // need to update server information so that the listening thread can use it
+            // need to update server information before the loop serves the socket.
+            // the previous connection is freed with its last reference.
             servers[i].connected = true;
-            servers[i].sock = sock;
-            servers[i].recv_task = new std::thread(&RaftClient::Network::recv_handler, this, i);
+            std::shared_ptr<Connection> conn = loop.attach(sock,
+                [this, i](const uint8_t* data, size_t size) { recv_handler(i, data, size); },
+                [this, i]() {
+                    std::cout << "[Network::recv_handler] connection with server: " << servers[i].id << " is lost." << std::endl;
+                    servers[i].connected = false;
+                });
+            if (conn == NULL) {
+                servers[i].connected = false;
+                continue;
+            }
+            // the sends read it from the main thread.
+            std::atomic_store(&servers[i].conn, conn);
+            std::cout << "[Network::conn_handler] start listening server: " << servers[i].id << "'s messages" << std::endl;
         }
         // sleep the current thread after looping for one round
         std::this_thread::sleep_for(std::chrono::milliseconds(5000));
     }
 }
 
-void Network::recv_handler(int index) {
+void Network::recv_handler(int index, const uint8_t* data, size_t size) {
     const int server_id = servers[index].id;
-    const int server_sock = servers[index].sock;
-    std::cout << "[Network::recv_handler] start listening server: " << servers[index].id << "'s messages" << std::endl;
-    while (servers[server_id].connected) {
-        if (!servers[index].connected)
-            break;
-        
-        int count = 0;
-        COMM_HEADER_TYPE msg_bytes = 0;
-        
-        // no need to use while because read on stream runs as byte-stream mode in default
-        count = read(server_sock, &msg_bytes, sizeof(msg_bytes));
-        if (count <= 0) {
-            break;
-        } else if (count < sizeof(msg_bytes)) {
-            std::cout << "[Network::recv_handler] received borken header from server " << server_id << std::endl;
-            continue; 
-        }
-        // parse the retrive size and allocate message buffer
-        msg_bytes = ntohl(msg_bytes);
-        uint8_t *msg = new uint8_t[msg_bytes];
-
-        // read the body message
-        count = read(server_sock, msg, msg_bytes);
-        if (count <= 0) {
-            delete [] msg;
-            break;
-        } else if (count < msg_bytes) {
-            std::cout << "[Network::recv_handler] received borken message from server " << server_id << std::endl;
-            delete [] msg;
-            continue;
-        }
-
-        response_msg_t response_msg;
-        response_msg.ParseFromArray(msg, msg_bytes);
-        delete [] msg;
-
-        // if client receives leader change response, it doesn't need to add to the queue
-        // instread, it will change the estimated leader id directly.
-        message_type_t type = (message_type_t) response_msg.type();
-        if (type == LEADER_CHANGE) {
-            int leader_id = response_msg.leader_id();
-            get_client()->set_leader_id(leader_id);
-            std::cout << "[Network::recv_handler] changed leader to leader: " << leader_id << std::endl;   
-            continue;
-        }
+    response_msg_t response_msg;
+    if (!response_msg.ParseFromArray(data, size)) {
+        std::cout << "[Network::recv_handler] received borken message from server " << server_id << std::endl;
+        return;
+    }
 
-        // if the response is not leader change response
-        // then need to save to the response queue
-        auto response = new response_t();
-        response->type = type;
-        response->request_id = response_msg.request_id();
-        response->succeed = response_msg.succeed();
-        if (type == TRANSACTION_RESPONSE) {
-            // do nothing
-        } else if (type == BALANCE_RESPONSE) {
-            response->balance = response_msg.balance();
-        } else {
-            std::cout << "[Network::recv_handler] received unknown type. discarded!" << std::endl;
-            delete response;
-            continue;
+    // if client receives leader change response, it doesn't need to add to the queue
+    // instread, it will change the estimated leader id directly.
+    message_type_t type = (message_type_t) response_msg.type();
+    if (type == LEADER_CHANGE) {
+        // my requests all go to the shard of my account, the other shards' leaders don't matter.
+        if (response_msg.shard_id() != get_config().shard_of(get_client()->get_client_id())) {
+            return;
         }
-        response_queue_push(response);
-        std::cout << "[Network::recv_handler] message received and saved!" << std::endl;
+        int leader_id = response_msg.leader_id();
+        get_client()->set_leader_id(leader_id);
+        std::cout << "[Network::recv_handler] changed leader to leader: " << leader_id << std::endl;   
+        // the request waiting for a response is resent to the new leader.
+        response_signal.notify();
+        return;
     }
 
-    std::cout << "[Network::recv_handler] connection with server: " << server_id << " is lost." << std::endl;
-    servers[index].connected = false;
-    close(server_sock);
+    // if the response is not leader change response
+    // then need to save to the response queue
+    auto response = new response_t();
+    response->type = type;
+    response->request_id = response_msg.request_id();
+    response->succeed = response_msg.succeed();
+    if (type == TRANSACTION_RESPONSE) {
+        // do nothing
+    } else if (type == BALANCE_RESPONSE) {
+        response->balance = response_msg.balance();
+    } else if (type == SERVER_BUSY) {
+        // the server refused the request, the caller backs off.
+    } else {
+        std::cout << "[Network::recv_handler] received unknown type. discarded!" << std::endl;
+        delete response;
+        return;
+    }
+    response_queue_push(response);
+    std::cout << "[Network::recv_handler] message received and saved!" << std::endl;
 }
 
 void Network::response_queue_push(response_t* response) {
     if (response == NULL)
         return;
-    response_queue_lock.lock();
-    response_queue.push_back(response);
-    response_queue_lock.unlock();
+    if (!response_queue.push(response)) {
+        std::cout << "[Network::response_queue_push] the response queue is full, dropped the response of req# " << response->request_id << std::endl;
+        delete response;
+        return;
+    }
+    response_signal.notify();
 }
 
 /**
@@ -202,10 +186,8 @@ void Network::response_queue_push(response_t* response) {
  * @return response_t* 
  */
 response_t* Network::response_queue_pop() {
-    if (response_queue_get_count() == 0)
-        return NULL;
-    response_t* response = response_queue.at(0);
-    response_queue.pop_front();
+    response_t* response = NULL;
+    response_queue.pop(response);
     return response;
 }
 
@@ -213,32 +195,42 @@ size_t Network::response_queue_get_count() {
     return response_queue.size();
 }
 
+void Network::response_queue_wait(uint32_t timeout_ms) {
+    uint64_t ticket = response_signal.ticket();
+    if (response_queue_get_count() != 0) {
+        return;
+    }
+    response_signal.wait_ms(ticket, timeout_ms);
+}
+
 /**
  * @brief send message to estimated leader
  * 
  * @param request_msg 
  */
 void Network::send_message(request_msg_t &request_msg) {
-    std::string msg_string = request_msg.SerializeAsString();
-    COMM_HEADER_TYPE header = htonl(request_msg.ByteSizeLong());
-    
-    uint32_t leader_id = get_client()->get_leader_id();
-    if (!servers[leader_id].connected) {
-        std::cout << "[Network::send_message] leader is not connected." << std::endl;
+    send_message(request_msg, get_client()->get_leader_id());
+}
+
+void Network::send_message(request_msg_t &request_msg, uint32_t server_id) {
+    if (server_id >= servers.size() || !servers[server_id].connected) {
+        std::cout << "[Network::send_message] server " << server_id << " is not connected." << std::endl;
         return;
     }
 
-    write(servers[leader_id].sock, &header, sizeof(header));
-    write(servers[leader_id].sock, msg_string.c_str(), request_msg.ByteSizeLong());
+    std::shared_ptr<Connection> conn = std::atomic_load(&servers[server_id].conn);
+    if (conn != NULL) {
+        conn->send_message(request_msg);
+    }
 }
 
 void Network::send_transaction(uint32_t recv_id, uint32_t amount, uint64_t req_id) {
-    request_msg_t request_msg;
-    txn_msg_t* transaction = new txn_msg_t();
+    ArenaBatch batch;
+    request_msg_t &request_msg = *MsgArena::create<request_msg_t>();
+    txn_msg_t* transaction = request_msg.mutable_transaction();
     transaction->set_recver_id(recv_id);
     transaction->set_amount(amount);
     transaction->set_sender_id(get_client()->get_client_id());
-    request_msg.set_allocated_transaction(transaction);
     request_msg.set_request_id(req_id);
     request_msg.set_client_id(get_client()->get_client_id());
     request_msg.set_type(TRANSACTION_REQUEST);
@@ -253,34 +245,147 @@ void Network::send_balance(uint64_t req_id) {
     send_message(request_msg);
 }
 
+/**
+ * @brief wait for the response of the request sent to the estimated leader.
+ * 
+ * @return response_t* NULL on timeout, or as soon as a LEADER_CHANGE redirects the client (the caller should resend).
+ */
+void Network::send_stale_balance(uint32_t server_id, uint64_t req_id) {
+    request_msg_t request_msg;
+    request_msg.set_request_id(req_id);
+    request_msg.set_client_id(get_client()->get_client_id());
+    request_msg.set_type(STALE_BALANCE_REQUEST);
+    send_message(request_msg, server_id);
+}
+
 response_t* client_wait_reply(Client* client, uint32_t timeout_ms) {
     if (client == NULL) {
         return NULL;
     }
     typedef std::chrono::system_clock sysclk;
     auto t0 = sysclk::now();
+    int leader_id = client->get_leader_id();
     while (true) {
-        if (client->get_network()->response_queue_get_count()) {
-            return client->get_network()->response_queue_pop();
+        response_t* response = client->get_network()->response_queue_pop();
+        if (response != NULL) {
+            return response;
         } 
+        if (client->get_leader_id() != leader_id) {
+            return NULL;
+        }
 
         auto t1 = sysclk::now();
         auto dt = std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0);
         if (dt.count() > timeout_ms) {
             return NULL;
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        // woken up by the response or the leader change, a leader change just before the wait is seen within 200ms.
+        client->get_network()->response_queue_wait(std::min<uint32_t>(timeout_ms - dt.count() + 1, 200));
     }
 }
 
+/**
+ * @brief Send $0 transfers back to back for the given seconds and print how many committed in each second.
+ *        The per second lines are read by ./rejoin_test, keep their format stable.
+ *        ie. [bench] second: 12 committed: 1 leader: 0
+ * 
+ * @param client 
+ * @param seconds 
+ * @param recv_id the next client by default, pick one in the same shard to keep the transfers inside the shard.
+ * @param window the requests kept in flight, more than one makes the client busier than the others.
+ */
+void client_bench(Client* client, int seconds, uint32_t recv_id, int window) {
+    typedef std::chrono::system_clock sysclk;
+    auto t0 = sysclk::now();
+    std::vector<int> committed(seconds, 0);
+    int reported = 0;
+    uint64_t request_id = 1;
+    std::map<uint64_t, sysclk::time_point> in_flight;          // request id -> send time
+    sysclk::time_point backoff_until;                           // nothing new is sent before, the leader said it's busy
+    uint64_t latency_sum_ms = 0, latency_max_ms = 0;
+    int latency_count = 0;
+
+    while (true) {
+        int elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(sysclk::now() - t0).count();
+        // print the seconds that are over.
+        for (; reported < seconds && reported < elapsed_ms / 1000; reported++) {
+            std::cout << "[bench] second: " << reported << " committed: " << committed[reported] << " leader: " << client->get_leader_id() << std::endl;
+        }
+        if (elapsed_ms >= seconds * 1000) {
+            break;
+        }
+
+        // a request without a reply in time is lost, make room for a new one.
+        for (auto it = in_flight.begin(); it != in_flight.end();) {
+            if (std::chrono::duration_cast<std::chrono::milliseconds>(sysclk::now() - it->second).count() > CLIENT_REQ_TIMEOUT_MS)
+                it = in_flight.erase(it);
+            else
+                it++;
+        }
+        int leader_id = client->get_leader_id();
+        while (in_flight.size() < window && sysclk::now() >= backoff_until) {
+            client->get_network()->send_transaction(recv_id, 0, request_id);
+            in_flight[request_id++] = sysclk::now();
+        }
+        if (in_flight.empty()) {
+            std::this_thread::sleep_until(backoff_until);
+            continue;
+        }
+        response_t* response = client_wait_reply(client, CLIENT_REQ_TIMEOUT_MS);
+        if (response == NULL) {
+            // give up the requests in flight, resend right away if redirected, otherwise try the next server.
+            in_flight.clear();
+            if (client->get_leader_id() == leader_id) {
+                client->set_leader_id((leader_id + 1) % get_config().server_count);
+            }
+            continue;
+        }
+        // drop the late replies of the timed out requests.
+        auto it = in_flight.find(response->request_id);
+        if (it == in_flight.end()) {
+            delete response;
+            continue;
+        }
+        auto sent = it->second;
+        in_flight.erase(it);
+        if (response->type == SERVER_BUSY) {
+            // the leader is overloaded, back off before resending but keep waiting for the requests it took.
+            delete response;
+            backoff_until = sysclk::now() + std::chrono::milliseconds(CLIENT_BUSY_BACKOFF_MS);
+            continue;
+        }
+        auto now = sysclk::now();
+        uint64_t latency_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - sent).count();
+        elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - t0).count();
+        if (latency_ms > CLIENT_REQ_TIMEOUT_MS) {
+            // the interactive commands would have given up on it.
+            delete response;
+            continue;
+        }
+        if (response->type == TRANSACTION_RESPONSE && response->succeed && elapsed_ms < seconds * 1000) {
+            committed[elapsed_ms / 1000]++;
+            latency_sum_ms += latency_ms;
+            latency_max_ms = std::max(latency_max_ms, latency_ms);
+            latency_count++;
+        }
+        delete response;
+    }
+    std::cout << "[bench] latency ms mean: " << (latency_count ? latency_sum_ms / latency_count : 0) << " max: " << latency_max_ms << std::endl;
+    std::cout << "[bench] done" << std::endl;
+}
+
 int main (int argc, char* argv[]) {
-    if (argc != 2) {
+    if (argc != 2 && argc != 3) {
         print_usage();
         exit(1);
     }
+
+    if (!load_cluster_config((argc == 3) ? argv[2] : DEFAULT_CONFIG_FILE)) {
+        exit(1);
+    }
     
     int client_id = atoi(argv[1]);
-    if (client_id < 0 || client_id >= CLIENT_COUNT) {
+    if (client_id < 0 || client_id >= get_config().client_count) {
         std::cout << "Your input cid is out of the accepted range." << std::endl;
         print_usage();
         exit(1);
@@ -312,12 +417,22 @@ int main (int argc, char* argv[]) {
             float amount = atof(args[2].c_str());
             uint64_t request_id = 0;
             do {
+                int leader_id = client.get_leader_id();
                 client.get_network()->send_transaction(recv_id, amount, request_id);
                 auto response = client_wait_reply(&client, CLIENT_REQ_TIMEOUT_MS);
+                if (response == NULL && client.get_leader_id() != leader_id) {
+                    std::cout << "[main] redirected to leader: " << client.get_leader_id() << ", resending." << std::endl;
+                    continue;
+                }
                 if (response == NULL) {
                     std::cout << "[main] request timeout. please retry sending the request." << std::endl;
                     break;
                 }
+                if (response->type == SERVER_BUSY) {
+                    std::cout << "[main] server busy. please retry sending the request later." << std::endl;
+                    delete response;
+                    break;
+                }
                 // DEBUG: check the logic here
                 if (response->type != TRANSACTION_RESPONSE) {
                     std::cout << "[main] wrong response type received. clear response queue. please retry" << std::endl;
@@ -335,12 +450,22 @@ int main (int argc, char* argv[]) {
         else if (cmd.compare("balance") == 0 || cmd.compare("b") == 0 || cmd.compare("B") == 0) 
         {
             do {
+                int leader_id = client.get_leader_id();
                 client.get_network()->send_balance(0);
                 auto response = client_wait_reply(&client, CLIENT_REQ_TIMEOUT_MS);
+                if (response == NULL && client.get_leader_id() != leader_id) {
+                    std::cout << "[main] redirected to leader: " << client.get_leader_id() << ", resending." << std::endl;
+                    continue;
+                }
                 if (response == NULL) {
                     std::cout << "[main] request timeout. please retry sending the request." << std::endl;
                     break;
                 }
+                if (response->type == SERVER_BUSY) {
+                    std::cout << "[main] server busy. please retry sending the request later." << std::endl;
+                    delete response;
+                    break;
+                }
                 if (response->type != BALANCE_RESPONSE) {
                     std::cout << "[main] wrong response type received. clear response queue. please retry" << std::endl;
                     while (client.get_network()->response_queue_get_count()) {
@@ -356,6 +481,52 @@ int main (int argc, char* argv[]) {
                 break;
             } while (true);
         }
+        else if (cmd.compare("stale_balance") == 0 || cmd.compare("sb") == 0)
+        {
+            if (args.size() != 2) {
+                std::cout << "wrong format." << std::endl;
+                std::cout << "stale_balance <server_id>" << std::endl;
+                continue;
+            }
+            client.get_network()->send_stale_balance(atoi(args[1].c_str()), 0);
+            // a redirect doesn't matter here, the read goes to the chosen server anyway.
+            auto response = client_wait_reply(&client, CLIENT_REQ_TIMEOUT_MS);
+            if (response == NULL) {
+                response = client_wait_reply(&client, CLIENT_REQ_TIMEOUT_MS);
+            }
+            if (response == NULL) {
+                std::cout << "[main] request timeout. please retry sending the request." << std::endl;
+                continue;
+            }
+            if (response->type == SERVER_BUSY) {
+                std::cout << "[main] server busy. please retry sending the request later." << std::endl;
+                delete response;
+                continue;
+            }
+            if (response->type != BALANCE_RESPONSE) {
+                std::cout << "[main] wrong response type received. clear response queue. please retry" << std::endl;
+                while (client.get_network()->response_queue_get_count()) {
+                    client.get_network()->response_queue_pop();
+                }
+                continue;
+            }
+            std::cout << "[main] stale balance check status: " << ((response->succeed) ? "succeed" : "failed, the server lost the leader") << std::endl;
+            if (response->succeed) {
+                std::cout << "[main] balance amount: " << response->balance << std::endl;
+            }
+            delete response;
+        }
+        else if (cmd.compare("bench") == 0)
+        {
+            if (args.size() < 2 || args.size() > 4 || atoi(args[1].c_str()) <= 0 || (args.size() == 4 && atoi(args[3].c_str()) <= 0)) {
+                std::cout << "wrong format." << std::endl;
+                std::cout << "bench <seconds> [recv_id] [window]" << std::endl;
+                continue;
+            }
+            uint32_t recv_id = (args.size() >= 3) ? atoi(args[2].c_str()) : (client.get_client_id() + 1) % get_config().client_count;
+            int window = (args.size() == 4) ? atoi(args[3].c_str()) : 1;
+            client_bench(&client, atoi(args[1].c_str()), recv_id, window);
+        }
         else if (cmd.compare("p") == 0) // for debug only
         {
             while(client.get_network()->response_queue_get_count()) {
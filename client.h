@@ -2,9 +2,15 @@
 #include <thread>
 #include <stdint.h>
 #include <deque>
+#include <vector>
+#include <mutex>
+#include <memory>
 #include "parameter.h"
 #include "Msg.pb.h"
 #include "message.h"
+#include "config.h"
+#include "event_loop.h"
+#include "lockfree_queue.h"
 
 namespace RaftClient {
     class Network;
@@ -14,8 +20,7 @@ namespace RaftClient {
         bool connected;
         const int id;
         const int port;
-        int sock;
-        std::thread* recv_task;
+        std::shared_ptr<Connection> conn;
     };
 
     class Client {
@@ -38,20 +43,22 @@ namespace RaftClient {
         // client back reference.
         Client* client = NULL;
         
-        server_t servers[SERVER_COUNT] = {
-            {.connected = false, .id = 0, .port = SERVER_BASE_PORT + 0, .sock = 0, NULL},
-            {.connected = false, .id = 1, .port = SERVER_BASE_PORT + 1, .sock = 0, NULL},
-            {.connected = false, .id = 2, .port = SERVER_BASE_PORT + 2, .sock = 0, NULL}
-        };
+        // one entry for each of the server_count servers in the cluster config.
+        std::vector<server_t> servers;
 
-        std::mutex response_queue_lock;
-        std::deque<response_t*> response_queue;
+        // pushed by the loop thread, popped by the main thread.
+        MpscQueue<response_t*, RESPONSE_QUEUE_SIZE> response_queue;
+        QueueSignal response_signal;
+
+        // serves the server connections, recv_handler runs on its thread.
+        EventLoop loop;
 
         // threads declarations
         std::thread conn_thread;
         std::thread conn_recycle_thread;
         
         void send_message(request_msg_t &);
+        void send_message(request_msg_t &, uint32_t server_id);
         
         Client* get_client() {return client;};
 
@@ -61,8 +68,8 @@ namespace RaftClient {
         // thread function that free the dynamic thread pointer in each server_t after the conn is lost.
         void conn_recycle_handler();
 
-        // thread function listening to a sock after the connection is established.                
-        void recv_handler(int index);
+        // called by the loop for every message of a server after the connection is established.
+        void recv_handler(int index, const uint8_t* data, size_t size);
 
         void response_queue_push(response_t* response);
         
@@ -77,7 +84,13 @@ namespace RaftClient {
         // send balance to the estimated leader.
         void send_balance(uint64_t req_id);
 
+        // read the balance from the given server, a follower or learner answers if it heard from the leader recently.
+        void send_stale_balance(uint32_t server_id, uint64_t req_id);
+
         response_t* response_queue_pop();
         size_t response_queue_get_count();
+
+        // sleep up to timeout_ms, back as soon as a response or a leader change arrives.
+        void response_queue_wait(uint32_t timeout_ms);
     };
 }
\ No newline at end of file
@@ -0,0 +1,42 @@
+#include <ctime>
+#include "clock.h"
+
+static VirtualClock* virtual_clock = NULL;
+
+void set_virtual_clock(VirtualClock* clock) {
+    virtual_clock = clock;
+}
+
+bool clock_is_virtual() {
+    return virtual_clock != NULL;
+}
+
+std::chrono::system_clock::time_point clock_now() {
+    if (virtual_clock != NULL)
+        return virtual_clock->now();
+    return std::chrono::system_clock::now();
+}
+
+uint64_t clock_now_ms() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(clock_now().time_since_epoch()).count();
+}
+
+void clock_sleep_ms(uint32_t ms) {
+    if (virtual_clock != NULL) {
+        virtual_clock->sleep_ms(ms);
+        return;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+std::thread clock_thread(std::function<void()> task) {
+    if (virtual_clock != NULL)
+        return virtual_clock->spawn(task);
+    return std::thread(task);
+}
+
+uint32_t clock_seed() {
+    if (virtual_clock != NULL)
+        return virtual_clock->seed();
+    return time(NULL);
+}
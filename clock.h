@@ -0,0 +1,31 @@
+/**
+ * @file clock.h
+ * @brief the time, the sleeps, the threads and the random seed the servers run on.
+ *        It's the system clock unless a virtual clock is installed, ie. by the simulator (simulator.h)
+ *        which runs the threads one at a time in virtual time so a run only depends on its seed.
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include <chrono>
+#include <thread>
+#include <functional>
+#include <stdint.h>
+
+class VirtualClock {
+public:
+    virtual ~VirtualClock() {};
+    virtual std::chrono::system_clock::time_point now() = 0;
+    virtual void sleep_ms(uint32_t ms) = 0;
+    virtual std::thread spawn(std::function<void()> task) = 0;         // The thread runs under the clock, the caller joins it.
+    virtual uint32_t seed() = 0;
+};
+
+void set_virtual_clock(VirtualClock* clock);                            // NULL goes back to the system clock.
+bool clock_is_virtual();                                                // Only the clock's sleeps may block then.
+std::chrono::system_clock::time_point clock_now();
+uint64_t clock_now_ms();                                                // Milliseconds since the epoch.
+void clock_sleep_ms(uint32_t ms);
+std::thread clock_thread(std::function<void()> task);                   // Start a thread, it must be joined.
+uint32_t clock_seed();                                                  // Differs between runs unless the clock is virtual.
@@ -0,0 +1,202 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include "config.h"
+
+static cluster_config_t config;
+
+const cluster_config_t& get_config() {
+    return config;
+}
+
+void set_config(const cluster_config_t &new_config) {
+    config = new_config;
+}
+
+static bool parse_bool(const std::string &value) {
+    if (value == "true" || value == "1")
+        return true;
+    if (value == "false" || value == "0")
+        return false;
+    throw std::invalid_argument(value);
+}
+
+static replica_transport_t parse_replica_transport(const std::string &value) {
+    if (value == "direct")
+        return REPLICA_DIRECT;
+    if (value == "mesh")
+        return REPLICA_MESH;
+    throw std::invalid_argument(value);
+}
+
+static replica_link_t parse_replica_link(const std::string &value) {
+    if (value == "tcp")
+        return LINK_TCP;
+    if (value == "unix")
+        return LINK_UNIX;
+    if (value == "shm")
+        return LINK_SHM;
+    throw std::invalid_argument(value);
+}
+
+static std::string trim(const std::string &str) {
+    size_t first = str.find_first_not_of(" \t\r");
+    if (first == std::string::npos)
+        return "";
+    size_t last = str.find_last_not_of(" \t\r");
+    return str.substr(first, last - first + 1);
+}
+
+// comma separated server ids to a mask, bit i set for server i.
+static uint64_t parse_server_ids(const std::string &value) {
+    uint64_t mask = 0;
+    std::stringstream ss(value);
+    std::string id;
+    while (getline(ss, id, ',')) {
+        int server_id = std::stoi(trim(id));
+        if (server_id < 0 || server_id >= 64)
+            throw std::out_of_range(id);
+        mask |= 1ULL << server_id;
+    }
+    return mask;
+}
+
+/**
+ * @brief config file format, one "key = value" per line and '#' starts a comment.
+ *        ie. server_count = 5
+ * 
+ * @param filename 
+ * @return true if the file parsed successfully, or if it's the missing DEFAULT_CONFIG_FILE.
+ *         Any other file was asked for explicitly, the defaults would bring up the wrong cluster.
+ */
+bool load_cluster_config(const std::string &filename) {
+    std::ifstream file(filename);
+    if (!file.good() && filename == DEFAULT_CONFIG_FILE) {
+        std::cout << "[load_cluster_config] couldn't find " << filename << ", using the default " << config.server_count << " servers cluster." << std::endl;
+        return true;
+    }
+    if (!file.good()) {
+        std::cerr << "[load_cluster_config] couldn't open " << filename << std::endl;
+        return false;
+    }
+
+    cluster_config_t loaded;
+    bool voters_set = false;
+    std::string line;
+    int line_num = 0;
+    while (getline(file, line)) {
+        line_num++;
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty())
+            continue;
+        size_t eq = line.find('=');
+        if (eq == std::string::npos) {
+            std::cerr << "[load_cluster_config] line " << line_num << " is not \"key = value\": " << line << std::endl;
+            return false;
+        }
+        std::string key = trim(line.substr(0, eq));
+        std::string value = trim(line.substr(eq + 1));
+        try {
+            if (key == "server_count") loaded.server_count = std::stoi(value);
+            else if (key == "client_count") loaded.client_count = std::stoi(value);
+            else if (key == "shard_count") loaded.shard_count = std::stoi(value);
+            else if (key == "voters") {
+                loaded.initial_voters = parse_server_ids(value);
+                voters_set = true;
+            }
+            else if (key == "learners") loaded.initial_learners = parse_server_ids(value);
+            else if (key == "max_read_staleness_ms") loaded.max_read_staleness_ms = std::stoi(value);
+            else if (key == "election_timeout_ms") loaded.election_timeout_ms = std::stoi(value);
+            else if (key == "heartbeat_period_ms") loaded.heartbeat_period_ms = std::stoi(value);
+            else if (key == "phi_threshold") loaded.phi_threshold = std::stod(value);
+            else if (key == "prevote") loaded.prevote = parse_bool(value);
+            else if (key == "parallel_log_write") loaded.parallel_log_write = parse_bool(value);
+            else if (key == "disk_sync_delay_ms") loaded.disk_sync_delay_ms = std::stoi(value);
+            else if (key == "server_ip") loaded.server_ip = value;
+            else if (key == "server_base_port") loaded.server_base_port = std::stoi(value);
+            else if (key.compare(0, 10, "server_ip.") == 0) loaded.server_ips[std::stoi(key.substr(10))] = value;
+            else if (key == "client_ip") loaded.client_ip = value;
+            else if (key == "client_base_port") loaded.client_base_port = std::stoi(value);
+            else if (key == "client_port_mult") loaded.client_port_mult = std::stoi(value);
+            else if (key.compare(0, 14, "client_weight.") == 0) loaded.client_weights[std::stoi(key.substr(14))] = std::stoi(value);
+            else if (key == "mesh_ip") loaded.mesh_ip = value;
+            else if (key == "mesh_port") loaded.mesh_port = std::stoi(value);
+            else if (key == "replica_client_ip") loaded.replica_client_ip = value;
+            else if (key == "replica_client_base_port") loaded.replica_client_base_port = std::stoi(value);
+            else if (key == "replica_transport") loaded.replica_transport = parse_replica_transport(value);
+            else if (key == "replica_base_port") loaded.replica_base_port = std::stoi(value);
+            else if (key == "replica_link") loaded.replica_link = parse_replica_link(value);
+            else if (key == "link_dir") loaded.link_dir = value;
+            else if (key == "data_dir") loaded.data_dir = value;
+            else {
+                std::cerr << "[load_cluster_config] unknown key on line " << line_num << ": " << key << std::endl;
+                return false;
+            }
+        } catch (...) {
+            std::cerr << "[load_cluster_config] invalid value on line " << line_num << ": " << value << std::endl;
+            return false;
+        }
+    }
+
+    if (loaded.server_count < 1 || loaded.client_count < 1) {
+        std::cerr << "[load_cluster_config] server_count and client_count must be positive." << std::endl;
+        return false;
+    }
+    // the cross shard transaction ids keep the shard in 8 bits.
+    if (loaded.shard_count < 1 || loaded.shard_count > 256) {
+        std::cerr << "[load_cluster_config] shard_count must be between 1 and 256." << std::endl;
+        return false;
+    }
+    // the configuration entries in the log keep the voters as a 64 bits mask.
+    if (loaded.server_count > 64) {
+        std::cerr << "[load_cluster_config] at most 64 servers are supported." << std::endl;
+        return false;
+    }
+    uint64_t all_servers = loaded.all_servers();
+    if (!voters_set) {
+        loaded.initial_voters = all_servers;
+    } else if (loaded.initial_voters == 0 || (loaded.initial_voters & ~all_servers) != 0) {
+        std::cerr << "[load_cluster_config] voters must be a non-empty list of ids below server_count." << std::endl;
+        return false;
+    }
+    if ((loaded.initial_learners & ~all_servers) != 0 || (loaded.initial_learners & loaded.initial_voters) != 0) {
+        std::cerr << "[load_cluster_config] learners must be ids below server_count and not voters." << std::endl;
+        return false;
+    }
+    if (loaded.election_timeout_ms < 2 || loaded.heartbeat_period_ms < 1 || loaded.heartbeat_period_ms >= loaded.election_timeout_ms / 2) {
+        std::cerr << "[load_cluster_config] heartbeat_period_ms must be positive and below half of election_timeout_ms." << std::endl;
+        return false;
+    }
+    if (loaded.phi_threshold < 0) {
+        std::cerr << "[load_cluster_config] phi_threshold can't be negative." << std::endl;
+        return false;
+    }
+    for (auto &server_ip : loaded.server_ips) {
+        if (server_ip.first < 0 || server_ip.first >= loaded.server_count) {
+            std::cerr << "[load_cluster_config] server_ip." << server_ip.first << " is not an id below server_count." << std::endl;
+            return false;
+        }
+    }
+    for (auto &weight : loaded.client_weights) {
+        if (weight.first < 0 || weight.first >= loaded.client_count) {
+            std::cerr << "[load_cluster_config] client_weight." << weight.first << " is not an id below client_count." << std::endl;
+            return false;
+        }
+        if (weight.second < 1) {
+            std::cerr << "[load_cluster_config] client_weight." << weight.first << " must be positive." << std::endl;
+            return false;
+        }
+    }
+    // client id = (client_port - server_id - client_base_port) / client_port_mult
+    // only works if every server gets its own port offset within the multiplier.
+    if (loaded.client_port_mult < loaded.server_count) {
+        std::cerr << "[load_cluster_config] client_port_mult must be at least server_count." << std::endl;
+        return false;
+    }
+
+    config = loaded;
+    std::cout << "[load_cluster_config] loaded " << filename << ": " << config.server_count << " servers, ";
+    std::cout << config.client_count << " clients, " << config.shard_count << " shards, initial voters mask " << config.initial_voters << "." << std::endl;
+    return true;
+}
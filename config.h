@@ -0,0 +1,128 @@
+/**
+ * @file config.h
+ * @brief cluster topology shared by servers, clients and the mesh.
+ *        It is loaded from a config file at startup, the values in parameter.h are the defaults.
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#pragma once
+#include <string>
+#include <map>
+#include <stdint.h>
+#include "parameter.h"
+
+#define DEFAULT_CONFIG_FILE     "cluster.conf"
+
+// how the servers reach each other, "replica_transport = direct" or "mesh".
+enum replica_transport_t {
+    REPLICA_DIRECT,         // every server keeps a connection to every other server.
+    REPLICA_MESH,           // every message goes through the mesh, which delays it and can partition the servers.
+};
+
+// what carries the replica messages between the processes, "replica_link = tcp", "unix" or "shm".
+// The last two only work on one host, they skip the TCP stack of the kernel.
+enum replica_link_t {
+    LINK_TCP,
+    LINK_UNIX,              // a unix socket instead of every port.
+    LINK_SHM,               // a shared memory inbox instead of every port, see shm_link.h.
+};
+
+struct cluster_config_t {
+    int server_count = DEFAULT_SERVER_COUNT;
+    int client_count = DEFAULT_CLIENT_COUNT;
+
+    // every server process runs one raft group per shard, account <id> belongs to shard <id> % shard_count.
+    int shard_count = DEFAULT_SHARD_COUNT;
+
+    // bit i set if server i votes in the initial configuration, "voters = 0,1,2".
+    // servers left out start as non-voters and join through membership changes.
+    uint64_t initial_voters = (1ULL << DEFAULT_SERVER_COUNT) - 1;
+
+    // bit i set if server i is a learner, "learners = 3,4".
+    // learners get every entry but never vote or count toward the commit quorum, they serve stale reads.
+    uint64_t initial_learners = 0;
+
+    // a follower or learner answers a stale read only if it heard from the leader within this time.
+    int max_read_staleness_ms = MAX_READ_STALENESS_MS;
+
+    // a follower campaigns after hearing nothing for a random time between half of and the election timeout.
+    // the leader sends a heartbeat every heartbeat period, it has to be well below the election timeout.
+    int election_timeout_ms = ELECTION_TIMEOUT_MS;
+    int heartbeat_period_ms = HEARTBEAT_PERIOD_MS;
+
+    // a follower also suspects the leader once phi, how abnormal its silence is given the past intervals between
+    // its AppendEntries, passes this threshold. 0 leaves only the election timeout.
+    double phi_threshold = PHI_THRESHOLD;
+
+    // run a pre-vote round before starting an election, "prevote = false" turns it off.
+    bool prevote = true;
+
+    // the leader writes a new entry to its log file while it's being replicated and counts its own vote
+    // once the write is done, "parallel_log_write = false" writes it before sending the AppendEntries.
+    bool parallel_log_write = true;
+
+    // simulated time to sync every log write to disk, 0 for no delay.
+    int disk_sync_delay_ms = DISK_SYNC_DELAY_MS;
+
+    // servers information that the client connects to
+    std::string server_ip = SERVER_IP;
+    int server_base_port = SERVER_BASE_PORT;
+    std::map<int, std::string> server_ips;                  // per server overrides of server_ip, "server_ip.<id> = <ip>"
+
+    // clients information
+    std::string client_ip = CLIENT_IP;
+    int client_base_port = CLIENT_BASE_PORT;
+    int client_port_mult = CLIENT_PORT_MULT;
+    std::map<int, int> client_weights;                      // share of the leader's queue, "client_weight.<id> = <n>", 1 if not set
+
+    int client_weight(int client_id) const {
+        auto it = client_weights.find(client_id);
+        return (it == client_weights.end()) ? 1 : it->second;
+    }
+
+    // network simulator information
+    std::string mesh_ip = MESH_IP;
+    int mesh_port = MESH_PORT;
+
+    // replica sites bind to the following ip and port when connecting to the mesh
+    std::string replica_client_ip = REPLICA_CLIENT_IP;
+    int replica_client_base_port = REPLICA_CLIENT_BASE_PORT;
+
+    // the servers connect to each other directly unless the mesh is chosen.
+    // server <id> then listens for the servers with a higher id on its server ip and replica_base_port + <id>.
+    replica_transport_t replica_transport = REPLICA_DIRECT;
+    int replica_base_port = REPLICA_BASE_PORT;
+
+    // the links between the servers, or the servers and the mesh. The clients always connect over TCP.
+    replica_link_t replica_link = LINK_TCP;
+    std::string link_dir = LINK_DIR;                        // directory of the unix sockets
+
+    std::string link_path(int port) const {return link_dir + "/raft_" + std::to_string(port) + ".sock";}
+
+    const std::string& get_server_ip(int server_id) const {
+        auto it = server_ips.find(server_id);
+        return (it == server_ips.end()) ? server_ip : it->second;
+    }
+
+    // directory of the log and balance files, the working directory if empty.
+    std::string data_dir;
+
+    int shard_of(uint32_t account) const {return account % shard_count;}
+    uint64_t all_servers() const {return (server_count == 64) ? ~0ULL : (1ULL << server_count) - 1;}
+
+    // bc_file_<id>.txt with a single shard, bc_file_<id>_<shard>.txt otherwise.
+    std::string shard_file(const std::string &prefix, int server_id, int shard_id) const {
+        std::string name = prefix + "_" + std::to_string(server_id);
+        if (!data_dir.empty())
+            name = data_dir + "/" + name;
+        if (shard_count > 1)
+            name += "_" + std::to_string(shard_id);
+        return name + ".txt";
+    }
+};
+
+// Load the config file. A missing file keeps the defaults, a malformed one returns false.
+bool load_cluster_config(const std::string &filename = DEFAULT_CONFIG_FILE);
+const cluster_config_t& get_config();
+void set_config(const cluster_config_t &new_config);       // Replace the loaded config, ie. in the simulator.
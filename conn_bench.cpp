@@ -0,0 +1,222 @@
+/**
+ * @file conn_bench.cpp
+ * @brief measures how an echo server scales with the number of client connections, served by one event loop
+ *        (event_loop.h) or by a thread per connection like the servers, the mesh and the client used to.
+ *        Every connection keeps one 64 byte frame in flight, the client side always runs on one event loop.
+ *        For every connection count it prints the round trips per second and the threads of the process.
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstdlib>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include "event_loop.h"
+
+const char* usage = "Run the program by typing ./conn_bench [seconds] [connections ...], ie. ./conn_bench 2 1 10 100 1000";
+
+const size_t FRAME_BYTES = 64;
+
+struct bench_result_t {
+    int connected = 0;
+    uint64_t round_trips = 0;
+    int threads = 0;                // of the whole process, sampled in the middle of the run.
+};
+
+int process_threads() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 8, "Threads:") == 0) {
+            return atoi(line.c_str() + 8);
+        }
+    }
+    return -1;
+}
+
+int listen_any_port(uint16_t &port) {
+    int sock = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr = {0};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+    addr.sin_port = 0;
+    socklen_t addr_size = sizeof(addr);
+    if (bind(sock, (sockaddr*) &addr, sizeof(addr)) < 0 || listen(sock, SOMAXCONN) < 0
+            || getsockname(sock, (sockaddr*) &addr, &addr_size) < 0) {
+        std::cerr << "[conn_bench] failed to listen." << std::endl;
+        exit(1);
+    }
+    port = ntohs(addr.sin_port);
+    return sock;
+}
+
+bool read_full(int sock, char* buf, size_t size) {
+    size_t done = 0;
+    while (done < size) {
+        ssize_t count = read(sock, buf + done, size - done);
+        if (count <= 0) {
+            return false;
+        }
+        done += count;
+    }
+    return true;
+}
+
+bool write_full(int sock, const char* buf, size_t size) {
+    size_t done = 0;
+    while (done < size) {
+        ssize_t count = send(sock, buf + done, size - done, MSG_NOSIGNAL);
+        if (count <= 0) {
+            return false;
+        }
+        done += count;
+    }
+    return true;
+}
+
+// the thread of one connection of the thread per connection server.
+void echo_handler(int sock) {
+    std::vector<char> frame;
+    while (true) {
+        COMM_HEADER_TYPE msg_bytes = 0;
+        if (!read_full(sock, (char*) &msg_bytes, sizeof(msg_bytes))) {
+            break;
+        }
+        // echo the header and the body with one write, like the event loop, so Nagle doesn't hold the body back.
+        frame.resize(sizeof(msg_bytes) + ntohl(msg_bytes));
+        memcpy(frame.data(), &msg_bytes, sizeof(msg_bytes));
+        if (!read_full(sock, frame.data() + sizeof(msg_bytes), frame.size() - sizeof(msg_bytes)) || !write_full(sock, frame.data(), frame.size())) {
+            break;
+        }
+    }
+    close(sock);
+}
+
+bench_result_t run_bench(bool reactor, int connections, int seconds) {
+    bench_result_t result;
+    uint16_t port = 0;
+    int listen_sock = listen_any_port(port);
+
+    // the server side.
+    EventLoop* server_loop = NULL;
+    std::vector<std::thread> echo_threads;
+    std::thread accept_thread;
+    std::atomic<bool> stop_flag(false);
+    if (reactor) {
+        server_loop = new EventLoop();
+        server_loop->listen(listen_sock, [server_loop](int sock, const sockaddr_in &addr) {
+            // the loop runs the handlers, the frames can't come before the connection is known.
+            auto self = std::make_shared<std::weak_ptr<Connection>>();
+            *self = server_loop->attach(sock, [self](const uint8_t* data, size_t size) {
+                std::shared_ptr<Connection> conn = self->lock();
+                if (conn != NULL) {
+                    conn->send_frame(data, size);
+                }
+            }, NULL);
+        });
+    } else {
+        accept_thread = std::thread([&]() {
+            for (int i = 0; i < connections; i++) {
+                int sock = accept(listen_sock, NULL, NULL);
+                if (sock < 0) {
+                    break;
+                }
+                echo_threads.push_back(std::thread(echo_handler, sock));
+            }
+        });
+    }
+
+    // the client side, every echoed frame is sent again until the end of the run.
+    EventLoop* client_loop = new EventLoop();
+    std::atomic<uint64_t> round_trips(0);
+    std::string frame(FRAME_BYTES, 'x');
+    std::vector<std::shared_ptr<Connection>> conns;
+    for (int i = 0; i < connections; i++) {
+        int sock = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr = {0};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+        addr.sin_port = htons(port);
+        if (connect(sock, (sockaddr*) &addr, sizeof(addr)) < 0) {
+            std::cerr << "[conn_bench] failed to connect, " << i << " connected." << std::endl;
+            close(sock);
+            break;
+        }
+        auto self = std::make_shared<std::weak_ptr<Connection>>();
+        std::shared_ptr<Connection> conn = client_loop->attach(sock, [self, &round_trips, &stop_flag](const uint8_t* data, size_t size) {
+            round_trips++;
+            std::shared_ptr<Connection> conn = self->lock();
+            if (!stop_flag && conn != NULL) {
+                conn->send_frame(data, size);
+            }
+        }, NULL);
+        if (conn == NULL) {
+            break;
+        }
+        *self = conn;
+        conns.push_back(conn);
+    }
+    result.connected = conns.size();
+
+    auto start = std::chrono::steady_clock::now();
+    for (auto &conn : conns) {
+        conn->send_frame(frame);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(seconds * 500));
+    result.threads = process_threads();
+    std::this_thread::sleep_until(start + std::chrono::seconds(seconds));
+    result.round_trips = round_trips;
+    stop_flag = true;
+
+    // closing the client connections ends the server side.
+    delete client_loop;
+    conns.clear();
+    if (reactor) {
+        delete server_loop;
+    } else {
+        shutdown(listen_sock, SHUT_RDWR);
+        accept_thread.join();
+        for (auto &thread : echo_threads) {
+            thread.join();
+        }
+    }
+    close(listen_sock);
+    return result;
+}
+
+int main(int argc, char* argv[]) {
+    int seconds = (argc > 1) ? atoi(argv[1]) : 2;
+    if (seconds < 1) {
+        std::cout << usage << std::endl;
+        exit(1);
+    }
+    std::vector<int> counts;
+    for (int i = 2; i < argc; i++) {
+        counts.push_back(atoi(argv[i]));
+    }
+    if (counts.empty()) {
+        counts = {1, 10, 100, 1000};
+    }
+
+    for (int reactor = 1; reactor >= 0; reactor--) {
+        for (int connections : counts) {
+            if (connections < 1) {
+                continue;
+            }
+            bench_result_t result = run_bench(reactor, connections, seconds);
+            std::cout << "[conn_bench] " << (reactor ? "event loop" : "thread per connection") << " connections: " << result.connected;
+            std::cout << " round trips/s: " << result.round_trips / seconds << " threads: " << result.threads << std::endl;
+        }
+    }
+    return 0;
+}
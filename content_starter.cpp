@@ -3,10 +3,16 @@
 #include "blockchain.h"
 #include "balance_table.h"
 #include "Msg.pb.h"
+#include "config.h"
 
 using namespace std;
 
-int main() {
+int main(int argc, char* argv[]) {
+    // usage: ./starter [config_file]
+    if (!load_cluster_config((argc == 2) ? argv[1] : DEFAULT_CONFIG_FILE)) {
+        exit(1);
+    }
+
     // This is a initial txn
     Transaction t(true);
     Block b(0, t);
@@ -23,44 +29,24 @@ int main() {
     block_msg.set_index(b.get_index());
     std::string block_str = block_msg.SerializeAsString();
 
-    // Create an bc_file_0 on disk
-    string filename0a = "bc_file_0.txt";
-    std::ofstream outfile0a(filename0a);
-    outfile0a << "-0001\n";
-    // Write initial txn to bc
-    // outfile0a << block_str << endl;
-    outfile0a.close();
-    // Create a bal_tab_file_1 on disk
-    string filename0b = "bal_tab_0.txt";
-    std::ofstream outfile0b(filename0b);
-    outfile0b << "10 10 10 " << endl;
-    outfile0b.close();
-
-
-     // Create an bc_file_1 on disk
-    string filename1a = "bc_file_1.txt";
-    std::ofstream outfile1a(filename1a);
-    outfile1a << "-0001\n";
-    // Write initial txn to bc
-    // outfile1a << block_str << endl;
-    outfile1a.close();
-     // Create a bal_tab_file_1 on disk
-    string filename1b = "bal_tab_1.txt";
-    std::ofstream outfile1b(filename1b);
-    outfile1b << "10 10 10 " << endl;
-    outfile1b.close();
-
-    // Create an bc_file_2 on disk
-    string filename2a = "bc_file_2.txt";
-    std::ofstream outfile2a(filename2a);
-    outfile2a << "-0001\n";
-    // Write initial txn to bc
-    // outfile2a << block_str << endl;
-    outfile2a.close();
-     // Create a bal_tab_file_2 on disk
-    string filename2b = "bal_tab_2.txt";
-    std::ofstream outfile2b(filename2b);
-    outfile2b << "10 10 10 " << endl;
-    outfile2b.close();
+    // Create an bc_file_<id> and a bal_tab_<id> on disk for every server and shard in the cluster config
+    for (int id = 0; id < get_config().server_count; id++) {
+        for (int shard_id = 0; shard_id < get_config().shard_count; shard_id++) {
+            string filename_a = get_config().shard_file("bc_file", id, shard_id);
+            std::ofstream outfile_a(filename_a);
+            outfile_a << "-0001\n";
+            // Write initial txn to bc
+            // outfile_a << block_str << endl;
+            outfile_a.close();
+            // Create a bal_tab_<id> on disk, every client starts with 10
+            string filename_b = get_config().shard_file("bal_tab", id, shard_id);
+            std::ofstream outfile_b(filename_b);
+            for (int cid = 0; cid < get_config().client_count; cid++) {
+                outfile_b << "10 ";
+            }
+            outfile_b << endl << -1 << endl;
+            outfile_b.close();
+        }
+    }
 
 }
\ No newline at end of file
@@ -0,0 +1,417 @@
+#include <iostream>
+#include <algorithm>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include "event_loop.h"
+
+static bool set_non_blocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) >= 0;
+}
+
+Connection::Connection(EventLoop* loop, int fd, frame_handler_t on_frame, close_handler_t on_close)
+    : loop(loop), fd(fd), open(true), on_frame(on_frame), on_close(on_close) {}
+
+Connection::~Connection() {
+    ::close(fd);
+}
+
+/**
+ * @brief send a frame of bytes owned by the caller. If nothing is queued, the header and the body go out with
+ *        one writev() and only what the socket doesn't take is copied to the queue.
+ *
+ * @param body
+ * @param size
+ * @return false if the connection is closed
+ */
+bool Connection::send_frame(const uint8_t* body, size_t size) {
+    if (!open) {
+        return false;
+    }
+    COMM_HEADER_TYPE header = htonl(size);
+    size_t frame_bytes = sizeof(header) + size;
+    std::lock_guard<std::mutex> lock(out_mutex);
+    size_t sent = 0;
+    if (out_head == out_buf.size() && corked == 0 && !flush_deferred && !loop->in_loop_thread()) {
+        iovec iov[2] = {{&header, sizeof(header)}, {(void*) body, size}};
+        while (true) {
+            ssize_t count = writev(fd, iov, 2);
+            if (count < 0 && errno == EINTR) {
+                continue;
+            }
+            if (count < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+                // the loop sees the broken socket and runs the close handler.
+                shutdown(fd, SHUT_RDWR);
+                return false;
+            }
+            sent = std::max<ssize_t>(count, 0);
+            break;
+        }
+        if (sent == frame_bytes) {
+            return true;
+        }
+    }
+    // queue the part of the frame not sent.
+    size_t offset = out_buf.size();
+    out_buf.resize(offset + frame_bytes - sent);
+    uint8_t* target = out_buf.data() + offset;
+    if (sent < sizeof(header)) {
+        memcpy(target, (const uint8_t*) &header + sent, sizeof(header) - sent);
+        target += sizeof(header) - sent;
+        memcpy(target, body, size);
+    } else {
+        memcpy(target, body + sent - sizeof(header), frame_bytes - sent);
+    }
+    return queued();
+}
+
+bool Connection::send_serialized(size_t size, const std::function<void(uint8_t*)> &serialize, const uint8_t* prefix, size_t prefix_size) {
+    if (!open) {
+        return false;
+    }
+    COMM_HEADER_TYPE header = htonl(prefix_size + size);
+    std::lock_guard<std::mutex> lock(out_mutex);
+    size_t offset = out_buf.size();
+    out_buf.resize(offset + sizeof(header) + prefix_size + size);
+    memcpy(out_buf.data() + offset, &header, sizeof(header));
+    if (prefix_size > 0) {
+        memcpy(out_buf.data() + offset + sizeof(header), prefix, prefix_size);
+    }
+    serialize(out_buf.data() + offset + sizeof(header) + prefix_size);
+    return queued();
+}
+
+void Connection::cork() {
+    std::lock_guard<std::mutex> lock(out_mutex);
+    corked++;
+}
+
+void Connection::uncork() {
+    std::lock_guard<std::mutex> lock(out_mutex);
+    if (--corked == 0) {
+        queued();
+    }
+}
+
+bool Connection::queued() {
+    if (corked > 0 || write_waiting || flush_deferred) {
+        return true;
+    }
+    if (loop->in_loop_thread()) {
+        // the handlers of the round may send more, they all go out together.
+        flush_deferred = true;
+        loop->deferred_flushes.push_back(shared_from_this());
+        return true;
+    }
+    return flush();
+}
+
+bool Connection::flush() {
+    while (out_head < out_buf.size()) {
+        ssize_t count = send(fd, out_buf.data() + out_head, out_buf.size() - out_head, MSG_NOSIGNAL);
+        if (count > 0) {
+            out_head += count;
+        } else if (count < 0 && errno == EINTR) {
+            continue;
+        } else if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        } else {
+            // the loop sees the broken socket and runs the close handler.
+            shutdown(fd, SHUT_RDWR);
+            out_buf.clear();
+            out_head = 0;
+            return false;
+        }
+    }
+    if (out_head < out_buf.size()) {
+        if (!write_waiting) {
+            write_waiting = true;
+            loop->watch_write(this, true);
+        }
+        return true;
+    }
+    out_buf.clear();
+    out_head = 0;
+    if (out_buf.capacity() > 4 * FRAME_BUFFER_BYTES) {
+        // give back the room of a burst.
+        std::vector<uint8_t>().swap(out_buf);
+    }
+    if (write_waiting) {
+        write_waiting = false;
+        loop->watch_write(this, false);
+    }
+    return true;
+}
+
+void Connection::close() {
+    if (open.exchange(false)) {
+        shutdown(fd, SHUT_RDWR);
+    }
+}
+
+/**
+ * @brief read everything the socket holds, every read goes straight into the frame buffer and
+ *        the frames it completes are handed over in place before the next read.
+ *
+ * @return false once the peer closed, the socket failed or a frame is too long
+ */
+bool Connection::handle_read() {
+    while (true) {
+        // write_ptr() makes the room, the space is only known after it.
+        uint8_t* target = in_buf.write_ptr();
+        size_t space = in_buf.write_space();
+        ssize_t count = read(fd, target, space);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            // 0 is the end of the stream, anything but EAGAIN a broken socket.
+            return count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+        }
+        in_buf.commit(count);
+        const uint8_t* data = NULL;
+        size_t size = 0;
+        while (in_buf.next_frame(data, size)) {
+            on_frame(data, size);
+        }
+        if (in_buf.is_broken()) {
+            std::cerr << "[Connection::handle_read] a frame is longer than " << MAX_FRAME_BYTES << " bytes, closing." << std::endl;
+            return false;
+        }
+        if (count < space) {
+            // the socket is drained, the loop calls again when more comes.
+            return true;
+        }
+    }
+}
+
+bool Connection::handle_write() {
+    std::lock_guard<std::mutex> lock(out_mutex);
+    return flush();
+}
+
+void Connection::handle_deferred_flush() {
+    std::lock_guard<std::mutex> lock(out_mutex);
+    flush_deferred = false;
+    if (corked == 0 && !write_waiting) {
+        flush();
+    }
+}
+
+EventLoop::EventLoop() : stop_flag(false) {
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epoll_fd < 0 || wake_fd < 0) {
+        std::cerr << "[EventLoop::EventLoop] failed to create the epoll instance." << std::endl;
+        exit(1);
+    }
+    epoll_event event = {0};
+    event.events = EPOLLIN;
+    event.data.fd = wake_fd;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_fd, &event);
+    thread = std::thread(&EventLoop::run, this);
+}
+
+EventLoop::~EventLoop() {
+    stop();
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &entry : connections) {
+        entry.second->open = false;
+    }
+    connections.clear();
+    close(wake_fd);
+    close(epoll_fd);
+}
+
+std::shared_ptr<Connection> EventLoop::attach(int fd, Connection::frame_handler_t on_frame, Connection::close_handler_t on_close) {
+    if (!set_non_blocking(fd)) {
+        std::cerr << "[EventLoop::attach] failed to make socket " << fd << " non-blocking." << std::endl;
+        close(fd);
+        return NULL;
+    }
+    // the frames are batched by the queue, Nagle would only delay them.
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    std::shared_ptr<Connection> conn = std::make_shared<Connection>(this, fd, on_frame, on_close);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        connections[fd] = conn;
+    }
+    epoll_event event = {0};
+    event.events = EPOLLIN | EPOLLRDHUP;
+    event.data.fd = fd;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) < 0) {
+        std::cerr << "[EventLoop::attach] failed to watch socket " << fd << std::endl;
+        std::lock_guard<std::mutex> lock(mutex);
+        connections.erase(fd);
+        conn->open = false;
+        return NULL;
+    }
+    return conn;
+}
+
+bool EventLoop::listen(int listen_fd, accept_handler_t on_accept) {
+    if (!set_non_blocking(listen_fd)) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        listeners[listen_fd] = on_accept;
+    }
+    epoll_event event = {0};
+    event.events = EPOLLIN;
+    event.data.fd = listen_fd;
+    return epoll_ctl(epoll_fd, EPOLL_CTL_ADD, listen_fd, &event) == 0;
+}
+
+void EventLoop::run_after(uint32_t ms, task_t task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        timers.emplace(clock_t::now() + std::chrono::milliseconds(ms), task);
+    }
+    wake();
+}
+
+void EventLoop::stop() {
+    if (!thread.joinable()) {
+        return;
+    }
+    stop_flag = true;
+    wake();
+    thread.join();
+}
+
+void EventLoop::wake() {
+    uint64_t one = 1;
+    write(wake_fd, &one, sizeof(one));
+}
+
+void EventLoop::run() {
+    epoll_event events[EVENT_LOOP_MAX_EVENTS];
+    while (!stop_flag) {
+        int count = epoll_wait(epoll_fd, events, EVENT_LOOP_MAX_EVENTS, next_timeout_ms());
+        if (count < 0 && errno != EINTR) {
+            std::cerr << "[EventLoop::run] epoll_wait failed: " << strerror(errno) << std::endl;
+            break;
+        }
+        for (int i = 0; i < count; i++) {
+            int fd = events[i].data.fd;
+            if (fd == wake_fd) {
+                uint64_t value;
+                read(wake_fd, &value, sizeof(value));
+                continue;
+            }
+            std::shared_ptr<Connection> conn;
+            accept_handler_t on_accept;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                auto it = connections.find(fd);
+                if (it != connections.end()) {
+                    conn = it->second;
+                } else if (listeners.count(fd)) {
+                    on_accept = listeners[fd];
+                }
+            }
+            if (on_accept) {
+                handle_accept(fd, on_accept);
+                continue;
+            }
+            if (conn == NULL) {
+                continue;
+            }
+            bool alive = true;
+            if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+                alive = conn->handle_read();
+            }
+            if (alive && (events[i].events & EPOLLOUT)) {
+                alive = conn->handle_write();
+            }
+            if (!alive) {
+                detach(fd);
+            }
+        }
+        run_due_timers();
+        // one send for everything the handlers of the round queued on a connection.
+        std::vector<std::shared_ptr<Connection>> flushes;
+        flushes.swap(deferred_flushes);
+        for (auto &conn : flushes) {
+            conn->handle_deferred_flush();
+        }
+    }
+}
+
+int EventLoop::next_timeout_ms() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (timers.empty()) {
+        return -1;
+    }
+    auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(timers.begin()->first - clock_t::now());
+    // round up, waking up a little early only spins the loop once more.
+    return std::max<int64_t>(0, wait.count() + 1);
+}
+
+void EventLoop::run_due_timers() {
+    while (true) {
+        task_t task;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (timers.empty() || timers.begin()->first > clock_t::now()) {
+                return;
+            }
+            task = timers.begin()->second;
+            timers.erase(timers.begin());
+        }
+        task();
+    }
+}
+
+void EventLoop::handle_accept(int listen_fd, accept_handler_t &on_accept) {
+    while (true) {
+        sockaddr_in addr = {0};
+        socklen_t addr_size = sizeof(addr);
+        int fd = accept(listen_fd, (sockaddr*) &addr, &addr_size);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                std::cerr << "[EventLoop::handle_accept] failed to accept: " << strerror(errno) << std::endl;
+            }
+            return;
+        }
+        on_accept(fd, addr);
+    }
+}
+
+void EventLoop::detach(int fd) {
+    std::shared_ptr<Connection> conn;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = connections.find(fd);
+        if (it == connections.end()) {
+            return;
+        }
+        conn = it->second;
+        connections.erase(it);
+    }
+    epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+    conn->open = false;
+    if (conn->on_close) {
+        conn->on_close();
+    }
+}
+
+void EventLoop::watch_write(Connection* conn, bool on) {
+    epoll_event event = {0};
+    event.events = EPOLLIN | EPOLLRDHUP | (on ? EPOLLOUT : 0);
+    event.data.fd = conn->fd;
+    epoll_ctl(epoll_fd, EPOLL_CTL_MOD, conn->fd, &event);
+}
@@ -0,0 +1,109 @@
+/**
+ * @file event_loop.h
+ * @brief the epoll reactor shared by the server, the client and the mesh. One thread serves every
+ *        listening socket and connection of the process, instead of a thread per connection.
+ *        The sockets are non-blocking, the frames are a COMM_HEADER_TYPE length in network order then the body.
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include <map>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <string>
+#include <chrono>
+#include <functional>
+#include <atomic>
+#include <stdint.h>
+#include <netinet/in.h>
+#include "parameter.h"
+#include "framing.h"
+#include "link.h"
+
+class EventLoop;
+
+// a connected socket served by an EventLoop. The frame and close handlers run on the loop thread,
+// the sends, cork and close can be called from any thread.
+// The frames sent are queued in one reusable buffer and flushed with one send() as a batch: right away,
+// at the end of the loop round if sent from the loop thread, or on uncork() if the connection is corked.
+class Connection : public Link, public std::enable_shared_from_this<Connection> {
+public:
+    typedef std::function<void(const uint8_t* data, size_t size)> frame_handler_t;
+    typedef std::function<void()> close_handler_t;
+
+    Connection(EventLoop* loop, int fd, frame_handler_t on_frame, close_handler_t on_close);
+    ~Connection();                                                      // Closes the socket.
+
+    int get_fd() {return fd;};
+    bool is_open() override {return open;};
+    using Link::send_frame;
+    bool send_frame(const uint8_t* body, size_t size) override;         // false if the connection is closed.
+    void cork() override;
+    void uncork() override;
+    void close() override;                                              // The close handler runs on the loop thread.
+
+private:
+    friend class EventLoop;
+    EventLoop* loop;
+    int fd;
+    std::atomic<bool> open;
+    frame_handler_t on_frame;
+    close_handler_t on_close;
+
+    FrameBuffer in_buf;                                                 // Received frames, loop thread only.
+    std::mutex out_mutex;                                               // lock of the members below.
+    std::vector<uint8_t> out_buf;                                       // Queued frames, the capacity is kept between the batches.
+    size_t out_head = 0;                                                // The first byte of out_buf not sent yet.
+    int corked = 0;
+    bool write_waiting = false;                                         // The socket is full, the loop flushes once it's writable.
+    bool flush_deferred = false;                                        // The loop flushes at the end of its round.
+
+    bool send_serialized(size_t size, const std::function<void(uint8_t*)> &serialize, const uint8_t* prefix = NULL, size_t prefix_size = 0) override;
+    bool queued();                                                      // Flush the queue now or leave it to the loop, out_mutex held.
+    bool flush();                                                       // Send as much of the queue as the socket takes, out_mutex held.
+    bool handle_read();                                                 // false once the peer closed or the socket failed.
+    bool handle_write();
+    void handle_deferred_flush();
+};
+
+class EventLoop {
+public:
+    typedef std::function<void(int fd, const sockaddr_in &addr)> accept_handler_t;
+    typedef std::function<void()> task_t;
+
+    EventLoop();
+    ~EventLoop();                                                       // Stops the thread and closes every connection.
+
+    // the socket becomes non-blocking and is served by the loop until it's closed. It's closed right away if it can't be served.
+    std::shared_ptr<Connection> attach(int fd, Connection::frame_handler_t on_frame, Connection::close_handler_t on_close);
+    bool listen(int listen_fd, accept_handler_t on_accept);             // Accepted sockets are handed over blocking, attach them.
+    void run_after(uint32_t ms, task_t task);                           // Run the task on the loop thread, tasks due at the same time run in order.
+    void stop();
+    bool in_loop_thread() {return std::this_thread::get_id() == thread.get_id();};
+
+private:
+    typedef std::chrono::steady_clock clock_t;
+    int epoll_fd;
+    int wake_fd;                                                        // eventfd, wakes the loop up for a new task.
+    std::atomic<bool> stop_flag;
+    std::thread thread;
+
+    std::mutex mutex;                                                   // lock of the maps below.
+    std::map<int, std::shared_ptr<Connection>> connections;             // indexed by fd
+    std::map<int, accept_handler_t> listeners;                          // indexed by fd
+    std::multimap<clock_t::time_point, task_t> timers;
+    std::vector<std::shared_ptr<Connection>> deferred_flushes;          // Loop thread only.
+
+    void run();
+    int next_timeout_ms();                                              // -1 if there's no timer.
+    void run_due_timers();
+    void handle_accept(int listen_fd, accept_handler_t &on_accept);
+    void detach(int fd);                                                // Remove the connection and run its close handler.
+    void watch_write(Connection* conn, bool on);                        // Wait for the socket to be writable, or stop.
+    void wake();
+
+    friend class Connection;
+};
@@ -0,0 +1,182 @@
+/**
+ * @file failover.cpp
+ * @brief measures how long a shard is unavailable after it loses its leader, in the simulator.
+ *        Every trial waits for a leader and a committed transfer, then kills or partitions the leader
+ *        and measures the time until another server leads and until a transfer sent after the
+ *        failure commits. The distributions are printed for every election timeout / heartbeat period.
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <iostream>
+#include <sstream>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include "simulator.h"
+
+const char* usage = "Run the program by typing ./failover [trials] [config_file] [election_timeout_ms/heartbeat_period_ms ...], ie. ./failover 20 cluster.conf 10000/2000 3000/500";
+
+const uint32_t POLL_MS = 10;
+
+struct trial_result_t {
+    bool started = false;           // a leader was elected and a transfer committed before the failure.
+    int64_t leader_ms = -1;         // -1 if no other server took over in time.
+    int64_t write_ms = -1;          // -1 if no transfer sent after the failure committed in time.
+    term_t elections = 0;           // terms started until the new leader won.
+};
+
+bool committed_since(Simulator &sim, uint64_t since_ms, uint64_t &commit_ms) {
+    bool found = false;
+    for (int client_id = 0; client_id < sim.client_count(); client_id++) {
+        sim_client_t* client = sim.get_client(client_id);
+        if (get_config().shard_of(client_id) == 0 && client->committed > 0 && client->last_sent_ms >= since_ms) {
+            commit_ms = found ? std::min(commit_ms, client->last_commit_ms) : client->last_commit_ms;
+            found = true;
+        }
+    }
+    return found;
+}
+
+trial_result_t run_trial(uint32_t seed, bool kill) {
+    trial_result_t result;
+    sim_options_t options;
+    options.seed = seed;
+    options.clients = get_config().client_count;
+    options.jitter_ms = MESH_NETWORK_DELAY_MS / 10;
+    Simulator sim(options);
+    uint32_t limit_ms = 10 * get_config().election_timeout_ms + CLIENT_REQ_TIMEOUT_MS;
+
+    // wait for the first leader of shard 0 and a committed transfer.
+    uint64_t start_ms = sim.now_ms();
+    uint64_t commit_ms = 0;
+    while (sim.leader(0) == -1 || !committed_since(sim, start_ms, commit_ms)) {
+        if (sim.now_ms() - start_ms > limit_ms) {
+            return result;
+        }
+        sim.run_for(POLL_MS);
+    }
+    result.started = true;
+    // don't fail right after a heartbeat every time.
+    sim.run_for(seed * 7919 % get_config().heartbeat_period_ms);
+
+    int old_leader = sim.leader(0);
+    if (old_leader == -1) {
+        result.started = false;
+        return result;
+    }
+    term_t old_term = sim.get_server(old_leader, 0)->get_curr_term();
+    uint64_t fail_ms = sim.now_ms();
+    if (kill) {
+        sim.kill(old_leader);
+    } else {
+        sim.partition_toggle(old_leader);
+    }
+    while (sim.now_ms() - fail_ms < limit_ms && (result.leader_ms == -1 || result.write_ms == -1)) {
+        sim.run_for(POLL_MS);
+        int leader_id = sim.leader(0);
+        if (result.leader_ms == -1 && leader_id != -1 && leader_id != old_leader) {
+            result.leader_ms = sim.now_ms() - fail_ms;
+            result.elections = sim.get_server(leader_id, 0)->get_curr_term() - old_term;
+        }
+        if (result.write_ms == -1 && committed_since(sim, fail_ms, commit_ms)) {
+            result.write_ms = commit_ms - fail_ms;
+        }
+    }
+    return result;
+}
+
+void print_distribution(const std::string &name, std::vector<int64_t> samples, int missing) {
+    std::cout << "  " << name << " ms";
+    if (samples.empty()) {
+        std::cout << " none recovered";
+    } else {
+        std::sort(samples.begin(), samples.end());
+        int64_t sum = 0;
+        for (auto sample : samples) {
+            sum += sample;
+        }
+        std::cout << " min: " << samples.front() << " p50: " << samples[samples.size() / 2];
+        std::cout << " p90: " << samples[samples.size() * 9 / 10] << " max: " << samples.back();
+        std::cout << " mean: " << sum / (int64_t) samples.size();
+    }
+    std::cout << " not recovered: " << missing << std::endl;
+}
+
+void run_setting(int trials, int election_timeout_ms, int heartbeat_period_ms, uint32_t first_seed) {
+    for (int kill = 0; kill <= 1; kill++) {
+        std::vector<int64_t> leader_samples, write_samples;
+        int leader_missing = 0, write_missing = 0, not_started = 0;
+        term_t elections = 0;
+        for (int trial = 0; trial < trials; trial++) {
+            // the servers log every message, keep only the report.
+            std::streambuf* cout_buf = std::cout.rdbuf();
+            std::cout.rdbuf(NULL);
+            trial_result_t result = run_trial(first_seed + trial, kill);
+            std::cout.clear();
+            std::cout.rdbuf(cout_buf);
+            if (!result.started) {
+                not_started++;
+                continue;
+            }
+            if (result.leader_ms == -1) {
+                leader_missing++;
+            } else {
+                leader_samples.push_back(result.leader_ms);
+                elections += result.elections;
+            }
+            if (result.write_ms == -1) {
+                write_missing++;
+            } else {
+                write_samples.push_back(result.write_ms);
+            }
+        }
+        std::cout << "[failover] election timeout " << election_timeout_ms << " heartbeat " << heartbeat_period_ms;
+        std::cout << " leader " << (kill ? "killed" : "partitioned") << ", " << trials << " trials";
+        if (not_started > 0) {
+            std::cout << " (" << not_started << " without a first leader)";
+        }
+        if (!leader_samples.empty()) {
+            std::cout << ", terms per failover: " << (double) elections / leader_samples.size();
+        }
+        std::cout << std::endl;
+        print_distribution("new leader", leader_samples, leader_missing);
+        print_distribution("first write", write_samples, write_missing);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int trials = (argc > 1) ? atoi(argv[1]) : 20;
+    if (trials < 1) {
+        std::cout << usage << std::endl;
+        exit(1);
+    }
+    if (!load_cluster_config((argc > 2) ? argv[2] : DEFAULT_CONFIG_FILE)) {
+        exit(1);
+    }
+    std::vector<std::string> settings;
+    for (int i = 3; i < argc; i++) {
+        settings.push_back(argv[i]);
+    }
+    if (settings.empty()) {
+        settings = {"10000/2000", "5000/1000", "3000/500", "2000/250"};
+    }
+
+    const cluster_config_t base = get_config();
+    for (int i = 0; i < settings.size(); i++) {
+        int election_timeout_ms = 0, heartbeat_period_ms = 0;
+        char slash = 0;
+        std::stringstream ss(settings[i]);
+        ss >> election_timeout_ms >> slash >> heartbeat_period_ms;
+        if (ss.fail() || slash != '/' || heartbeat_period_ms < 1 || heartbeat_period_ms >= election_timeout_ms / 2) {
+            std::cout << "[failover] skip " << settings[i] << ", the heartbeat period must be positive and below half of the election timeout." << std::endl;
+            continue;
+        }
+        cluster_config_t config = base;
+        config.election_timeout_ms = election_timeout_ms;
+        config.heartbeat_period_ms = heartbeat_period_ms;
+        set_config(config);
+        run_setting(trials, election_timeout_ms, heartbeat_period_ms, 1000 * i + 1);
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file failure_detector.h
+ * @brief phi accrual failure detector for the leader, as in Hayashibara et al.
+ *        It learns the inter-arrival times of the leader's AppendEntries and tells how unlikely the
+ *        current silence is, so a follower suspects a dead leader as soon as the silence is abnormal
+ *        for the actual network instead of after a worst-case timeout.
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include <deque>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+#include "parameter.h"
+
+class FailureDetector {
+public:
+    typedef std::chrono::system_clock::time_point time_point_t;
+
+    // the leader sends something at least every min_pause_ms, a shorter silence is never suspicious.
+    FailureDetector(uint32_t min_pause_ms = 0) : sum_ms(0), sum_sq_ms(0), has_last(false), min_pause_ms(min_pause_ms) {}
+
+    // forget the last arrival, ie. the leader changed. The learned intervals are kept, it's the same network.
+    void restart() {has_last = false;}
+
+    void heartbeat(time_point_t now) {
+        if (has_last) {
+            double interval = std::chrono::duration<double, std::milli>(now - last_arrival).count();
+            intervals.push_back(interval);
+            sum_ms += interval;
+            sum_sq_ms += interval * interval;
+            if (intervals.size() > PHI_WINDOW_SIZE) {
+                sum_ms -= intervals.front();
+                sum_sq_ms -= intervals.front() * intervals.front();
+                intervals.pop_front();
+            }
+        }
+        last_arrival = now;
+        has_last = true;
+    }
+
+    // enough intervals to trust phi, and an arrival to measure the silence from.
+    bool ready() {return has_last && intervals.size() >= PHI_MIN_SAMPLES;}
+
+    double mean_ms() {return intervals.empty() ? 0 : sum_ms / intervals.size();}
+
+    /**
+     * @brief -log10 of the probability that the next heartbeat comes even later than now,
+     *        with the intervals taken as normally distributed. 1 means a 10% chance the leader is
+     *        still alive, 8 a 1e-8 chance. The intervals learned while the leader streamed entries are
+     *        shorter than its heartbeat period, so a silence within min_pause_ms is 0.
+     *
+     * @param now
+     * @return double
+     */
+    double phi(time_point_t now) {
+        if (!ready()) {
+            return 0;
+        }
+        double silence = std::chrono::duration<double, std::milli>(now - last_arrival).count();
+        if (silence < min_pause_ms) {
+            return 0;
+        }
+        double mean = mean_ms();
+        double variance = std::max(sum_sq_ms / intervals.size() - mean * mean, 0.0);
+        double std_dev = std::max(std::sqrt(variance), (double) PHI_MIN_STD_DEV_MS);
+        double p_later = 0.5 * std::erfc((silence - mean) / (std_dev * std::sqrt(2.0)));
+        return (p_later <= 0) ? INFINITY : -std::log10(p_later);
+    }
+
+private:
+    std::deque<double> intervals;           // The latest PHI_WINDOW_SIZE inter-arrival times.
+    double sum_ms;
+    double sum_sq_ms;
+    time_point_t last_arrival;
+    bool has_last;
+    uint32_t min_pause_ms;
+};
@@ -0,0 +1,189 @@
+/**
+ * @file framing.h
+ * @brief the receive side of the length-prefixed frames (a COMM_HEADER_TYPE length in network order, then the body)
+ *        shared by every connection of the event loop (event_loop.h).
+ *        The socket is read straight into the free space of the buffer, every complete frame is handed over
+ *        as a pointer into the buffer, and the bytes of a frame that isn't complete yet stay for the next read.
+ *        The buffer wraps around like a ring, except that a frame never straddles the end: the partial frame
+ *        is moved to the front instead, so every frame can be parsed in place.
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <arpa/inet.h>
+#include "parameter.h"
+
+class FrameBuffer {
+public:
+    FrameBuffer() : capacity(FRAME_BUFFER_BYTES), head(0), tail(0), too_long(false) {
+        buf = (uint8_t*) malloc(capacity);
+    }
+    ~FrameBuffer() {
+        free(buf);
+    }
+    FrameBuffer(const FrameBuffer&) = delete;
+    FrameBuffer& operator=(const FrameBuffer&) = delete;
+
+    // where the next read goes, with room for at least the rest of the frame being received.
+    // The frames handed over by next_frame() are only valid until then.
+    uint8_t* write_ptr() {
+        make_room();
+        return buf + tail;
+    }
+    size_t write_space() {
+        return capacity - tail;
+    }
+    void commit(size_t bytes) {
+        tail += bytes;
+    }
+
+    // the next complete frame received, false if there's none yet or the frame is longer than MAX_FRAME_BYTES.
+    bool next_frame(const uint8_t* &data, size_t &size) {
+        size_t header_bytes = sizeof(COMM_HEADER_TYPE);
+        if (tail - head < header_bytes) {
+            return false;
+        }
+        size_t msg_bytes = frame_bytes();
+        if (msg_bytes > MAX_FRAME_BYTES) {
+            too_long = true;
+            return false;
+        }
+        if (tail - head - header_bytes < msg_bytes) {
+            return false;
+        }
+        data = buf + head + header_bytes;
+        size = msg_bytes;
+        head += header_bytes + msg_bytes;
+        return true;
+    }
+
+    bool is_broken() {return too_long;};                               // A frame was too long, the stream can't be trusted.
+    size_t get_capacity() {return capacity;};
+
+private:
+    uint8_t* buf;
+    size_t capacity;
+    size_t head;                                                        // The first byte not handed over yet.
+    size_t tail;                                                        // The first free byte.
+    bool too_long;
+
+    size_t frame_bytes() {
+        COMM_HEADER_TYPE msg_bytes = 0;
+        memcpy(&msg_bytes, buf + head, sizeof(msg_bytes));
+        return ntohl(msg_bytes);
+    }
+
+    void make_room() {
+        if (head == tail) {
+            // nothing pending, the common case: start over at the front without moving anything.
+            head = tail = 0;
+            if (capacity > FRAME_BUFFER_BYTES) {
+                // give back the room of a large frame.
+                free(buf);
+                capacity = FRAME_BUFFER_BYTES;
+                buf = (uint8_t*) malloc(capacity);
+            }
+            return;
+        }
+        // the room the partial frame needs from head on, at least a header and some more to read.
+        size_t pending = tail - head;
+        size_t needed = FRAME_BUFFER_BYTES / 2;
+        if (pending >= sizeof(COMM_HEADER_TYPE) && frame_bytes() <= MAX_FRAME_BYTES) {
+            needed = std::max(needed, sizeof(COMM_HEADER_TYPE) + frame_bytes());
+        }
+        needed = std::max(needed, pending + 1);
+        if (capacity - head >= needed) {
+            return;
+        }
+        if (capacity < needed) {
+            size_t grown = capacity;
+            while (grown < needed) {
+                grown *= 2;
+            }
+            uint8_t* larger = (uint8_t*) malloc(grown);
+            memcpy(larger, buf + head, pending);
+            free(buf);
+            buf = larger;
+            capacity = grown;
+        } else {
+            memmove(buf, buf + head, pending);
+        }
+        head = 0;
+        tail = pending;
+    }
+};
+
+// the frames a server sends to the mesh start with a route header, the mesh forwards the rest of the frame,
+// the message encoded once, to every receiver. A unicast header carries the receiver id, a multicast one
+// the mask of the receivers. The frames the mesh forwards are the message alone.
+typedef enum : uint8_t {
+    ROUTE_UNICAST = 1,                  // then the receiver id, uint32_t in network order
+    ROUTE_MULTICAST = 2                 // then the mask of the receivers, bit i for server i, uint64_t in network order
+} route_type_t;
+
+const size_t ROUTE_HEADER_MAX_BYTES = 1 + sizeof(uint64_t);
+
+// write the header for the receivers to target, returns its length.
+inline size_t write_route_header(uint8_t* target, uint64_t receivers) {
+    if (receivers != 0 && (receivers & (receivers - 1)) == 0) {
+        target[0] = ROUTE_UNICAST;
+        uint32_t receiver_id = htonl(__builtin_ctzll(receivers));
+        memcpy(target + 1, &receiver_id, sizeof(receiver_id));
+        return 1 + sizeof(receiver_id);
+    }
+    target[0] = ROUTE_MULTICAST;
+    for (int i = 0; i < 8; i++) {
+        target[1 + i] = (uint8_t) (receivers >> (56 - 8 * i));
+    }
+    return 1 + sizeof(uint64_t);
+}
+
+// the receivers of a frame and the length of its header, false if the header is broken.
+inline bool read_route_header(const uint8_t* data, size_t size, uint64_t &receivers, size_t &header_bytes) {
+    if (size >= 1 + sizeof(uint32_t) && data[0] == ROUTE_UNICAST) {
+        uint32_t receiver_id;
+        memcpy(&receiver_id, data + 1, sizeof(receiver_id));
+        receiver_id = ntohl(receiver_id);
+        if (receiver_id >= 64) {
+            return false;
+        }
+        receivers = 1ULL << receiver_id;
+        header_bytes = 1 + sizeof(receiver_id);
+        return true;
+    }
+    if (size >= 1 + sizeof(uint64_t) && data[0] == ROUTE_MULTICAST) {
+        receivers = 0;
+        for (int i = 0; i < 8; i++) {
+            receivers = (receivers << 8) | data[1 + i];
+        }
+        header_bytes = 1 + sizeof(uint64_t);
+        return true;
+    }
+    return false;
+}
+
+// the first frame a server sends on a link that doesn't tell who it comes from, its id: to a server with
+// a lower id, or to the mesh over a unix socket. uint32_t in network order.
+const size_t HELLO_BYTES = sizeof(uint32_t);
+
+inline void write_hello(uint8_t* target, int server_id) {
+    uint32_t id = htonl(server_id);
+    memcpy(target, &id, sizeof(id));
+}
+
+// the id of the server, -1 if the frame isn't a hello of a server below server_count.
+inline int read_hello(const uint8_t* data, size_t size, int server_count) {
+    if (size != HELLO_BYTES) {
+        return -1;
+    }
+    uint32_t id;
+    memcpy(&id, data, sizeof(id));
+    id = ntohl(id);
+    return (id < (uint32_t) server_count) ? (int) id : -1;
+}
@@ -0,0 +1,96 @@
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "link.h"
+#include "config.h"
+
+static bool unix_addr(int port, sockaddr_un &addr) {
+    std::string path = get_config().link_path(port);
+    memset(&addr, 0, sizeof(addr));
+    if (path.size() >= sizeof(addr.sun_path)) {
+        errno = ENAMETOOLONG;
+        return false;
+    }
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path.c_str());
+    return true;
+}
+
+static void inet_addr_of(const std::string &ip, int port, sockaddr_in &addr) {
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = inet_addr(ip.c_str());
+    addr.sin_port = htons(port);
+}
+
+int link_listen(const std::string &ip, int port, int backlog) {
+    int sock = -1;
+    if (get_config().replica_link == LINK_UNIX) {
+        sockaddr_un addr;
+        if (!unix_addr(port, addr)) {
+            return -1;
+        }
+        // the socket of a process that didn't remove it.
+        unlink(addr.sun_path);
+        sock = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (sock < 0 || bind(sock, (sockaddr*) &addr, sizeof(addr)) < 0) {
+            int error = errno;
+            close(sock);
+            errno = error;
+            return -1;
+        }
+    } else {
+        sockaddr_in addr;
+        inet_addr_of(ip, port, addr);
+        int one = 1;
+        sock = socket(AF_INET, SOCK_STREAM, 0);
+        if (sock < 0 || setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) < 0
+                || bind(sock, (sockaddr*) &addr, sizeof(addr)) < 0) {
+            int error = errno;
+            close(sock);
+            errno = error;
+            return -1;
+        }
+    }
+    if (listen(sock, backlog) < 0) {
+        int error = errno;
+        close(sock);
+        errno = error;
+        return -1;
+    }
+    return sock;
+}
+
+int link_connect(const std::string &ip, int port) {
+    int sock = -1;
+    int status = -1;
+    if (get_config().replica_link == LINK_UNIX) {
+        sockaddr_un addr;
+        if (!unix_addr(port, addr)) {
+            return -1;
+        }
+        sock = socket(AF_UNIX, SOCK_STREAM, 0);
+        status = (sock < 0) ? -1 : connect(sock, (sockaddr*) &addr, sizeof(addr));
+    } else {
+        sockaddr_in addr;
+        inet_addr_of(ip, port, addr);
+        sock = socket(AF_INET, SOCK_STREAM, 0);
+        status = (sock < 0) ? -1 : connect(sock, (sockaddr*) &addr, sizeof(addr));
+    }
+    if (status < 0) {
+        int error = errno;
+        close(sock);
+        errno = error;
+        return -1;
+    }
+    return sock;
+}
+
+void link_remove(int port) {
+    if (get_config().replica_link == LINK_UNIX) {
+        unlink(get_config().link_path(port).c_str());
+    }
+}
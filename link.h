@@ -0,0 +1,45 @@
+/**
+ * @file link.h
+ * @brief the ways the processes of the cluster send frames to each other: a socket served by an event loop
+ *        (Connection in event_loop.h), over TCP or a unix socket, or a ring of a shared memory inbox (ShmLink in shm_link.h).
+ *        The network and the mesh send through a Link whatever carries it.
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include <string>
+#include <functional>
+#include <stdint.h>
+#include <stddef.h>
+
+class Link {
+public:
+    virtual ~Link() {};
+
+    virtual bool is_open() = 0;                                         // false once the other end is gone.
+    virtual bool send_frame(const uint8_t* body, size_t size) = 0;      // false if the link is closed or the frame was dropped.
+    bool send_frame(const std::string &body) {return send_frame((const uint8_t*) body.data(), body.size());};
+    template <typename M>
+    bool send_message(const M &msg) {                                   // Serialize the protobuf message straight into the link.
+        size_t size = msg.ByteSizeLong();
+        return send_serialized(size, [&msg](uint8_t* target) { msg.SerializeWithCachedSizesToArray(target); });
+    };
+    template <typename M>
+    bool send_message(const M &msg, const uint8_t* prefix, size_t prefix_size) {   // The prefix then the message, in one frame.
+        size_t size = msg.ByteSizeLong();
+        return send_serialized(size, [&msg](uint8_t* target) { msg.SerializeWithCachedSizesToArray(target); }, prefix, prefix_size);
+    };
+    virtual void cork() = 0;                                            // Hold the frames back until the matching uncork().
+    virtual void uncork() = 0;
+    virtual void close() = 0;
+
+protected:
+    virtual bool send_serialized(size_t size, const std::function<void(uint8_t*)> &serialize, const uint8_t* prefix = NULL, size_t prefix_size = 0) = 0;
+};
+
+// the stream sockets of the replica links (replica_link in config.h) for a port: over TCP on the ip,
+// or the unix socket named after the port. -1 if it failed, the errno is kept.
+int link_listen(const std::string &ip, int port, int backlog);
+int link_connect(const std::string &ip, int port);
+void link_remove(int port);                                             // Remove the unix socket of a listener closed.
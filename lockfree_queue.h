@@ -0,0 +1,170 @@
+/**
+ * @file lockfree_queue.h
+ * @brief bounded lock-free queues used to hand work between server threads.
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <condition_variable>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Single-producer / single-consumer ring buffer.
+ *        Exactly one thread may call push() and exactly one (other) thread may call pop().
+ *        CAPACITY must be a power of two.
+ *
+ * @tparam T        item type, usually a pointer.
+ * @tparam CAPACITY the number of slots in the ring.
+ */
+template <typename T, size_t CAPACITY>
+class SpscQueue {
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "SpscQueue capacity must be a power of two");
+public:
+    SpscQueue() : head(0), tail(0) {}
+
+    // return false if the queue is full, the item is not pushed in that case.
+    bool push(const T& item) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) == CAPACITY)
+            return false;
+        buffer[t & (CAPACITY - 1)] = item;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // return false if the queue is empty, item is untouched in that case.
+    bool pop(T& item) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire))
+            return false;
+        item = buffer[h & (CAPACITY - 1)];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t size() {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+
+private:
+    T buffer[CAPACITY];
+    std::atomic<size_t> head;       // next slot to pop, only advanced by the consumer.
+    std::atomic<size_t> tail;       // next slot to push, only advanced by the producer.
+};
+
+/**
+ * @brief Multi-producer / single-consumer ring buffer. Any number of threads may call push(),
+ *        exactly one thread may call pop(). Every slot carries a sequence number telling whether it's
+ *        free for the push of that round or holds the item of that round, so a producer only contends on the tail.
+ *        CAPACITY must be a power of two.
+ *
+ * @tparam T        item type, usually a pointer.
+ * @tparam CAPACITY the number of slots in the ring.
+ */
+template <typename T, size_t CAPACITY>
+class MpscQueue {
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "MpscQueue capacity must be a power of two");
+public:
+    MpscQueue() : head(0), tail(0) {
+        for (size_t i = 0; i < CAPACITY; i++) {
+            slots[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // return false if the queue is full, the item is not pushed in that case.
+    bool push(const T& item) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        while (true) {
+            slot_t &slot = slots[t & (CAPACITY - 1)];
+            size_t seq = slot.seq.load(std::memory_order_acquire);
+            if (seq == t) {
+                // the slot is free for this round, claim it.
+                if (tail.compare_exchange_weak(t, t + 1, std::memory_order_relaxed)) {
+                    slot.item = item;
+                    slot.seq.store(t + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (seq < t) {
+                // still holds the item of the last round.
+                return false;
+            } else {
+                // another producer claimed it first.
+                t = tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // return false if the queue is empty or the next item is claimed but not written yet, item is untouched in that case.
+    bool pop(T& item) {
+        size_t h = head.load(std::memory_order_relaxed);
+        slot_t &slot = slots[h & (CAPACITY - 1)];
+        if (slot.seq.load(std::memory_order_acquire) != h + 1)
+            return false;
+        item = slot.item;
+        slot.seq.store(h + CAPACITY, std::memory_order_release);
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // the items pushed and not popped, the ones being written by a producer included.
+    size_t size() {
+        size_t h = head.load(std::memory_order_acquire);
+        size_t t = tail.load(std::memory_order_acquire);
+        return t > h ? t - h : 0;
+    }
+
+private:
+    struct slot_t {
+        std::atomic<size_t> seq;
+        T item;
+    };
+    slot_t slots[CAPACITY];
+    std::atomic<size_t> head;       // next slot to pop, only advanced by the consumer.
+    char head_pad[64 - sizeof(std::atomic<size_t>)];    // keeps the producers off the consumer's cache line.
+    std::atomic<size_t> tail;       // next slot to claim, advanced by the producers.
+};
+
+/**
+ * @brief Lets the consumer of lock-free queues block until something is pushed instead of polling.
+ *        The consumer takes a ticket, checks its queues and waits for the ticket only if they're empty.
+ *        A push after the ticket was taken ends the wait, the producers only take the lock if the consumer is waiting.
+ */
+class QueueSignal {
+public:
+    QueueSignal() : pushes(0), waiters(0) {}
+
+    uint64_t ticket() {
+        return pushes.load(std::memory_order_seq_cst);
+    }
+
+    // called by a producer after its push.
+    void notify() {
+        pushes.fetch_add(1, std::memory_order_seq_cst);
+        if (waiters.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lock(mutex);
+            cv.notify_all();
+        }
+    }
+
+    // return false if ms passed without a push since the ticket was taken.
+    bool wait_ms(uint64_t ticket, uint32_t ms) {
+        std::unique_lock<std::mutex> lock(mutex);
+        waiters.fetch_add(1, std::memory_order_seq_cst);
+        bool pushed = cv.wait_for(lock, std::chrono::milliseconds(ms), [this, ticket]() {
+            return pushes.load(std::memory_order_seq_cst) != ticket;
+        });
+        waiters.fetch_sub(1, std::memory_order_seq_cst);
+        return pushed;
+    }
+
+private:
+    std::atomic<uint64_t> pushes;
+    std::atomic<int> waiters;
+    std::mutex mutex;
+    std::condition_variable cv;
+};
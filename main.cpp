@@ -3,14 +3,14 @@
 #include "raft.h"
 #include <thread>
 
-const char* usage = "Run the program by typing ./main <server_id> where server_id is within range [0, 2].";
+const char* usage = "Run the program by typing ./main <server_id> [config_file] where server_id is within range [0, server_count - 1].";
 inline void print_usage() {
     printf("%s\n", usage);
 }
 
 void debug_run(int server_id) {
-    // Network network = Network(cid);
-    Server server(server_id);
+    Network network(server_id);
+    Server server(server_id, 0, &network);
     
     std::string input;
     while (true) {
@@ -35,14 +35,15 @@ void debug_run(int server_id) {
             rpc.last_log_index = 1;
             rpc.last_log_term = 1;
             rpc.term = 1;
-            wrapper.payload = &rpc;
+            rpc.leadership_transfer = false;
+            wrapper.vote_rpc = rpc;
             server.get_network()->replica_send_message(wrapper, 2);
         } else if (cmd.compare("2") == 0) {
             wrapper.type = REQ_VOTE_RPL;
             request_vote_reply_t rpl;
             rpl.term = 1;
             rpl.vote_granted = true;
-            wrapper.payload = &rpl;
+            wrapper.vote_reply = rpl;
             server.get_network()->replica_send_message(wrapper, 1);
         } else if (cmd.compare("3") == 0) {
             wrapper.type = APP_ENTR_RPC;
@@ -55,7 +56,7 @@ void debug_run(int server_id) {
             auto t = Transaction(0, 2, 3.0);
             rpc.entries.push_back(Block(1, t));
             rpc.entries.push_back(Block(2, t));
-            wrapper.payload = &rpc;
+            wrapper.append_rpc = rpc;
             server.get_network()->replica_send_message(wrapper, 0);
         } else if (cmd.compare("4") == 0) {
             wrapper.type = APP_ENTR_RPL;
@@ -63,7 +64,7 @@ void debug_run(int server_id) {
             rpl.sender_id = 1;
             rpl.success = true;
             rpl.term = 3;
-            wrapper.payload = &rpl;
+            wrapper.append_reply = rpl;
             server.get_network()->replica_send_message(wrapper, -1);
         } else if (cmd.compare("p") == 0) {
             // pop all messages
@@ -72,24 +73,25 @@ void debug_run(int server_id) {
                 server.get_network()->replica_pop_message(wrapper);
                 replica_msg_type_t type = wrapper.type;
                 if (type == REQ_VOTE_RPC) {
-                    auto msg = (request_vote_rpc_t*) wrapper.payload;
+                    auto msg = &wrapper.vote_rpc;
                     std::cout << "type: " << "REQ_VOTE_RPC" << std::endl;
                     std::cout << "term: " << msg->term << " candate id: " << msg->candidate_id << " last log term: " << msg->last_log_term << " last log index: " << msg->last_log_index << std::endl;
                 } else if (type == REQ_VOTE_RPL) {
-                    auto msg = (request_vote_reply_t*) wrapper.payload;
+                    auto msg = &wrapper.vote_reply;
                     std::cout << "type: " << "REQ_VOTE_RPL" << std::endl;
                     std::cout << "term: " << msg->term << " granted: " << msg->vote_granted << std::endl;
                 } else if (type == APP_ENTR_RPC) {
-                    auto msg = (append_entry_rpc_t*) wrapper.payload;
+                    auto msg = &wrapper.append_rpc;
                     std::cout << "type: " << "APP_ENTR_RPC" << std::endl;
                     std::cout << "term: " << msg->term << " leader id: " << msg->leader_id << " last log index: " << msg->prev_log_index << " prev log term: " << msg->prev_log_term << " commit index: " << msg->commit_index << std::endl;
-                    std::cout << "entry count: " << msg->entries.size() << std::endl;
-                    for (int i = 0; i < msg->entries.size(); i++) {
-                        auto &block = msg->entries.at(i);
+                    std::cout << "entry count: " << msg->encoded.size() << std::endl;
+                    for (int i = 0; i < msg->encoded.size(); i++) {
+                        Block block;
+                        block.decode(msg->encoded.data(i), msg->encoded.length(i));
                         block.print_block();
                     }
                 } else if (type == APP_ENTR_RPL) {
-                    auto msg = (append_entry_reply_t*) wrapper.payload;
+                    auto msg = &wrapper.append_reply;
                     std::cout << "type: " << "APP_ENTR_RPL" << std::endl;
                     std::cout << "term: " << msg->term << " success: " << msg->success << " sender id: " << msg->sender_id << std::endl;
                 }
@@ -123,23 +125,34 @@ void debug_run(int server_id) {
 
 
 int main(int argc, char* argv[]) {
-    if (argc != 2) {
+    if (argc != 2 && argc != 3) {
         print_usage();
         exit(1);
     }
+
+    if (!load_cluster_config((argc == 3) ? argv[2] : DEFAULT_CONFIG_FILE)) {
+        exit(1);
+    }
     
     int server_id = atoi(argv[1]);
-    if (server_id < 0 || server_id >= SERVER_COUNT) {
+    if (server_id < 0 || server_id >= get_config().server_count) {
         std::cout << "Your input cid is out of the accepted range." << std::endl;
         print_usage();
         exit(1);
     }
 
-    // Spawn a thread to run server state machine
+    // Spawn a thread to run the state machine of every shard, the shards share the network
     std::cout<<"Constructing a server..."<<std::endl;
-    Server server(server_id);
+    Network network(server_id);
+    std::vector<Server*> shards;
+    std::vector<std::thread> shard_threads;
+    for (int shard_id = 0; shard_id < get_config().shard_count; shard_id++) {
+        shards.push_back(new Server(server_id, shard_id, &network));
+    }
     std::cout<<"Server State Machine running..."<<std::endl;
-    std::thread server_thread(&Server::run_state_machine, &server);
+    for (auto shard : shards) {
+        shard_threads.push_back(std::thread(&Server::run_state_machine, shard));
+    }
 
     // Main thread provide main UI interface
     std::string input;
@@ -157,8 +170,39 @@ int main(int argc, char* argv[]) {
         }
 
         std::string &cmd = args[0];
+        // the admin commands apply to every shard unless a shard id is given.
+        int first_shard = 0, last_shard = shards.size() - 1;
+        if (args.size() == 3 && cmd.compare("p") != 0) {
+            first_shard = last_shard = atoi(args[2].c_str());
+            if (first_shard < 0 || first_shard >= shards.size()) {
+                std::cout << "invalid shard id." << std::endl;
+                continue;
+            }
+        }
         if (cmd.compare("p") == 0) {
-            server.print_info();
+            for (auto shard : shards) {
+                shard->print_info();
+            }
+        } else if (cmd.compare("add") == 0 || cmd.compare("remove") == 0) {
+            // format: add <server_id> [shard_id] / remove <server_id> [shard_id], only on the leader
+            if (args.size() != 2 && args.size() != 3) {
+                std::cout << "wrong format." << std::endl;
+                std::cout << "add <server_id> [shard_id] or remove <server_id> [shard_id]" << std::endl;
+                continue;
+            }
+            for (int shard_id = first_shard; shard_id <= last_shard; shard_id++) {
+                shards[shard_id]->request_membership_change(atoi(args[1].c_str()), cmd.compare("add") == 0);
+            }
+        } else if (cmd.compare("transfer_leader") == 0) {
+            // format: transfer_leader <server_id> [shard_id], only on the leader
+            if (args.size() != 2 && args.size() != 3) {
+                std::cout << "wrong format." << std::endl;
+                std::cout << "transfer_leader <server_id> [shard_id]" << std::endl;
+                continue;
+            }
+            for (int shard_id = first_shard; shard_id <= last_shard; shard_id++) {
+                shards[shard_id]->request_leadership_transfer(atoi(args[1].c_str()));
+            }
         }
     }
 }
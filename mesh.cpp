@@ -1,147 +1,165 @@
 #include <sys/socket.h>
 #include <arpa/inet.h>
 #include <unistd.h>
+#include <string.h>
+#include <errno.h>
 #include "parameter.h"
 #include <sstream>
 #include "mesh.h"
+#include "shm_link.h"
 #include "raft.h"
 using namespace RaftMesh;
 
 // #define DEBUG_MODE
 
 Mesh::Mesh() {
+    servers = new server_info_t[get_config().server_count]();
     setup_mesh_server();
 }
 
 Mesh::~Mesh() {
-    for (int i = 0; i < SERVER_COUNT; i++) {
-        if (servers[i].connected) {
-            servers[i].connected = false;
-        }
-        if (servers[i].recv_task) {
-            try {
-                servers[i].recv_task->join();
-            } catch (...) {};
-            delete servers[i].recv_task;
-            servers[i].recv_task = NULL;
-        }
-        if (servers[i].send_task) {
-            try {
-                servers[i].recv_task->join();
-            } catch (...) {};
-            delete servers[i].send_task;
-            servers[i].send_task = NULL;
-        }
-        close(servers[i].sock);
-        flush_server_trans_queue(i);
+    // no handler runs once the inbox and the loop are stopped.
+    is_stopped = true;
+    delete inbox;
+    loop.stop();
+    if (mesh_sock >= 0) {
+        close(mesh_sock);
+        link_remove(get_config().mesh_port);
     }
+    delete [] servers;
 }
 
+/**
+ * @brief over TCP or a unix socket the replicas connect to the mesh port. Over shared memory they write to
+ *        their ring of the mesh's inbox, and the mesh looks for the inbox of every replica once a second.
+ * 
+ */
 void Mesh::setup_mesh_server() {
-    mesh_sock = socket(AF_INET, SOCK_STREAM, 0);
-    int status = 0;
-    if (setsockopt(mesh_sock, SOL_SOCKET, SO_REUSEPORT, &status, sizeof(status)) < 0) {
-        std::cerr << "[Mesh::setup_mesh_server] failed to set the socket options." << std::endl;
-        close(mesh_sock);
+    if (get_config().replica_link == LINK_SHM) {
+        inbox = new ShmInbox(get_config().mesh_port, get_config().server_count,
+            [this](int replica_id, const uint8_t* data, size_t size) { recv_handler(replica_id, data, size); });
+        if (!inbox->is_ready()) {
+            std::cerr << "[Mesh::setup_mesh_server] failed to set up the mesh inbox." << std::endl;
+            exit(1);
+        }
+        std::cout << "[Mesh::setup_mesh_server] waiting for the inboxes of the replicas." << std::endl;
+        loop.run_after(0, [this]() { open_rings(); });
+        return;
+    }
+
+    mesh_sock = link_listen(get_config().mesh_ip, get_config().mesh_port, get_config().server_count);
+    if (mesh_sock < 0) {
+        std::cerr << "[Mesh::setup_mesh_server] failed to listen the mesh port: " << strerror(errno) << std::endl;
         exit(1);
     }
-    
-    sockaddr_in bind_addr = {0};
-    bind_addr.sin_family = AF_INET;
-    bind_addr.sin_addr.s_addr = inet_addr(MESH_IP);
-    bind_addr.sin_port = htons(MESH_PORT);
-    
-    if (bind(mesh_sock, (sockaddr*) &bind_addr, sizeof(sockaddr_in)) < 0) {
-        std::cerr << "[Mesh::setup_mesh_server] failed to bind the socket to mesh port." << std::endl;
+
+    std::cout << "[Mesh::setup_mesh_server] waiting for replicas to connect." << std::endl;
+    if (!loop.listen(mesh_sock, [this](int replica_sock, const sockaddr_in &replica_addr) { accept_handler(replica_sock, replica_addr); })) {
+        std::cerr << "[Mesh::setup_mesh_server] failed to watch the port." << std::endl;
         close(mesh_sock);
         exit(1);
     }
+}
+
+void Mesh::accept_handler(int replica_sock, const sockaddr_in &replica_addr) {
+    if (get_config().replica_link == LINK_UNIX) {
+        accept_unix(replica_sock);
+        return;
+    }
+
+    // by subtracting the client base port, we can get the client id here
+    int replica_id = ntohs(replica_addr.sin_port) - get_config().replica_client_base_port;
     
-    if (listen(mesh_sock, SERVER_COUNT) < 0) {
-        std::cerr << "[Mesh::setup_mesh_server] failed to listen the port." << std::endl;
-        close(mesh_sock);
-        exit(1);
+    if (replica_id >= get_config().server_count || replica_id < 0) {
+        std::cerr << "[Mesh::accept_handler] received invalid replica_id: " << replica_id << std::endl;
+        close(replica_sock);
+        return;
+    }
+
+    if (servers[replica_id].connected == true) {
+        std::cerr << "[Mesh::accept_handler] replica: " << replica_id << " is already connected." << std::endl;
+        close(replica_sock);
+        return;
     }
 
-    wait_conn_thread = std::thread(&Mesh::wait_conn_handler, this);
+    // update the server information, the previous connection is freed with its last reference.
+    std::shared_ptr<Connection> conn = loop.attach(replica_sock,
+        [this, replica_id](const uint8_t* data, size_t size) { recv_handler(replica_id, data, size); },
+        [this, replica_id]() { replica_closed(replica_id); });
+    if (conn != NULL) {
+        replica_attach(replica_id, conn);
+    }
 }
 
-void Mesh::append_server_trans_queue(int replica_id, trans_queue_item_t* trans_item) {
-    servers[replica_id].trans_queue_lock.lock();
-    servers[replica_id].trans_queue.push_back(trans_item);
-    servers[replica_id].trans_queue_lock.unlock();
+/**
+ * @brief a unix socket has no port to tell the replica, it sends its id in the first frame.
+ * 
+ */
+void Mesh::accept_unix(int replica_sock) {
+    // the loop runs the handlers, the first frame can't come before the connection is known.
+    auto self = std::make_shared<std::weak_ptr<Connection>>();
+    auto replica_id = std::make_shared<int>(-1);
+    std::shared_ptr<Connection> conn = loop.attach(replica_sock,
+        [this, self, replica_id](const uint8_t* data, size_t size) {
+            if (*replica_id >= 0) {
+                recv_handler(*replica_id, data, size);
+                return;
+            }
+            std::shared_ptr<Connection> conn = self->lock();
+            int hello = read_hello(data, size, get_config().server_count);
+            if (hello < 0 || servers[hello].connected) {
+                std::cerr << "[Mesh::accept_unix] received an invalid hello or one of a replica already connected: " << hello << std::endl;
+                if (conn != NULL) {
+                    conn->close();
+                }
+                return;
+            }
+            *replica_id = hello;
+            if (conn != NULL) {
+                replica_attach(hello, conn);
+            }
+        },
+        [this, replica_id]() { replica_closed(*replica_id); });
+    *self = conn;
 }
 
-trans_queue_item_t* Mesh::pop_server_trans_queue(int replica_id) {
-    if (servers[replica_id].trans_queue.size() == 0)
-        return NULL;
-    trans_queue_item_t* trans_item = servers[replica_id].trans_queue.at(0);
-    servers[replica_id].trans_queue.pop_front();
-    return trans_item;
+void Mesh::replica_attach(int replica_id, const std::shared_ptr<Link> &conn) {
+    servers[replica_id].conn = conn;
+    servers[replica_id].connected = true;
+    servers[replica_id].partitioned = false;
+    std::cout << "[Mesh::accept_handler] listening server: " << replica_id << " for messages." << std::endl;
 }
 
-void Mesh::flush_server_trans_queue(int replica_id) {
-    int count = servers[replica_id].trans_queue.size();
-    trans_queue_item_t *trans_item = NULL;
-    for (int i = 0; i < count; i++) {
-        trans_item = pop_server_trans_queue(replica_id);
-        delete trans_item->msg;
-        delete trans_item;
+void Mesh::replica_closed(int replica_id) {
+    if (replica_id < 0) {
+        return;
     }
+    std::cout << "[Mesh::recv_handler] server: " << replica_id << " disconnected." << std::endl;
+    servers[replica_id].connected = false;
 }
 
-void Mesh::wait_conn_handler() {
-    std::cout << "[Mesh::wait_conn_handler] waiting for replicas to connect." << std::endl;
-    while (!is_stopped) {
-        sockaddr_in replica_addr = {0};
-        socklen_t addr_size = sizeof(replica_addr);
-        
-        int replica_sock = accept(mesh_sock, (sockaddr*) &replica_addr, &addr_size);
-        if (replica_sock < 0) {
-            std::cout << "[Mesh::wait_conn_handler] failed to accept client." << std::endl;
-            continue;
-        }
-
-        // by subtracting the client base port, we can get the client id here
-        int replica_id = ntohs(replica_addr.sin_port) - REPLICA_CLIENT_BASE_PORT;
-        
-        if (replica_id > 2 || replica_id < 0) {
-            std::cerr << "[Mesh::wait_conn_handler] received invalid replica_id: " << replica_id << std::endl;
-            close(replica_sock);
-            continue;
-        }
-
-        if (servers[replica_id].connected == true) {
-            std::cerr << "[Mesh::wait_conn_handler] replica: " << replica_id << " is already connected." << std::endl;
-            close(replica_sock);
+/**
+ * @brief runs on the loop every second over shared memory: a replica is connected while its inbox is there.
+ * 
+ */
+void Mesh::open_rings() {
+    if (is_stopped) {
+        return;
+    }
+    for (int replica_id = 0; replica_id < get_config().server_count; replica_id++) {
+        server_info_t &server = servers[replica_id];
+        if (server.conn != NULL && server.conn->is_open()) {
             continue;
         }
-
-        // if there is a lost connection before, need to try to free the previous connection.
-        if (servers[replica_id].recv_task != NULL) {
-            try {
-                servers[replica_id].recv_task->join();
-            } catch (...) {}
-            delete servers[replica_id].recv_task;
-            servers[replica_id].recv_task = NULL;
+        if (server.connected) {
+            replica_closed(replica_id);
         }
-
-        if (servers[replica_id].send_task != NULL) {
-            try {
-                servers[replica_id].send_task->join();
-            } catch (...) {}
-            delete servers[replica_id].send_task;
-            servers[replica_id].send_task = NULL;
+        server.conn = ShmLink::open(get_config().replica_client_base_port + replica_id, 0);
+        if (server.conn != NULL) {
+            replica_attach(replica_id, server.conn);
         }
-
-        // update the server information
-        flush_server_trans_queue(replica_id);
-        servers[replica_id].connected = true;
-        servers[replica_id].partitioned = false;
-        servers[replica_id].sock = replica_sock;
-        servers[replica_id].recv_task = new std::thread(&Mesh::recv_handler, this, replica_id);
-        servers[replica_id].send_task = new std::thread(&Mesh::send_handler, this, replica_id);
     }
+    loop.run_after(1000, [this]() { open_rings(); });
 }
 
  /*
@@ -151,60 +169,34 @@ void Mesh::wait_conn_handler() {
                      |
     ---------------  |
  */
-void Mesh::recv_handler(int replica_id) {
-    std::cout << "[Network::recv_handler] listening server: " << replica_id << " for messages." << std::endl;
-    int replica_sock = servers[replica_id].sock;
-    while (!is_stopped && servers[replica_id].connected) {
-        COMM_HEADER_TYPE msg_bytes = 0;
-        int count = 0;
-        count = read(replica_sock, &msg_bytes, sizeof(msg_bytes));
-        if (count <= 0) {
-            break;
-        } else if (count < sizeof(msg_bytes)) {
-            std::cout << "[Network::recv_handler] received borken header from replica " << replica_id << std::endl;
-            continue; 
-        }
-
-        msg_bytes = ntohl(msg_bytes);
-        uint8_t* msg = new uint8_t[msg_bytes];
-        count = read(replica_sock, msg, msg_bytes);
-        if (count <= 0) {
-            delete [] msg;
-            break;
-        } else if (count < sizeof(msg_bytes)) {
-            std::cout << "[Network::recv_handler] received borken message from replica " << replica_id << std::endl;
-            delete [] msg;
-            continue; 
-        }
+void Mesh::recv_handler(int replica_id, const uint8_t* data, size_t size) {
+    if (servers[replica_id].partitioned) {
+        return;
+    }
 
-        replica_msg_t *replica_msg = new replica_msg_t();
-        replica_msg->ParseFromArray(msg, msg_bytes);
-        delete [] msg;
+    uint64_t receivers;
+    size_t header_bytes;
+    if (!read_route_header(data, size, receivers, header_bytes)) {
+        std::cout << "[Mesh::recv_handler] received broken message from replica " << replica_id << std::endl;
+        return;
+    }
 
-        if (servers[replica_id].partitioned) {
-            delete replica_msg;
+    // the message is forwarded as received, after the simulated network delay. The receivers share one copy of it.
+    std::shared_ptr<std::string> msg;
+    for (uint32_t receiver_id = 0; receiver_id < get_config().server_count; receiver_id++) {
+        if (!(receivers & (1ULL << receiver_id)) || !servers[receiver_id].connected) {
             continue;
         }
-
-        uint32_t receiver_id = replica_msg->receiver_id();
-        if (servers[receiver_id].connected) {
-            trans_queue_item_t *trans_item = new trans_queue_item_t();
-            trans_item->enqueue_time = clock_t::now();
-            trans_item->msg = replica_msg;
-            append_server_trans_queue(receiver_id, trans_item);    
-        } else {
-            delete replica_msg;
+        if (msg == NULL) {
+            msg = std::make_shared<std::string>((const char*) data + header_bytes, size - header_bytes);
         }
-
-        #ifdef DEBUG_MODE
-        std::cout << "[Network::recv_handler] added message from replica: " << replica_id;
-        std::cout << " to replica: " << receiver_id << "'s queue";
-        std::cout << " message type: " << replica_msg->type() << std::endl;
-        #endif
+        loop.run_after(MESH_NETWORK_DELAY_MS, [this, receiver_id, msg]() { send_handler(receiver_id, *msg); });
     }
-    std::cout << "[Network::recv_handler] server: " << replica_id << " disconnected." << std::endl;
-    servers[replica_id].connected = false;
-    close(servers[replica_id].sock);
+
+    #ifdef DEBUG_MODE
+    std::cout << "[Mesh::recv_handler] added message from replica: " << replica_id;
+    std::cout << " to the queues of the replicas of mask: " << receivers << std::endl;
+    #endif
 }
 
 /*
@@ -214,42 +206,12 @@ void Mesh::recv_handler(int replica_id) {
     send_handler->   |
     ---------------  |
 */
-void Mesh::send_handler(int replica_id) {
-    int replica_sock = servers[replica_id].sock;
-    while (!is_stopped && servers[replica_id].connected) {
-         trans_queue_item_t *trans_item = pop_server_trans_queue(replica_id);
-        if (trans_item == NULL) {
-            std::this_thread::sleep_for(milliseconds_t(100));
-            continue;
-        }
-        
-        // simulate the network delay
-        auto diff_ms = std::chrono::duration_cast<milliseconds_t>(clock_t::now() - trans_item->enqueue_time);
-        if (diff_ms.count() < MESH_NETWORK_DELAY_MS) {
-            std::this_thread::sleep_for(milliseconds_t(MESH_NETWORK_DELAY_MS - diff_ms.count()));
-        }
-        
-        // fetch the replica message from the trans_item and then trans_item is useless
-        replica_msg_t *msg = trans_item->msg;
-        delete trans_item;
-        
-        // the the replica is partitioned, then the message shouldn't reach
-        if (servers[replica_id].partitioned) {
-            delete msg;
-            continue;
-        }
-
-        // transfer the replica message
-        // 1. transfer the header first
-        COMM_HEADER_TYPE trans_bytes = htonl(msg->ByteSizeLong());
-        write(servers[replica_id].sock, &trans_bytes, sizeof(trans_bytes));
-
-        // 2. transfer the body next
-        std::string trans_str = msg->SerializeAsString();
-        write(servers[replica_id].sock, trans_str.c_str(), msg->ByteSizeLong());
-        delete msg;
+void Mesh::send_handler(int replica_id, const std::string &msg) {
+    // the the replica is partitioned, then the message shouldn't reach
+    if (servers[replica_id].partitioned || !servers[replica_id].connected) {
+        return;
     }
-    servers[replica_id].connected = false;
+    servers[replica_id].conn->send_frame(msg);
 }
 
 void Mesh::server_partition_toggle(uint32_t server_id) {
@@ -263,12 +225,22 @@ void Mesh::server_partition_toggle(uint32_t server_id) {
 }
 
 int main(int argc, char* argv[]) {
+    // usage: ./mesh [config_file]
+    if (!load_cluster_config((argc == 2) ? argv[1] : DEFAULT_CONFIG_FILE)) {
+        exit(1);
+    }
+    if (get_config().replica_transport != REPLICA_MESH) {
+        std::cout << "[Mesh] the servers connect to each other directly, set \"replica_transport = mesh\" to send their messages through the mesh." << std::endl;
+    }
     Mesh mesh;
     
     std::string input;
     while(true) {
         input.clear();
-        std::getline(std::cin, input);
+        // the mesh leaves once its input is closed, its inbox or socket is removed on the way out.
+        if (!std::getline(std::cin, input)) {
+            break;
+        }
         std::stringstream ss(input);
         std::vector<std::string> args;
         while (ss.good()) {
@@ -286,12 +258,13 @@ int main(int argc, char* argv[]) {
                 continue;
             }
             int server_id = atoi(args[1].c_str());
-            if (server_id < 0 || server_id >= SERVER_COUNT) {
-                std::cout << "invalid server id. please make sure it's between [0, 2]" << std::endl;
+            if (server_id < 0 || server_id >= get_config().server_count) {
+                std::cout << "invalid server id. please make sure it's between [0, " << get_config().server_count - 1 << "]" << std::endl;
                 continue; 
             }
             mesh.server_partition_toggle(server_id);
         }
         
     }
+    return 0;
 }
\ No newline at end of file
@@ -1,52 +1,48 @@
 #pragma once
-#include <deque>
-#include <thread>
-#include <mutex>
+#include <memory>
+#include <string>
 #include <chrono>
+#include <atomic>
 #include "Msg.pb.h"
 #include "parameter.h"
+#include "config.h"
+#include "event_loop.h"
+
+class ShmInbox;
 
 namespace RaftMesh {
     typedef std::chrono::system_clock clock_t;
     typedef std::chrono::milliseconds milliseconds_t;
 
-    struct trans_queue_item_t {
-        clock_t::time_point enqueue_time;
-        replica_msg_t* msg;
-    };
-
+    // the flags are read by the thread of the shared memory inbox too.
     struct server_info_t {
-        bool partitioned;
-        bool connected;
-        int sock;
-        std::thread *recv_task;
-        std::thread *send_task;
-        std::mutex trans_queue_lock;
-        std::deque<trans_queue_item_t*> trans_queue;
+        std::atomic<bool> partitioned;
+        std::atomic<bool> connected;
+        std::shared_ptr<Link> conn;
     };
 
     class Mesh {
     public:
         Mesh();
         ~Mesh();
-        int mesh_sock = 0;
+        int mesh_sock = -1;
         bool is_stopped = false;
 
         void server_partition_toggle(uint32_t server_id);
 
     private:
-        std::thread wait_conn_thread;
-        server_info_t servers[SERVER_COUNT] = {0};
+        EventLoop loop;                                 // serves every replica connection, the handlers below run on its thread.
+        server_info_t* servers = NULL;                  // one for each of the server_count replicas.
+        ShmInbox* inbox = NULL;                         // shared memory link only, ring i for replica i.
         
         void setup_mesh_server();
 
-        void append_server_trans_queue(int replica_id, trans_queue_item_t* trans_item);
-        trans_queue_item_t* pop_server_trans_queue(int replica_id);
-        void flush_server_trans_queue(int replica_id);
-        // void flush_server_recv_queue(int replica_id);
-
-        void wait_conn_handler();
-        void recv_handler(int replica_id);
-        void send_handler(int replica_id);
+        void accept_handler(int replica_sock, const sockaddr_in &replica_addr);
+        void accept_unix(int replica_sock);             // the replica is known from its first frame.
+        void replica_attach(int replica_id, const std::shared_ptr<Link> &conn);
+        void replica_closed(int replica_id);
+        void open_rings();                              // shared memory link only, open the ring of every replica's inbox.
+        void recv_handler(int replica_id, const uint8_t* data, size_t size);
+        void send_handler(int replica_id, const std::string &msg);     // the message is delayed by MESH_NETWORK_DELAY_MS.
     };
 }
\ No newline at end of file
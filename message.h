@@ -14,7 +14,11 @@ typedef enum {
     BALANCE_REQUEST,
     TRANSACTION_RESPONSE,
     BALANCE_RESPONSE,
-    LEADER_CHANGE
+    LEADER_CHANGE,
+    CONFIG_CHANGE_REQUEST,      // internal to the leader, never sent by clients
+    STALE_BALANCE_REQUEST,      // served from the local balance table of the server it's sent to, if it heard from the leader recently
+    XSHARD_REQUEST,             // internal to the leader, a cross shard transfer entry to append
+    SERVER_BUSY                 // the request was refused, the server's queue or the client's quota is full
 } message_type_t;
 
 struct response_t {
@@ -23,11 +27,13 @@ struct response_t {
     bool succeed;
     float balance;
     uint32_t leader_id;
+    uint32_t shard_id;              // filled in by the network of the answering shard
 };
 
 struct request_t {
     message_type_t type;
     uint32_t client_id;
     uint64_t request_id;
-    void* payload;
+    void* payload;                  // a Transaction allocated with new, or NULL. The request and the payload are released with delete.
+    uint64_t recv_time_ms;          // when the server received it, 0 for the internal requests that never expire
 };
\ No newline at end of file
@@ -0,0 +1,57 @@
+/**
+ * @file msg_arena.h
+ * @brief the protobuf arenas of the messages that only live while they're parsed or built, on the network,
+ *        mesh and log paths. Every thread has its own arena, the messages created in it are freed all at once
+ *        at the end of the batch instead of one submessage and one string at a time.
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include <memory>
+#include <google/protobuf/arena.h>
+#include "parameter.h"
+
+// the arena of the calling thread. Its first block is kept across the resets, so once a batch fits in it
+// parsing and building the messages of the batch allocates nothing. The bigger batches spill into blocks
+// freed at the reset.
+class MsgArena {
+public:
+    template <typename M>
+    static M* create() {return google::protobuf::Arena::CreateMessage<M>(&local().arena);};   // Freed at the end of the outermost batch.
+
+private:
+    friend class ArenaBatch;
+    struct local_t {
+        std::unique_ptr<char[]> block;
+        google::protobuf::Arena arena;
+        int depth = 0;                                                  // The batches open on the thread.
+
+        local_t() : block(new char[MSG_ARENA_BYTES]), arena(options(block.get())) {};
+        static google::protobuf::ArenaOptions options(char* block) {
+            google::protobuf::ArenaOptions options;
+            options.initial_block = block;
+            options.initial_block_size = MSG_ARENA_BYTES;
+            return options;
+        };
+    };
+    static local_t& local() {
+        static thread_local local_t arena;
+        return arena;
+    };
+};
+
+// the messages created while a batch is open are freed when the outermost batch of the thread ends,
+// ie. a broadcast opens a batch around the sends to every server, which open their own.
+class ArenaBatch {
+public:
+    ArenaBatch() {MsgArena::local().depth++;};
+    ~ArenaBatch() {
+        MsgArena::local_t &local = MsgArena::local();
+        if (--local.depth == 0) {
+            local.arena.Reset();
+        }
+    };
+    ArenaBatch(const ArenaBatch&) = delete;
+    ArenaBatch& operator=(const ArenaBatch&) = delete;
+};
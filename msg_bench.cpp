@@ -0,0 +1,231 @@
+/**
+ * @file msg_bench.cpp
+ * @brief measures encoding and decoding the AppendEntries of a replication heavy load, with the messages in the
+ *        per-thread arenas (msg_arena.h) or on the heap like the network, the mesh and the log used to:
+ *        the submessages and the strings allocated one by one, the received message parsed into a fresh one.
+ *        For every count of entries per message it prints the messages per second and the allocations per second.
+ *        Then it measures a follower logging the entries of the AppendEntries it receives, decoded into blocks
+ *        and the log rewritten like it used to, or kept encoded and appended to the log as they are.
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <iostream>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <cstdlib>
+#include <stdint.h>
+#include <unistd.h>
+#include "Msg.pb.h"
+#include "msg_arena.h"
+#include "blockchain.h"
+
+const char* usage = "Run the program by typing ./msg_bench [messages] [entries per message ...], ie. ./msg_bench 100000 1 16 64";
+
+static std::atomic<uint64_t> allocation_count(0);
+
+void* operator new(size_t size) {
+    allocation_count++;
+    void* ptr = malloc(size ? size : 1);
+    if (ptr == NULL) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+struct bench_result_t {
+    double messages = 0;                // per second
+    double allocations = 0;             // per second
+};
+
+const std::string PHASH(64, 'f');
+const std::string NONCE = "a3";
+
+void fill_entry(block_msg_t* block_msg, txn_msg_t* txn_msg, int index) {
+    txn_msg->set_sender_id(index % 3);
+    txn_msg->set_recver_id((index + 1) % 3);
+    txn_msg->set_amount(1.5);
+    txn_msg->set_bal_txn_flag(false);
+    block_msg->set_term(2);
+    block_msg->set_index(index);
+}
+
+// the way the messages used to be built, every submessage and string new'ed and handed over with set_allocated.
+void build_heap(replica_msg_t &send_msg, int entries) {
+    send_msg.set_type(3);
+    send_msg.set_receiver_id(1);
+    send_msg.set_shard_id(0);
+    append_entry_rpc_msg_t* append_rpc_msg = new append_entry_rpc_msg_t();
+    append_rpc_msg->set_term(2);
+    append_rpc_msg->set_leader_id(0);
+    append_rpc_msg->set_prev_log_term(2);
+    append_rpc_msg->set_prev_log_index(6);
+    append_rpc_msg->set_commit_index(5);
+    for (int i = 0; i < entries; i++) {
+        block_msg_t block_msg;
+        txn_msg_t* txn_msg = new txn_msg_t();
+        fill_entry(&block_msg, txn_msg, i);
+        block_msg.set_allocated_phash(new std::string(PHASH));
+        block_msg.set_allocated_nonce(new std::string(NONCE));
+        block_msg.set_allocated_txn(txn_msg);
+        block_msg.SerializeToString(append_rpc_msg->add_entries());
+    }
+    send_msg.set_allocated_append_entry_rpc_msg(append_rpc_msg);
+}
+
+void build_arena(replica_msg_t &send_msg, int entries) {
+    send_msg.set_type(3);
+    send_msg.set_receiver_id(1);
+    send_msg.set_shard_id(0);
+    append_entry_rpc_msg_t* append_rpc_msg = send_msg.mutable_append_entry_rpc_msg();
+    append_rpc_msg->set_term(2);
+    append_rpc_msg->set_leader_id(0);
+    append_rpc_msg->set_prev_log_term(2);
+    append_rpc_msg->set_prev_log_index(6);
+    append_rpc_msg->set_commit_index(5);
+    for (int i = 0; i < entries; i++) {
+        block_msg_t* block_msg = MsgArena::create<block_msg_t>();
+        fill_entry(block_msg, block_msg->mutable_txn(), i);
+        block_msg->set_phash(PHASH);
+        block_msg->set_nonce(NONCE);
+        block_msg->SerializeToString(append_rpc_msg->add_entries());
+    }
+}
+
+bench_result_t run_bench(bool arena, int entries, uint64_t messages) {
+    std::string frame;
+    uint64_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    uint64_t start_count = allocation_count;
+    for (uint64_t i = 0; i < messages; i++) {
+        if (arena) {
+            ArenaBatch batch;
+            replica_msg_t* send_msg = MsgArena::create<replica_msg_t>();
+            build_arena(*send_msg, entries);
+            send_msg->SerializeToString(&frame);
+            replica_msg_t* recv_msg = MsgArena::create<replica_msg_t>();
+            recv_msg->ParseFromString(frame);
+            for (const std::string &entry : recv_msg->append_entry_rpc_msg().entries()) {
+                block_msg_t* block_msg = MsgArena::create<block_msg_t>();
+                checksum += block_msg->ParseFromString(entry);
+            }
+        } else {
+            replica_msg_t send_msg;
+            build_heap(send_msg, entries);
+            send_msg.SerializeToString(&frame);
+            replica_msg_t recv_msg;
+            recv_msg.ParseFromString(frame);
+            for (const std::string &entry : recv_msg.append_entry_rpc_msg().entries()) {
+                block_msg_t block_msg;
+                checksum += block_msg.ParseFromString(entry);
+            }
+        }
+    }
+    uint64_t allocations = allocation_count - start_count;
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    if (checksum != messages * entries) {
+        std::cerr << "[msg_bench] decoded " << checksum << " entries instead of " << messages * entries << std::endl;
+        exit(1);
+    }
+    bench_result_t result;
+    result.messages = messages * 1e6 / std::max<int64_t>(elapsed.count(), 1);
+    result.allocations = allocations * 1e6 / std::max<int64_t>(elapsed.count(), 1);
+    return result;
+}
+
+// a follower logging the entries of messages AppendEntries, one after the other. Returns the entries logged per second.
+double run_follower_bench(bool encoded, int entries, int messages) {
+    const char* filename = "msg_bench_log.txt";
+    unlink(filename);
+    Blockchain log;
+    log.load_file(filename);
+    std::vector<std::string> frames;
+    for (int i = 0; i < messages; i++) {
+        ArenaBatch batch;
+        replica_msg_t* send_msg = MsgArena::create<replica_msg_t>();
+        build_arena(*send_msg, entries);
+        frames.push_back(send_msg->SerializeAsString());
+    }
+    encoded_entries_t received;
+    auto start = std::chrono::steady_clock::now();
+    for (auto &frame : frames) {
+        ArenaBatch batch;
+        replica_msg_t* recv_msg = MsgArena::create<replica_msg_t>();
+        recv_msg->ParseFromString(frame);
+        if (encoded) {
+            received.clear();
+            for (const std::string &entry : recv_msg->append_entry_rpc_msg().entries()) {
+                term_t term;
+                Block::peek_term(entry, term);
+                received.add(entry, term);
+            }
+            log.append_encoded(log.get_blockchain_length(), received, 0);
+        } else {
+            std::vector<Block> blocks(recv_msg->append_entry_rpc_msg().entries_size());
+            for (int i = 0; i < blocks.size(); i++) {
+                const std::string &entry = recv_msg->append_entry_rpc_msg().entries(i);
+                blocks[i].decode(entry.data(), entry.size());
+            }
+            log.clean_up_blocks(log.get_blockchain_length(), blocks);
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    if (log.get_blockchain_length() != (uint32_t) entries * messages) {
+        std::cerr << "[msg_bench] logged " << log.get_blockchain_length() << " entries instead of " << entries * messages << std::endl;
+        exit(1);
+    }
+    unlink(filename);
+    return (double) entries * messages * 1e6 / std::max<int64_t>(elapsed.count(), 1);
+}
+
+int main(int argc, char* argv[]) {
+    long messages = (argc > 1) ? atol(argv[1]) : 100000;
+    if (messages < 1) {
+        std::cout << usage << std::endl;
+        exit(1);
+    }
+    std::vector<int> counts;
+    for (int i = 2; i < argc; i++) {
+        counts.push_back(atoi(argv[i]));
+    }
+    if (counts.empty()) {
+        counts = {1, 16, 64};
+    }
+
+    for (int entries : counts) {
+        if (entries < 0) {
+            continue;
+        }
+        // a first round warms the arena and the frame up.
+        run_bench(true, entries, 100);
+        bench_result_t heap = run_bench(false, entries, messages);
+        bench_result_t arena = run_bench(true, entries, messages);
+        std::cout << "[msg_bench] entries: " << entries;
+        std::cout << " heap msgs/s: " << (uint64_t) heap.messages << " allocs/s: " << (uint64_t) heap.allocations;
+        std::cout << " arena msgs/s: " << (uint64_t) arena.messages << " allocs/s: " << (uint64_t) arena.allocations << std::endl;
+    }
+
+    // the follower keeps a log of a few thousands entries, the rewrites of a longer one would only cost more.
+    std::streambuf* cout_buf = std::cout.rdbuf();
+    for (int entries : counts) {
+        if (entries < 1) {
+            continue;
+        }
+        int follower_messages = std::max(4096 / entries, 1);
+        std::cout.rdbuf(NULL);
+        double decoded = run_follower_bench(false, entries, follower_messages);
+        double encoded = run_follower_bench(true, entries, follower_messages);
+        std::cout.clear();
+        std::cout.rdbuf(cout_buf);
+        std::cout << "[msg_bench] follower entries: " << entries << " decoded entries/s: " << (uint64_t) decoded;
+        std::cout << " encoded entries/s: " << (uint64_t) encoded << std::endl;
+    }
+    return 0;
+}
@@ -1,257 +1,644 @@
 #include <cstdlib>
 #include <iostream>
+#include <chrono>
+#include <algorithm>
 #include <sys/socket.h>
 #include <arpa/inet.h>
 #include <unistd.h>
+#include <string.h>
+#include <errno.h>
 #include "network.h"
 #include "message.h"
-#include "server.h"
+#include "blockchain.h"
+#include "msg_arena.h"
+#include "shm_link.h"
 
 #define DEBUG_MODE
 
-Network::Network(Server *context) {
-    this->context = context;
+Network::Network(int server_id, Transport* transport) {
+    this->server_id = server_id;
+    this->transport = transport;
+    stop_flag = false;
+    peer_conns.resize(get_config().server_count);
+    for (int shard_id = 0; shard_id < get_config().shard_count; shard_id++) {
+        replica_msg_queues.emplace_back(new shard_msg_queue_t());
+        client_req_queues.emplace_back(new shard_req_queue_t(get_config().client_count));
+        shard_signals.emplace_back(new QueueSignal());
+    }
+    client_queued = std::vector<std::atomic<int>>(get_config().client_count);
+    clients.assign(get_config().client_count, client_info_t());
+    if (transport != NULL) {
+        return;
+    }
+    loop = new EventLoop();
     setup_replica_server();
     setup_client_server();
 }
 
+Network::~Network() {
+    stop_flag = true;
+    if (replica_conn_thread.joinable()) {
+        replica_conn_thread.join();
+    }
+    if (loop == NULL) {
+        return;
+    }
+    // no handler runs once the inbox and the loop are deleted, the links left are closed with their last reference.
+    delete replica_inbox;
+    delete loop;
+    close(client_server_fd);
+    if (replica_server_fd >= 0) {
+        close(replica_server_fd);
+        link_remove(get_config().replica_base_port + server_id);
+    }
+}
+
 /**
- * @brief Initialize the server and connections between replicas.
+ * @brief Initialize the server and connections between replicas. Through the mesh, the replica connects to it
+ *        and nothing else. Directly, every server listens for the servers with a higher id and connects
+ *        to the ones with a lower id, so every pair of servers shares one connection.
+ *        Over shared memory, the others write to the inbox of the server instead, the mesh to ring 0
+ *        and the servers to the ring of their id, and the server writes to theirs.
  * 
  */
 void Network::setup_replica_server() {
-    replica_conn_thread = std::thread(&Network::replica_conn_handler, this);
+    const cluster_config_t &config = get_config();
+    bool through_mesh = (config.replica_transport == REPLICA_MESH);
+    if (config.replica_link == LINK_SHM) {
+        int port = through_mesh ? config.replica_client_base_port + server_id : config.replica_base_port + server_id;
+        replica_inbox = new ShmInbox(port, through_mesh ? 1 : config.server_count,
+            [this](int ring, const uint8_t* data, size_t size) { replica_recv_frame(data, size); });
+        if (!replica_inbox->is_ready()) {
+            std::cerr << "[Network::setup_replica_server] failed to set up the replica inbox." << std::endl;
+            exit(1);
+        }
+    }
+    if (through_mesh) {
+        replica_conn_thread = std::thread(&Network::replica_conn_handler, this);
+        return;
+    }
+
+    if (config.replica_link != LINK_SHM) {
+        replica_server_fd = link_listen(config.get_server_ip(server_id), config.replica_base_port + server_id, config.server_count);
+        if (replica_server_fd < 0) {
+            std::cerr << "[Network::setup_replica_server] failed to listen the replica port: " << strerror(errno) << std::endl;
+            exit(1);
+        }
+        if (!loop->listen(replica_server_fd, [this](int sock, const sockaddr_in &peer_addr) { peer_accept(sock); })) {
+            std::cerr << "[Network::setup_replica_server] failed to watch the replica port." << std::endl;
+            exit(1);
+        }
+    }
+    replica_conn_thread = std::thread(&Network::peer_conn_handler, this);
+}
+
+/**
+ * @brief thread function that keeps a connection to every server with a lower id, it connects again
+ *        once a connection is lost. The first frame on the connection is the id of this server.
+ *        Over shared memory it keeps the ring of every other server instead, a ring only goes one way.
+ * 
+ */
+void Network::peer_conn_handler() {
+    std::cout << "[Network::peer_conn_handler] trying to connect to the other replicas directly." << std::endl;
+    bool shm = (get_config().replica_link == LINK_SHM);
+    while (!stop_flag) {
+        for (int peer_id = 0; peer_id < get_config().server_count && !stop_flag; peer_id++) {
+            if (peer_id == server_id || (!shm && peer_id > server_id)) {
+                continue;
+            }
+            std::shared_ptr<Link> conn;
+            {
+                std::lock_guard<std::mutex> lock(replica_send_mutex);
+                conn = peer_conns[peer_id];
+            }
+            // a ring is open as long as the peer keeps its inbox, it's only seen from here.
+            if (conn != NULL && conn->is_open()) {
+                continue;
+            }
+            if (conn != NULL) {
+                peer_closed(peer_id);
+            }
+
+            // the peer isn't up yet, try again in the next round.
+            int port = get_config().replica_base_port + peer_id;
+            if (shm) {
+                conn = ShmLink::open(port, server_id);
+                if (conn != NULL) {
+                    peer_attach(peer_id, conn);
+                }
+                continue;
+            }
+            int sock = link_connect(get_config().get_server_ip(peer_id), port);
+            if (sock < 0) {
+                continue;
+            }
+            conn = loop->attach(sock,
+                [this](const uint8_t* data, size_t size) { replica_recv_frame(data, size); },
+                [this, peer_id]() { peer_closed(peer_id); });
+            if (conn == NULL) {
+                continue;
+            }
+            uint8_t hello[HELLO_BYTES];
+            write_hello(hello, server_id);
+            conn->send_frame(hello, sizeof(hello));
+            peer_attach(peer_id, conn);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    }
+}
+
+void Network::peer_accept(int sock) {
+    // the peer is known from its first frame, the frames after it are replica messages.
+    // the loop runs the handlers, the first frame can't come before the connection is known.
+    auto self = std::make_shared<std::weak_ptr<Connection>>();
+    auto peer_id = std::make_shared<int>(-1);
+    std::shared_ptr<Connection> conn = loop->attach(sock,
+        [this, self, peer_id](const uint8_t* data, size_t size) {
+            if (*peer_id >= 0) {
+                replica_recv_frame(data, size);
+                return;
+            }
+            std::shared_ptr<Connection> conn = self->lock();
+            int hello = read_hello(data, size, get_config().server_count);
+            if (hello < 0 || hello == server_id) {
+                std::cerr << "[Network::peer_accept] received an invalid hello, closing the connection." << std::endl;
+                if (conn != NULL) {
+                    conn->close();
+                }
+                return;
+            }
+            *peer_id = hello;
+            if (conn != NULL) {
+                peer_attach(hello, conn);
+            }
+        },
+        [this, peer_id]() { peer_closed(*peer_id); });
+    *self = conn;
+}
+
+/**
+ * @brief the connection replaces the previous one of the peer, ie. the peer restarted
+ *        before the loss of the previous one was noticed.
+ * 
+ */
+void Network::peer_attach(int peer_id, const std::shared_ptr<Link> &conn) {
+    std::lock_guard<std::mutex> lock(replica_send_mutex);
+    if (peer_conns[peer_id] != NULL && peer_conns[peer_id] != conn) {
+        peer_conns[peer_id]->close();
+    }
+    peer_conns[peer_id] = conn;
+    std::cout << "[Network::peer_attach] connected to server: " << peer_id << std::endl;
+}
+
+void Network::peer_closed(int peer_id) {
+    if (peer_id < 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(replica_send_mutex);
+    // the peer may already be back on a new connection.
+    if (peer_conns[peer_id] != NULL && !peer_conns[peer_id]->is_open()) {
+        peer_conns[peer_id].reset();
+        std::cout << "[Network::peer_closed] the connection to server " << peer_id << " is lost." << std::endl;
+    }
 }
 
 /**
- * @brief thread function that connects the current the current replica to the mesh
+ * @brief thread function that connects the current the current replica to the mesh. Over TCP the mesh knows
+ *        the replica from its port, over a unix socket from the first frame. Over shared memory the replica
+ *        writes to its ring of the mesh's inbox and sees the mesh is gone once the inbox is.
  * 
  */
 void Network::replica_conn_handler() {
     std::cout << "[Network::replica_conn_handler] trying to connect to other replica through network mesh." << std::endl;
+    replica_link_t link = get_config().replica_link;
     while(!stop_flag) {
         if (mesh_connected) {
+            if (link == LINK_SHM && !mesh_conn->is_open()) {
+                std::cout << "[Network::replica_conn_handler] the mesh inbox is gone." << std::endl;
+                mesh_connected = false;
+            }
             std::this_thread::sleep_for(std::chrono::milliseconds(1000));
             continue;
         }
-        
-        replica_socket = socket(AF_INET, SOCK_STREAM, 0);
-        int flag;
-        if (setsockopt(replica_socket, SOL_SOCKET, SO_REUSEPORT, &flag, sizeof(flag)) < 0) {
-            std::cerr << "[Network::replica_conn_handler] failed to set the socket options." << std::endl;
-            close(replica_socket);
+
+        if (link == LINK_SHM) {
+            std::shared_ptr<Link> conn = ShmLink::open(get_config().mesh_port, server_id);
+            if (conn == NULL) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(replica_send_mutex);
+            mesh_conn = conn;
+            mesh_connected = true;
             continue;
         }
 
-        // bind to replica specific ip and port
-        // the mesh can identify the replica id based on the port number.
-        sockaddr_in bind_addr;
-        bind_addr.sin_family = AF_INET;
-        bind_addr.sin_addr.s_addr = inet_addr(REPLICA_CLIENT_IP);
-        bind_addr.sin_port = htons(REPLICA_CLIENT_BASE_PORT + get_context()->get_id());
-
-        if (bind(replica_socket, (sockaddr*) &bind_addr, sizeof(bind_addr)) < 0) {
-            std::cerr << "[Network::replica_conn_handler] failed to bind self address." << std::endl;
-            close(replica_socket);
-            replica_socket = 0;
+        int sock = (link == LINK_UNIX) ? link_connect("", get_config().mesh_port) : mesh_connect_tcp();
+        if (sock < 0) {
+            if (link == LINK_UNIX) {
+                std::cerr << "[Network::replica_conn_handler] failed to connect the mesh." << std::endl;
+            }
             std::this_thread::sleep_for(std::chrono::milliseconds(3000));
             continue;
         }
 
-        // indicate the mesh address and port
-        sockaddr_in mesh_addr;
-        mesh_addr.sin_family = AF_INET;
-        mesh_addr.sin_addr.s_addr = inet_addr(MESH_IP);
-        mesh_addr.sin_port = htons(MESH_PORT);
-        
-        if (connect(replica_socket, (sockaddr*) &mesh_addr, sizeof(mesh_addr)) < 0) {
-            std::cerr << "[Network::replica_conn_handler] failed to connect the mesh." << std::endl;
-            close(replica_socket);
+        // the loop hands every message over to replica_recv_frame and tells when the connection is lost.
+        mesh_connected = true;
+        std::shared_ptr<Connection> conn = loop->attach(sock,
+            [this](const uint8_t* data, size_t size) { replica_recv_frame(data, size); },
+            [this]() {
+                std::cout << "[Network::replica_conn_handler] the mesh connection is lost." << std::endl;
+                mesh_connected = false;
+            });
+        if (conn == NULL) {
+            mesh_connected = false;
             std::this_thread::sleep_for(std::chrono::milliseconds(3000));
             continue;
         }
+        if (link == LINK_UNIX) {
+            uint8_t hello[HELLO_BYTES];
+            write_hello(hello, server_id);
+            conn->send_frame(hello, sizeof(hello));
+        }
+        std::lock_guard<std::mutex> lock(replica_send_mutex);
+        mesh_conn = conn;
+    }
+}
 
-        // just in case the previous receive thread is still running
-        // need to join the previous thread
-        try {
-            replica_recv_thread.join();
-        } catch (...) {}
-        
-        // set the mesh status to be connected and start a new thread.
-        mesh_connected = true;
-        replica_recv_thread = std::thread(&Network::replica_recv_handler, this);
+/**
+ * @brief a socket connected to the mesh from the port of the replica, -1 if it failed.
+ * 
+ */
+int Network::mesh_connect_tcp() {
+    int sock = socket(AF_INET, SOCK_STREAM, 0);
+    int flag;
+    if (setsockopt(sock, SOL_SOCKET, SO_REUSEPORT, &flag, sizeof(flag)) < 0) {
+        std::cerr << "[Network::mesh_connect_tcp] failed to set the socket options." << std::endl;
+        close(sock);
+        return -1;
+    }
+
+    // bind to replica specific ip and port
+    // the mesh can identify the replica id based on the port number.
+    sockaddr_in bind_addr;
+    bind_addr.sin_family = AF_INET;
+    bind_addr.sin_addr.s_addr = inet_addr(get_config().replica_client_ip.c_str());
+    bind_addr.sin_port = htons(get_config().replica_client_base_port + server_id);
+
+    if (bind(sock, (sockaddr*) &bind_addr, sizeof(bind_addr)) < 0) {
+        std::cerr << "[Network::mesh_connect_tcp] failed to bind self address." << std::endl;
+        close(sock);
+        return -1;
+    }
 
+    // indicate the mesh address and port
+    sockaddr_in mesh_addr;
+    mesh_addr.sin_family = AF_INET;
+    mesh_addr.sin_addr.s_addr = inet_addr(get_config().mesh_ip.c_str());
+    mesh_addr.sin_port = htons(get_config().mesh_port);
+    
+    if (connect(sock, (sockaddr*) &mesh_addr, sizeof(mesh_addr)) < 0) {
+        std::cerr << "[Network::mesh_connect_tcp] failed to connect the mesh." << std::endl;
+        close(sock);
+        return -1;
     }
+    return sock;
 }
 
-void Network::replica_recv_handler() {
-    std::cout << "[Network::replica_recv_handler] start receiving mesh messages." << std::endl;
-    while (!stop_flag && mesh_connected) {
-        int count = 0;
-        COMM_HEADER_TYPE msg_bytes = 0;
-        count = read(replica_socket, &msg_bytes, sizeof(msg_bytes));
-        if (count <= 0) {
-            break;
-        } else if (count < sizeof(msg_bytes)) {
-            std::cerr << "[Network::replica_recv_handler] received broken header." << std::endl;
-            continue;
+void Network::replica_recv_frame(const uint8_t* data, size_t size) {
+    ArenaBatch batch;
+    replica_msg_t* replica_msg = MsgArena::create<replica_msg_t>();
+    if (!replica_msg->ParseFromArray(data, size)) {
+        std::cerr << "[Network::replica_recv_frame] received broken message." << std::endl;
+        return;
+    }
+    replica_deliver(*replica_msg);
+}
+
+void Network::replica_deliver(const replica_msg_t &replica_msg) {
+    if (replica_msg.shard_id() >= replica_msg_queues.size()) {
+        std::cout << "[Network::replica_deliver] received a message of unknown shard: " << replica_msg.shard_id() << std::endl;
+        return;
+    }
+    replica_msg_wrapper_t* wrapper = ReplicaMsgPool::acquire();
+    parse_replica_msg(replica_msg, *wrapper);
+    if (wrapper->type == NONE) {
+        ReplicaMsgPool::release(wrapper);
+        return;
+    }
+    replica_push_message(wrapper, replica_msg.shard_id());
+}
+
+/**
+ * @brief convert a received message to the wrapper used by the raft states. The wrapper is usually a recycled one,
+ *        the entries are copied as encoded into the storage of the previous ones. The type is NONE if it's broken.
+ *
+ * @param replica_msg
+ * @param wrapper
+ */
+void Network::parse_replica_msg(const replica_msg_t &replica_msg, replica_msg_wrapper_t &wrapper) {
+    // based on the message type, parse the information and save to the wrapper object
+    wrapper.type = (replica_msg_type_t) replica_msg.type();
+    if (wrapper.type == REQ_VOTE_RPC || wrapper.type == REQ_PREVOTE_RPC) {
+        request_vote_rpc_t &vote_rpc = wrapper.vote_rpc;
+        const request_vote_rpc_msg_t &vote_rpc_msg = replica_msg.request_vote_rpc_msg();
+        vote_rpc.candidate_id = vote_rpc_msg.candidate_id();
+        vote_rpc.term = vote_rpc_msg.term();
+        vote_rpc.last_log_term = vote_rpc_msg.last_log_term();
+        vote_rpc.last_log_index = vote_rpc_msg.last_log_index();
+        vote_rpc.leadership_transfer = vote_rpc_msg.leadership_transfer();
+    } else if (wrapper.type == REQ_VOTE_RPL || wrapper.type == REQ_PREVOTE_RPL) {
+        request_vote_reply_t &vote_reply = wrapper.vote_reply;
+        const request_vote_reply_msg_t &vote_reply_msg = replica_msg.request_vote_reply_msg();
+        vote_reply.term = vote_reply_msg.term();
+        vote_reply.vote_granted = vote_reply_msg.vote_granted();
+        vote_reply.sender_id = vote_reply_msg.sender_id();
+    } else if (wrapper.type == APP_ENTR_RPC) {
+        append_entry_rpc_t &append_rpc = wrapper.append_rpc;
+        const append_entry_rpc_msg_t &append_rpc_msg = replica_msg.append_entry_rpc_msg();
+        append_rpc.term = append_rpc_msg.term();
+        append_rpc.leader_id = append_rpc_msg.leader_id();
+        append_rpc.prev_log_index = append_rpc_msg.prev_log_index();
+        append_rpc.prev_log_term = append_rpc_msg.prev_log_term();
+        append_rpc.commit_index = append_rpc_msg.commit_index();
+        // the entries are only copied, their terms read, they're decoded once the follower logs them.
+        append_rpc.entries.clear();
+        append_rpc.encoded.clear();
+        for (int i = 0; i < append_rpc_msg.entries_size(); i++) {
+            term_t term;
+            if (!Block::peek_term(append_rpc_msg.entries(i), term)) {
+                std::cout << "[Network::parse_replica_msg] received a broken entry." << std::endl;
+                wrapper.type = NONE;
+                return;
+            }
+            append_rpc.encoded.add(append_rpc_msg.entries(i), term);
         }
+    } else if (wrapper.type == APP_ENTR_RPL) {
+        append_entry_reply_t &append_reply = wrapper.append_reply;
+        const append_entry_reply_msg_t &append_reply_msg = replica_msg.append_entry_reply_msg();
+        append_reply.term = append_reply_msg.term();
+        append_reply.sender_id = append_reply_msg.sender_id();
+        append_reply.success = append_reply_msg.success();
+        append_reply.reply_hearbeat = append_reply_msg.reply_heartbeat();
+        append_reply.match_index = append_reply_msg.match_index();
+        append_reply.commit_index = append_reply_msg.commit_index();
+    } else if (wrapper.type == TIMEOUT_NOW_RPC) {
+        timeout_now_rpc_t &timeout_now = wrapper.timeout_now;
+        const timeout_now_msg_t &timeout_now_msg = replica_msg.timeout_now_msg();
+        timeout_now.term = timeout_now_msg.term();
+        timeout_now.leader_id = timeout_now_msg.leader_id();
+    } else if (wrapper.type >= XSHARD_PREPARE_RPC && wrapper.type <= XSHARD_DECISION_RPL) {
+        xshard_rpc_t &xshard = wrapper.xshard;
+        const xshard_msg_t &xshard_msg = replica_msg.xshard_msg();
+        xshard.txn_id = xshard_msg.txn_id();
+        xshard.from_shard = xshard_msg.from_shard();
+        xshard.sender_id = xshard_msg.sender_id();
+        xshard.recver_id = xshard_msg.recver_id();
+        xshard.amount = xshard_msg.amount();
+        xshard.commit = xshard_msg.commit();
+    } else {
+        std::cout << "[Network::parse_replica_msg] received unknown type." << std::endl;
+        wrapper.type = NONE;
+    }
+}
 
-        msg_bytes = ntohl(msg_bytes);
-        uint8_t *msg = new uint8_t[msg_bytes];
-        count = read(replica_socket, msg, msg_bytes);
-        if (count <= 0) {
-            delete [] msg;
-            break;
-        } else if (count < msg_bytes) {
-            delete [] msg;
-            std::cerr << "[Network::replica_recv_handler] received broken body." << std::endl;
-            continue;
+/**
+ * @brief the pools are never freed: an envelope can come back after the thread it came from exited,
+ *        the pool is then adopted by the next thread taking one.
+ */
+std::mutex ReplicaMsgPool::pools_mutex;
+std::vector<ReplicaMsgPool::pool_t*> ReplicaMsgPool::pools;
+std::atomic<uint64_t> ReplicaMsgPool::allocations(0);
+
+ReplicaMsgPool::pool_t* ReplicaMsgPool::local_pool() {
+    static thread_local owner_t owner;
+    if (owner.pool != NULL) {
+        return owner.pool;
+    }
+    std::lock_guard<std::mutex> lock(pools_mutex);
+    for (pool_t* pool : pools) {
+        if (!pool->owned) {
+            pool->owned = true;
+            owner.pool = pool;
+            return pool;
         }
+    }
+    owner.pool = new pool_t();
+    owner.pool->free.reserve(MSG_POOL_SIZE);
+    owner.pool->owned = true;
+    pools.push_back(owner.pool);
+    return owner.pool;
+}
 
-        replica_msg_t replica_msg;
-        replica_msg.ParseFromArray(msg, msg_bytes);
-        delete [] msg; 
-
-        // based on the message type, parse the information and save to the wrapper object
-        replica_msg_wrapper_t *wrapper = new replica_msg_wrapper_t();
-        wrapper->type = (replica_msg_type_t) replica_msg.type();
-        if (wrapper->type == REQ_VOTE_RPC) {
-            request_vote_rpc_t *vote_rpc = new request_vote_rpc_t();
-            const request_vote_rpc_msg_t &vote_rpc_msg = replica_msg.request_vote_rpc_msg();
-            vote_rpc->candidate_id = vote_rpc_msg.candidate_id();
-            vote_rpc->term = vote_rpc_msg.term();
-            vote_rpc->last_log_term = vote_rpc_msg.last_log_term();
-            vote_rpc->last_log_index = vote_rpc_msg.last_log_index();
-            wrapper->payload = (void*) vote_rpc;
-        } else if (wrapper->type == REQ_VOTE_RPL) {
-            request_vote_reply_t *vote_reply = new request_vote_reply_t();
-            const request_vote_reply_msg_t &vote_reply_msg = replica_msg.request_vote_reply_msg();
-            vote_reply->term = vote_reply_msg.term();
-            vote_reply->vote_granted = vote_reply_msg.vote_granted();
-            wrapper->payload = (void*) vote_reply;
-        } else if (wrapper->type == APP_ENTR_RPC) {
-            append_entry_rpc_t *append_rpc = new append_entry_rpc_t();
-            const append_entry_rpc_msg_t &append_rpc_msg = replica_msg.append_entry_rpc_msg();
-            append_rpc->term = append_rpc_msg.term();
-            append_rpc->leader_id = append_rpc_msg.leader_id();
-            append_rpc->prev_log_index = append_rpc_msg.prev_log_index();
-            append_rpc->prev_log_term = append_rpc_msg.prev_log_term();
-            append_rpc->commit_index = append_rpc_msg.commit_index();
-            for (int i = 0; i < append_rpc_msg.entries_size(); i++) {
-                Block block;
-                Transaction txn;
-                const block_msg_t &block_msg = replica_msg.append_entry_rpc_msg().entries(i);
-                txn.set_sender_id(block_msg.txn().sender_id());
-                txn.set_recver_id(block_msg.txn().recver_id());
-                txn.set_amount(block_msg.txn().amount());
-
-                block.set_term(block_msg.term());
-                block.set_phash(block_msg.phash());
-                block.set_nonce(block_msg.nonce());
-                block.set_index(block_msg.index());
-                block.set_txn(txn);
-
-                append_rpc->entries.push_back(block);
-            }
-            wrapper->payload = (void*) append_rpc;
-        } else if (wrapper->type == APP_ENTR_RPL) {
-            append_entry_reply_t *append_reply = new append_entry_reply_t();
-            const append_entry_reply_msg_t &append_reply_msg = replica_msg.append_entry_reply_msg();
-            append_reply->term = append_reply_msg.term();
-            append_reply->sender_id = append_reply_msg.sender_id();
-            append_reply->success = append_reply_msg.success();
-            append_reply->reply_hearbeat = append_reply_msg.reply_heartbeat();
-            wrapper->payload = (void*) append_reply;
-        } else {
-            std::cout << "[Network::replica_recv_handler] received unknown type." << std::endl;
+replica_msg_wrapper_t* ReplicaMsgPool::acquire() {
+    pool_t* pool = local_pool();
+    replica_msg_wrapper_t* msg = NULL;
+    if (pool->free.empty()) {
+        // take back the envelopes the other threads are done with.
+        while (pool->free.size() < MSG_POOL_SIZE && pool->returned.pop(msg)) {
+            pool->free.push_back(msg);
         }
-        replica_msg_queue.push_back(wrapper);
-        // std::cout << "[Network::replica_recv_handler] received and saved." << std::endl;
     }
-    std::cout << "[Network]::replica_recv_handler] the mesh connection is lost." << std::endl;
-    close(replica_socket);
+    if (!pool->free.empty()) {
+        msg = pool->free.back();
+        pool->free.pop_back();
+        return msg;
+    }
+    allocations++;
+    pooled_msg_t* pooled = new pooled_msg_t();
+    pooled->home = pool;
+    return pooled;
 }
 
-void Network::replica_send_message(replica_msg_wrapper_t &msg, int id) {
-    if (id < -1 || id >= SERVER_COUNT) {
-        std::cout << "[Network::replica_send_message] invalid server id number." << std::endl;
+void ReplicaMsgPool::release(replica_msg_wrapper_t* msg) {
+    pooled_msg_t* pooled = static_cast<pooled_msg_t*>(msg);
+    msg->type = NONE;
+    if (pooled->home == local_pool()) {
+        if (pooled->home->free.size() < MSG_POOL_SIZE) {
+            pooled->home->free.push_back(msg);
+            return;
+        }
+    } else if (pooled->home->returned.push(msg)) {
         return;
     }
-    if (id == -1) {
-        for (int i = 0; i < SERVER_COUNT; i++) {
-            if (i == get_context()->get_id())
-                continue;
-            replica_send_message(msg, i);
-        }
+    delete pooled;
+}
+
+void Network::replica_push_message(replica_msg_wrapper_t* wrapper, int shard_id) {
+    // a raft thread far behind loses messages like a lossy network would, the senders retry.
+    if (!replica_msg_queues[shard_id]->queue.push(wrapper)) {
+        std::cout << "[Network::replica_push_message] the queue of shard " << shard_id << " is full, dropped a message of type: " << wrapper->type << std::endl;
+        ReplicaMsgPool::release(wrapper);
         return;
     }
+    shard_signals[shard_id]->notify();
+}
+
+bool Network::build_replica_msg(replica_msg_wrapper_t &msg, int shard_id, replica_msg_t &send_msg) {
     replica_msg_type_t type = msg.type;
-    replica_msg_t send_msg;
     send_msg.set_type(type);
-    send_msg.set_receiver_id(id);
+    send_msg.set_shard_id(shard_id);
     // need to construct the send_msg based on the input msg before sending it.
-    if (type == REQ_VOTE_RPC) {
-        auto vote_rpc = (request_vote_rpc_t*) msg.payload;
-        auto vote_rpc_msg = new request_vote_rpc_msg_t();
+    if (type == REQ_VOTE_RPC || type == REQ_PREVOTE_RPC) {
+        auto vote_rpc = &msg.vote_rpc;
+        auto vote_rpc_msg = send_msg.mutable_request_vote_rpc_msg();
         vote_rpc_msg->set_term(vote_rpc->term);
         vote_rpc_msg->set_candidate_id(vote_rpc->candidate_id);
         vote_rpc_msg->set_last_log_index(vote_rpc->last_log_index);
         vote_rpc_msg->set_last_log_term(vote_rpc->last_log_term);
-        send_msg.set_allocated_request_vote_rpc_msg(vote_rpc_msg);
-    } else if (type == REQ_VOTE_RPL) {
-        auto vote_rpl = (request_vote_reply_t*) msg.payload;
-        auto vote_rpl_msg = new request_vote_reply_msg_t();
+        if (vote_rpc->leadership_transfer) {
+            vote_rpc_msg->set_leadership_transfer(true);
+        }
+    } else if (type == REQ_VOTE_RPL || type == REQ_PREVOTE_RPL) {
+        auto vote_rpl = &msg.vote_reply;
+        auto vote_rpl_msg = send_msg.mutable_request_vote_reply_msg();
         vote_rpl_msg->set_term(vote_rpl->term);
         vote_rpl_msg->set_vote_granted(vote_rpl->vote_granted);
-        send_msg.set_allocated_request_vote_reply_msg(vote_rpl_msg);
+        vote_rpl_msg->set_sender_id(vote_rpl->sender_id);
     } else if (type == APP_ENTR_RPC) {
-        auto append_rpc = (append_entry_rpc_t*) msg.payload;
-        auto append_rpc_msg = new append_entry_rpc_msg_t();
+        auto append_rpc = &msg.append_rpc;
+        auto append_rpc_msg = send_msg.mutable_append_entry_rpc_msg();
         append_rpc_msg->set_term(append_rpc->term);
         append_rpc_msg->set_leader_id(append_rpc->leader_id);
         append_rpc_msg->set_prev_log_index(append_rpc->prev_log_index);
         append_rpc_msg->set_prev_log_term(append_rpc->prev_log_term);
         append_rpc_msg->set_commit_index(append_rpc->commit_index);
         for (int i = 0; i < append_rpc->entries.size(); i++) {
-            auto block_msg = append_rpc_msg->add_entries();
-            Block &block = append_rpc->entries.at(i);
-            // allocate phash, nonce and txn for the block_msg
-            std::string* phash = new std::string(block.get_phash());
-            std::string* nonce = new std::string(block.get_nonce());
-            auto txn_msg = new txn_msg_t();
-            txn_msg->set_sender_id(block.get_txn().get_sender_id());
-            txn_msg->set_recver_id(block.get_txn().get_recver_id());
-            txn_msg->set_amount(block.get_txn().get_amount());
-            // construct the block_msg
-            block_msg->set_term(block.get_term());
-            block_msg->set_allocated_phash(phash);
-            block_msg->set_allocated_nonce(nonce);
-            block_msg->set_allocated_txn(txn_msg);
-            block_msg->set_index(block.get_index());
+            append_rpc->entries[i].encode(*append_rpc_msg->add_entries());
         }
-        send_msg.set_allocated_append_entry_rpc_msg(append_rpc_msg);
     } else if (type == APP_ENTR_RPL) {
-        auto append_reply = (append_entry_reply_t*) msg.payload;
-        auto append_reply_msg = new append_entry_reply_msg_t();
+        auto append_reply = &msg.append_reply;
+        auto append_reply_msg = send_msg.mutable_append_entry_reply_msg();
         append_reply_msg->set_term(append_reply->term);
         append_reply_msg->set_sender_id(append_reply->sender_id);
         append_reply_msg->set_success(append_reply->success);
         append_reply_msg->set_reply_heartbeat(append_reply->reply_hearbeat);
-        send_msg.set_allocated_append_entry_reply_msg(append_reply_msg);
+        append_reply_msg->set_match_index(append_reply->match_index);
+        append_reply_msg->set_commit_index(append_reply->commit_index);
+    } else if (type == TIMEOUT_NOW_RPC) {
+        auto timeout_now = &msg.timeout_now;
+        auto timeout_now_msg = send_msg.mutable_timeout_now_msg();
+        timeout_now_msg->set_term(timeout_now->term);
+        timeout_now_msg->set_leader_id(timeout_now->leader_id);
+    } else if (type >= XSHARD_PREPARE_RPC && type <= XSHARD_DECISION_RPL) {
+        auto xshard = &msg.xshard;
+        auto xshard_msg = send_msg.mutable_xshard_msg();
+        xshard_msg->set_txn_id(xshard->txn_id);
+        xshard_msg->set_from_shard(xshard->from_shard);
+        xshard_msg->set_commit(xshard->commit);
+        if (type == XSHARD_PREPARE_RPC) {
+            xshard_msg->set_sender_id(xshard->sender_id);
+            xshard_msg->set_recver_id(xshard->recver_id);
+            xshard_msg->set_amount(xshard->amount);
+        }
     } else {
-        std::cout << "[Network::replica_send_message] try to send unknown type." << std::endl;
+        std::cout << "[Network::build_replica_msg] try to send unknown type." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void Network::replica_send_message(replica_msg_wrapper_t &msg, int id, int shard_id) {
+    if (id < -1 || id >= get_config().server_count) {
+        std::cout << "[Network::replica_send_message] invalid server id number." << std::endl;
+        return;
+    }
+    uint64_t receivers = (id == -1) ? get_config().all_servers() & ~(1ULL << server_id) : 1ULL << id;
+    replica_multicast(msg, receivers, shard_id);
+}
+
+void Network::replica_send_to_shard(replica_msg_wrapper_t &msg, int shard_id) {
+    replica_multicast(msg, get_config().all_servers(), shard_id);
+}
+
+/**
+ * @brief the message is encoded once however many servers receive it. Through the mesh it leaves as one frame,
+ *        the mesh forwards it to every receiver of the route header. Directly, the same bytes go to every receiver.
+ * 
+ */
+void Network::replica_multicast(replica_msg_wrapper_t &msg, uint64_t receivers, int shard_id) {
+    receivers &= get_config().all_servers();
+    // a message to one of my own shards doesn't need to go through the mesh, nor to be encoded.
+    if (receivers & (1ULL << server_id)) {
+        replica_msg_wrapper_t* wrapper = ReplicaMsgPool::acquire();
+        *wrapper = msg;
+        replica_push_message(wrapper, shard_id);
+        receivers &= ~(1ULL << server_id);
+    }
+    if (receivers == 0) {
+        return;
+    }
+    ArenaBatch batch;
+    replica_msg_t* send_msg = MsgArena::create<replica_msg_t>();
+    if (!build_replica_msg(msg, shard_id, *send_msg)) {
+        return;
+    }
+    if (transport != NULL) {
+        transport->send_replica_message(server_id, receivers, *send_msg);
         return;
     }
     
-    // send the header first
-    COMM_HEADER_TYPE msg_bytes = htonl(send_msg.ByteSizeLong());
-    write(replica_socket, &msg_bytes, sizeof(msg_bytes));
-    // send the message next
-    std::string msg_string = send_msg.SerializeAsString();
-    write(replica_socket, msg_string.c_str(), send_msg.ByteSizeLong());
-    // no need to free dynamically allocated data because they will be freed by send_msg.
-    return;
+    // serialized straight into the queue of the connection, the loop writes what the socket doesn't take right away.
+    if (get_config().replica_transport == REPLICA_MESH) {
+        uint8_t route_header[ROUTE_HEADER_MAX_BYTES];
+        size_t route_bytes = write_route_header(route_header, receivers);
+        std::lock_guard<std::mutex> lock(replica_send_mutex);
+        if (mesh_conn != NULL) {
+            mesh_conn->send_message(*send_msg, route_header, route_bytes);
+        }
+        return;
+    }
+    if ((receivers & (receivers - 1)) == 0) {
+        std::lock_guard<std::mutex> lock(replica_send_mutex);
+        std::shared_ptr<Link> &conn = peer_conns[__builtin_ctzll(receivers)];
+        if (conn != NULL) {
+            conn->send_message(*send_msg);
+        }
+        return;
+    }
+    static thread_local std::string encoded;
+    send_msg->SerializeToString(&encoded);
+    std::lock_guard<std::mutex> lock(replica_send_mutex);
+    for (int id = 0; id < peer_conns.size(); id++) {
+        if ((receivers & (1ULL << id)) && peer_conns[id] != NULL) {
+            peer_conns[id]->send_frame(encoded);
+        }
+    }
+    // send_msg and its submessages are freed with the batch.
+}
+
+/**
+ * @brief the messages sent until the matching uncork leave with one write to the mesh, or to every peer.
+ *        The corks nest and can come from several shards, the connections corked are the ones uncorked
+ *        even if a connection was replaced in between.
+ * 
+ */
+void Network::replica_cork() {
+    std::lock_guard<std::mutex> lock(replica_send_mutex);
+    cork_marks.push_back(corked_conns.size());
+    if (mesh_conn != NULL) {
+        corked_conns.push_back(mesh_conn);
+    }
+    for (auto &conn : peer_conns) {
+        if (conn != NULL) {
+            corked_conns.push_back(conn);
+        }
+    }
+    for (size_t i = cork_marks.back(); i < corked_conns.size(); i++) {
+        corked_conns[i]->cork();
+    }
+}
+
+void Network::replica_uncork() {
+    std::lock_guard<std::mutex> lock(replica_send_mutex);
+    if (cork_marks.empty()) {
+        return;
+    }
+    while (corked_conns.size() > cork_marks.back()) {
+        corked_conns.back()->uncork();
+        corked_conns.pop_back();
+    }
+    cork_marks.pop_back();
 }
 
 /**
@@ -260,21 +647,53 @@ void Network::replica_send_message(replica_msg_wrapper_t &msg, int id) {
  * 
  * @param msg 
  */
-void Network::replica_pop_message(replica_msg_wrapper_t &msg) {
-    if (replica_get_message_count() == 0) {
+void Network::replica_pop_message(replica_msg_wrapper_t &msg, int shard_id) {
+    shard_msg_queue_t &shard_queue = *replica_msg_queues[shard_id];
+    replica_msg_wrapper_t* wrapper = NULL;
+    if (!shard_queue.returned.empty()) {
+        wrapper = shard_queue.returned.front();
+        shard_queue.returned.pop_front();
+    } else if (!shard_queue.queue.pop(wrapper)) {
+        // empty, or the next message is still being written by its producer.
         msg.type = NONE;
         return;
     }
-    replica_msg_wrapper_t* wrapper = replica_msg_queue.at(0);
-    replica_msg_queue.pop_front();
     
-    msg.type = wrapper->type;
-    msg.payload = wrapper->payload;
-    delete wrapper;
+    // the caller's envelope goes back to the pool in exchange, both keep the storage of their entries.
+    std::swap(msg, *wrapper);
+    ReplicaMsgPool::release(wrapper);
 }
 
-size_t Network::replica_get_message_count() {
-    return replica_msg_queue.size();
+void Network::replica_return_message(replica_msg_wrapper_t &msg, int shard_id) {
+    replica_msg_wrapper_t* wrapper = ReplicaMsgPool::acquire();
+    std::swap(msg, *wrapper);
+    replica_msg_queues[shard_id]->returned.push_front(wrapper);
+}
+
+size_t Network::replica_get_message_count(int shard_id) {
+    return replica_msg_queues[shard_id]->returned.size() + replica_msg_queues[shard_id]->queue.size();
+}
+
+/**
+ * @brief the raft thread of the shard waits here when it has nothing to handle. Under the virtual clock
+ *        it sleeps the whole time, the clock can't be blocked on anything else.
+ *        The queues are checked again once the ticket is taken, a message or a request queued after
+ *        the caller looked would otherwise wait for the timeout. The requests only count if the caller takes them.
+ * 
+ * @param shard_id 
+ * @param ms 
+ * @param takes_requests 
+ */
+void Network::wait_message(int shard_id, uint32_t ms, bool takes_requests) {
+    if (clock_is_virtual()) {
+        clock_sleep_ms(ms);
+        return;
+    }
+    uint64_t ticket = shard_signals[shard_id]->ticket();
+    if (replica_get_message_count(shard_id) != 0 || (takes_requests && client_get_request_count(shard_id) != 0)) {
+        return;
+    }
+    shard_signals[shard_id]->wait_ms(ticket, ms);
 }
 
 /* Clients */
@@ -292,8 +711,8 @@ void Network::setup_client_server() {
 
     sockaddr_in addr = {0};
     addr.sin_family = AF_INET;
-    addr.sin_addr.s_addr = inet_addr(SERVER_IP);
-    addr.sin_port = htons(SERVER_BASE_PORT + get_context()->get_id());
+    addr.sin_addr.s_addr = inet_addr(get_config().get_server_ip(server_id).c_str());
+    addr.sin_port = htons(get_config().server_base_port + server_id);
     
     if (bind(client_server_fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
         std::cerr << "[setup_replica_server] Failed to bind the socket." << std::endl;
@@ -301,148 +720,255 @@ void Network::setup_client_server() {
     }
 
     // double the client_count to leave some margin
-    if (listen(client_server_fd, CLIENT_COUNT * 2) < 0) {
+    if (listen(client_server_fd, get_config().client_count * 2) < 0) {
         std::cerr << "[setup_replica_server] Failed to listen the port." << std::endl;
         exit(1);
     }
     
-    client_wait_thread = std::thread(&Network::client_wait_handler, this);
-    // client_recycle_thread = std::thread(&Network::client_recycle_handler, this);
+    if (!loop->listen(client_server_fd, [this](int sock, const sockaddr_in &client_addr) { client_accept(sock, client_addr); })) {
+        std::cerr << "[setup_client_server] Failed to watch the port." << std::endl;
+        exit(1);
+    }
 }
 
 
-void Network::client_wait_handler() {
-    while (!stop_flag) {
-        sockaddr_in client_addr = {0};
-        socklen_t client_addr_size = sizeof(client_addr);
-        int client_socket = accept(client_server_fd, (sockaddr*) &client_addr, &client_addr_size);
-        if (client_socket < 0) {
-            std::cout << "[wait_clients] Failed to accept client." << std::endl;
-            continue;
-        }
+void Network::client_accept(int sock, const sockaddr_in &client_addr) {
+    // by subtracting the client base port, we can get the client id here
+    int client_id = (ntohs(client_addr.sin_port) - get_config().client_base_port - server_id) / get_config().client_port_mult;
+    if (client_id < 0 || client_id >= clients.size()) {
+        std::cerr << "[Network::client_accept] received invalid client id: " << client_id << std::endl;
+        close(sock);
+        return;
+    }
 
-        // by subtracting the client base port, we can get the client id here
-        int client_id = (ntohs(client_addr.sin_port) - CLIENT_BASE_PORT - get_context()->get_id()) / CLIENT_PORT_MULT;
-        
-        // based on the client id we can save the information in client info array
-        if (clients[client_id].connected == true) {
-            std::cerr << "[Network::client_wait_handler] client: " << client_id << " is already connected." << std::endl;
-            continue;
-        }
+    // based on the client id we can save the information in client info array
+    std::lock_guard<std::mutex> lock(client_send_mutex);
+    if (clients[client_id].connected == true) {
+        std::cerr << "[Network::client_accept] client: " << client_id << " is already connected." << std::endl;
+        close(sock);
+        return;
+    }
 
-        // if these is a lost connection before, need to try to free the previous connection
-        if (clients[client_id].recv_task != NULL) {
-            try {
-                clients[client_id].recv_task->join();
-            } catch(...) {}
-            delete clients[client_id].recv_task;
-            clients[client_id].recv_task = NULL;
+    // update the connected client information based on the client id, the loop serves the socket from now on.
+    clients[client_id].conn = loop->attach(sock,
+        [this, client_id](const uint8_t* data, size_t size) { client_recv_frame(client_id, data, size); },
+        [this, client_id]() {
+            // The client connection is lost, the connection is freed with the last reference.
+            std::cout << "[Network::client_accept] disconnected from client: " << client_id << std::endl;
+            std::lock_guard<std::mutex> lock(client_send_mutex);
+            clients[client_id].connected = false;
+            clients[client_id].conn.reset();
+        });
+    if (clients[client_id].conn == NULL) {
+        return;
+    }
+    clients[client_id].connected = true;
+    clients[client_id].id = client_id;
+    clients[client_id].port = ntohs(client_addr.sin_port);
+    std::cout << "[Network::client_accept] client: " << client_id << " connected." << std::endl;
+}
+
+void Network::client_recv_frame(int client_id, const uint8_t* data, size_t size) {
+    ArenaBatch batch;
+    request_msg_t* request_msg = MsgArena::create<request_msg_t>();
+    if (!request_msg->ParseFromArray(data, size)) {
+        std::cout << "[Network::client_recv_frame] received broken message from client " << client_id << std::endl;
+        return;
+    }
+    client_deliver_request(*request_msg, client_id);
+}
+
+void Network::client_deliver_request(const request_msg_t &request_msg, int client_id) {
+    request_t *request = new request_t();
+    bzero(request, sizeof(request_t));
+    request->type = (message_type_t)request_msg.type();
+    request->client_id = request_msg.client_id();
+    request->request_id = request_msg.request_id();
+    if (request->type == TRANSACTION_REQUEST) {
+        uint32_t sid = request_msg.transaction().sender_id();
+        uint32_t rid = request_msg.transaction().recver_id();
+        float amount = request_msg.transaction().amount();
+        request->payload = new Transaction(sid, rid, amount);
+    }
+    request->recv_time_ms = clock_now_ms();
+
+    int shard_id = route_request(request);
+    std::cout << "[Network::client_deliver_request] received request from client: " << client_id;
+    std::cout << " req# " << request->request_id << std::endl; 
+    if (!client_admit_request(request, shard_id)) {
+        // Tell the client right away instead of letting it time out and resend.
+        std::cout << "[Network::client_deliver_request] busy, refused req# " << request->request_id << " of client: " << client_id << std::endl;
+        response_t response;
+        response.type = SERVER_BUSY;
+        response.request_id = request->request_id;
+        response.succeed = false;
+        response.balance = -1;
+        response.leader_id = server_id;
+        response.shard_id = shard_id;
+        client_send_message(response, client_id);
+        if (request->payload != NULL) {
+            delete (Transaction*) request->payload;
         }
-        
-        // update the connected client information based on the client id
-        clients[client_id].connected = true;
-        clients[client_id].id = client_id;
-        clients[client_id].port = ntohs(client_addr.sin_port);
-        clients[client_id].sock = client_socket;
-        clients[client_id].recv_task = new std::thread(&Network::client_recv_handler, this, client_id);
-        
-        std::cout << "[Network::client_wait_handler] client: " << client_id << " connected." << std::endl;
+        delete request;
     }
 }
 
 /**
- * @brief Client message handler function running after any client is accepted.
- *        When the connection is lost, this function should add the client_info to the recycling list to free dynamic memory.
+ * @brief a transfer is handled by the shard of the sender, which coordinates it if the receiver is in another shard.
+ *        the reads go to the shard of the client's own account.
  * 
- * @param client_info 
+ * @param request 
+ * @return int 
  */
-void Network::client_recv_handler(int client_id) {
-    int sock = clients[client_id].sock;
-    std::cout << "[client_recv_handler] start listening messages from client: " << client_id << std::endl;
-    while (!stop_flag && clients[client_id].connected) {
-        COMM_HEADER_TYPE msg_bytes = 0;
-        int count = 0;
-
-        // read the message header
-        count = read(sock, &msg_bytes, sizeof(msg_bytes));
-        if (count <= 0) {
-            break;
-        } else if (count < sizeof(msg_bytes)) {
-            std::cout << "[Network::client_recv_handler] received borken header from client " << client_id << std::endl;
-            continue; 
-        }
-
-        // read the message body
-        msg_bytes = ntohl(msg_bytes);
-        uint8_t* msg = new uint8_t[msg_bytes];
-        count = read(sock, msg, msg_bytes);
-        if (count <= 0) {
-            delete [] msg;
-            break;
-        } else if (count < sizeof(msg_bytes)) {
-            std::cout << "[Network::client_recv_handler] received borken message from client " << client_id << std::endl;
-            delete [] msg;
-            continue; 
-        }
-
-        request_msg_t request_msg;
-        request_msg.ParseFromArray(msg, msg_bytes);
-        delete [] msg;
-        
-        request_t *request = new request_t();
-        bzero(request, sizeof(request_t));
-        request->type = (message_type_t)request_msg.type();
-        request->client_id = request_msg.client_id();
-        request->request_id = request_msg.request_id();
-        if (request->type == TRANSACTION_REQUEST) {
-            uint32_t sid = request_msg.transaction().sender_id();
-            uint32_t rid = request_msg.transaction().recver_id();
-            float amount = request_msg.transaction().amount();
-            request->payload = new Transaction(sid, rid, amount);
-        }
-
-        client_push_request(request);
-        std::cout << "[Network::client_recv_handler] received request from client: " << client_id;
-        std::cout << " req# " << request->request_id << std::endl; 
+int Network::route_request(request_t* request) {
+    if (request->type == TRANSACTION_REQUEST) {
+        return get_config().shard_of(((Transaction*) request->payload)->get_sender_id());
     }
-    // The client connection is lost. Need to free the dynamically allocated client information.
-    std::cout << "[Network::client_recv_handler] disconnected from client: " << client_id << std::endl;
-    clients[client_id].connected = false;
-    close(sock);
+    return get_config().shard_of(request->client_id);
 }
 
 /**
- * @brief synchronously push a new request to the request queue
+ * @brief push a new request to the request queue of the shard.
+ *        Used for the internal requests of the leader, they're never refused and go before the clients' ones.
+ *        Only called by the raft thread of the shard, the one popping the requests.
  * 
  * @param request 
+ * @param shard_id 
  */
-void Network::client_push_request(request_t* request) {
-    client_req_mutex.lock();
-    client_req_queue.push_back(request);    
-    client_req_mutex.unlock();
+void Network::client_push_request(request_t* request, int shard_id) {
+    client_req_queues[shard_id]->internal.push_back(request);
 }
 
 /**
- * @brief pop the earliest request from the queue
+ * @brief queue a request received from a client. Under overload the queue stops growing:
+ *        it's refused if the queue of the shard is full or the client already has CLIENT_MAX_IN_FLIGHT requests queued.
+ *        A client without any queued request is always admitted, so a busy client can't lock the others out.
+ *        The counts are read without a lock, concurrent producers may overshoot the bounds by a request each.
  * 
+ * @param request 
+ * @param shard_id 
+ * @return true if queued, the caller keeps the request otherwise.
+ */
+bool Network::client_admit_request(request_t* request, int shard_id) {
+    if (request->client_id >= client_queued.size()) {
+        return false;
+    }
+    shard_req_queue_t &queue = *client_req_queues[shard_id];
+    if (client_queued[request->client_id] > 0) {
+        if (queue.client_count >= CLIENT_QUEUE_CAPACITY || client_queued[request->client_id] >= CLIENT_MAX_IN_FLIGHT) {
+            return false;
+        }
+        // every queued client gets a turn in between, the request must still be handled before the client gives up.
+        size_t busy_clients = 0;
+        for (auto &client_queued_here : queue.queued) {
+            busy_clients += client_queued_here > 0;
+        }
+        size_t turns = queue.queued[request->client_id] + 1;
+        if (turns * std::max<size_t>(busy_clients, 1) * queue.handle_ms > CLIENT_REQ_TIMEOUT_MS) {
+            return false;
+        }
+    }
+    // counted before the push, the raft thread only counts down what it popped.
+    client_queued[request->client_id]++;
+    queue.queued[request->client_id]++;
+    queue.client_count++;
+    if (!queue.inbox.push(request)) {
+        client_queued[request->client_id]--;
+        queue.queued[request->client_id]--;
+        queue.client_count--;
+        return false;
+    }
+    shard_signals[shard_id]->notify();
+    return true;
+}
+
+void Network::client_take_inbox(shard_req_queue_t &queue) {
+    request_t* request = NULL;
+    while (queue.inbox.pop(request)) {
+        queue.clients[request->client_id].push_back(request);
+    }
+}
+
+/**
+ * @brief pop the next request from the queue of the shard: the internal ones first in order,
+ *        then every client in turn takes up to client_weight requests (deficit round-robin, every request costs one).
+ *        A client request is shed if it can't be handled before the client gives up on it at CLIENT_REQ_TIMEOUT_MS,
+ *        handling it would only delay the ones that still can. The client is told it's busy if it's still waiting.
+ * 
+ * @param shard_id
+ * @param handle_ms the expected time to handle a request
  * @return request_t* return null if the queue is empty
  */
-request_t* Network::client_pop_request() {
-    if (client_get_request_count() == 0)
-        return NULL;
-    request_t *req = client_req_queue.at(0); 
-    client_req_queue.pop_front();
-    return req;
+request_t* Network::client_pop_request(int shard_id, uint32_t handle_ms) {
+    uint64_t now_ms = clock_now_ms();
+    shard_req_queue_t &queue = *client_req_queues[shard_id];
+    queue.handle_ms = handle_ms;
+    if (!queue.internal.empty()) {
+        request_t *req = queue.internal.front();
+        queue.internal.pop_front();
+        return req;
+    }
+    client_take_inbox(queue);
+    size_t idle_turns = 0;
+    while (queue.client_count > 0) {
+        int client_id = queue.next_client;
+        if (queue.clients[client_id].empty()) {
+            // an idle client doesn't keep its turn.
+            queue.deficit[client_id] = 0;
+            queue.next_client = (client_id + 1) % queue.clients.size();
+            if (++idle_turns > queue.clients.size()) {
+                // the requests counted are admitted but not in the inbox yet, they're taken next time.
+                break;
+            }
+            continue;
+        }
+        idle_turns = 0;
+        if (queue.deficit[client_id] == 0) {
+            queue.deficit[client_id] = get_config().client_weight(client_id);
+        }
+        request_t *req = queue.clients[client_id].front(); 
+        queue.clients[client_id].pop_front();
+        queue.client_count--;
+        queue.queued[client_id]--;
+        if (--queue.deficit[client_id] == 0) {
+            queue.next_client = (client_id + 1) % queue.clients.size();
+        }
+        client_queued[req->client_id]--;
+        uint64_t age_ms = now_ms - req->recv_time_ms;
+        if (age_ms + handle_ms <= CLIENT_REQ_TIMEOUT_MS) {
+            return req;
+        }
+        std::cout << "[Network::client_pop_request] shed req# " << req->request_id << " of client: " << req->client_id << " queued ms: " << age_ms << std::endl;
+        if (age_ms < CLIENT_REQ_TIMEOUT_MS) {
+            response_t response;
+            response.type = SERVER_BUSY;
+            response.request_id = req->request_id;
+            response.succeed = false;
+            response.balance = -1;
+            response.leader_id = server_id;
+            response.shard_id = shard_id;
+            client_send_message(response, req->client_id);
+        }
+        if (req->payload != NULL) {
+            delete (Transaction*) req->payload;
+        }
+        delete req;
+    }
+    return NULL;
 }
 
 
 void Network::client_send_message(response_t& response, int client_id) {
     if (client_id == -1) {
-        for (int i = 0; i < CLIENT_COUNT; i++)
+        for (int i = 0; i < clients.size(); i++)
             client_send_message(response, i);
         return;
     }
 
+    if (transport != NULL) {
+        transport->send_client_response(server_id, client_id, response);
+        return;
+    }
     if (!clients[client_id].connected) {
         std::cout << "[Network::client_send_message] client: " << client_id << " is not connected." << std::endl;
         return;
@@ -455,14 +981,16 @@ void Network::client_send_message(response_t& response, int client_id) {
     // the following values might be not valid depends on the type.
     response_msg.set_balance(response.balance);
     response_msg.set_leader_id(response.leader_id);
+    response_msg.set_shard_id(response.shard_id);
     
-    COMM_HEADER_TYPE msg_bytes = htonl(response_msg.ByteSizeLong());
-    write(clients[client_id].sock, &msg_bytes, sizeof(msg_bytes));
-    write(clients[client_id].sock, response_msg.SerializeAsString().c_str(), response_msg.ByteSizeLong());
+    std::lock_guard<std::mutex> lock(client_send_mutex);
+    if (clients[client_id].conn != NULL) {
+        clients[client_id].conn->send_message(response_msg);
+    }
 }
 
-size_t Network::client_get_request_count() {
-    return client_req_queue.size();
+size_t Network::client_get_request_count(int shard_id) {
+    return client_req_queues[shard_id]->internal.size() + client_req_queues[shard_id]->client_count;
 }
 
 
@@ -5,72 +5,190 @@
 #include <deque>
 #include <vector>
 #include <mutex>
+#include <memory>
+#include <atomic>
 #include "raft.h"
 #include "parameter.h"
 #include "message.h"
+#include "config.h"
+#include "event_loop.h"
+#include "lockfree_queue.h"
 
-class Server;
-
-struct replica_info_t {
-    int socket;
-    bool valid;
-    std::thread task;
-};
+class ShmInbox;
 
 struct client_info_t {
     bool connected;
     int id;
     int port;
-    int sock;
-    std::thread *recv_task;
+    std::shared_ptr<Connection> conn;
 };
 
-class Network {
+// carries the messages of a Network instead of the mesh and client sockets, ie. the in-memory transport of the simulator.
+class Transport {
+public:
+    virtual ~Transport() {};
+    virtual void send_replica_message(int from_id, uint64_t receivers, const replica_msg_t &msg) = 0;   // To every server of the mask, the shard is in the message.
+    virtual void send_client_response(int from_id, int client_id, const response_t &response) = 0;
+};
+
+// recycles the envelopes of the replica messages queued between the threads. An envelope is taken from the pool
+// of the thread receiving the message and given back by the raft thread once handled, to the pool it came from.
+// Once warmed up, queueing a message allocates nothing.
+class ReplicaMsgPool {
+public:
+    static replica_msg_wrapper_t* acquire();                            // From the pool of the calling thread, allocated if it's empty.
+    static void release(replica_msg_wrapper_t* msg);                    // Any thread, msg must come from acquire().
+    static uint64_t get_allocations() {return allocations;};            // The envelopes ever allocated.
+
 private:
-    Server *context;
-    bool stop_flag = false;
+    struct pool_t {
+        std::vector<replica_msg_wrapper_t*> free;                       // owner thread only
+        MpscQueue<replica_msg_wrapper_t*, MSG_POOL_SIZE> returned;      // given back by the other threads
+        std::atomic<bool> owned;
+        pool_t() : owned(false) {};
+    };
+    struct pooled_msg_t : replica_msg_wrapper_t {
+        pool_t* home;
+    };
+    struct owner_t {                                                    // thread local, lets the pool go when the thread exits.
+        pool_t* pool = NULL;
+        ~owner_t() {if (pool != NULL) pool->owned = false;};
+    };
+    static std::mutex pools_mutex;
+    static std::vector<pool_t*> pools;
+    static std::atomic<uint64_t> allocations;
+
+    static pool_t* local_pool();
+};
 
-    Server* get_context() {return context;};
+// the messages of a shard from the servers, pushed by the loop thread and the other shards, popped by the shard's raft thread.
+struct shard_msg_queue_t {
+    MpscQueue<replica_msg_wrapper_t*, REPLICA_QUEUE_SIZE> queue;
+    std::deque<replica_msg_wrapper_t*> returned;                        // put back by the raft thread, popped before the queue
+};
+
+// the queued requests of a shard. The leader's own requests go first,
+// the clients' ones are taken in deficit round-robin so a busy client can't starve the others.
+// The admitted client requests go through the inbox, only the raft thread of the shard touches the deques.
+struct shard_req_queue_t {
+    MpscQueue<request_t*, CLIENT_INBOX_SIZE> inbox;                     // admitted client requests not taken in turn yet
+    std::deque<request_t*> internal;                                    // config and cross shard entries of the leader
+    std::vector<std::deque<request_t*>> clients;                        // indexed by client id
+    std::vector<int> deficit;                                           // requests the client can still take in its turn, indexed by client id
+    int next_client = 0;                                                // the client whose turn it is
+    std::vector<std::atomic<int>> queued;                               // queued requests of the client, inbox included, indexed by client id
+    std::atomic<size_t> client_count;                                   // queued client requests, inbox included
+    std::atomic<uint32_t> handle_ms;                                    // the time the leader expects to handle a request
+
+    shard_req_queue_t(int client_count) : clients(client_count), deficit(client_count, 0), queued(client_count), client_count(0), handle_ms(0) {};
+};
+
+// shared by the raft groups (shards) of a server process, every shard gets its own message and request queues.
+class Network {
+private:
+    int server_id;
+    std::atomic<bool> stop_flag;
+    Transport* transport = NULL;                                        // Replaces the sockets if set.
+    EventLoop* loop = NULL;                                             // Serves the replica and client sockets.
 
     /////////////////////
     /* replica related */
     /////////////////////
-    int replica_socket = 0;
     bool mesh_connected = false;
-    std::deque<replica_msg_wrapper_t*> replica_msg_queue;            // The message buffer between the server.
+    std::shared_ptr<Link> mesh_conn;                                    // Mesh transport only.
+    int replica_server_fd = -1;                                         // Direct transport only, the servers with a higher id connect here.
+    std::vector<std::shared_ptr<Link>> peer_conns;                      // Direct transport only, indexed by server id.
+    ShmInbox* replica_inbox = NULL;                                     // Shared memory link only, the others write to it.
+    std::vector<std::unique_ptr<shard_msg_queue_t>> replica_msg_queues; // The message buffers between the servers, indexed by shard id.
+    std::mutex replica_send_mutex;                                      // lock of the connections below and above, the shards send concurrently.
+    std::vector<std::shared_ptr<Link>> corked_conns;                    // The connections corked by the corks not undone yet.
+    std::vector<size_t> cork_marks;                                     // The size of corked_conns at every cork not undone yet.
     std::thread replica_conn_thread;                                    // Thread for connecting to other peers.
-    std::thread replica_recv_thread;
 
     void setup_replica_server();                                        // Setup up replica interconnections.
-    void replica_conn_handler();                                        // Thread function for connecting to lower id sites.
-    void replica_recv_handler();                                        // Thread function for recving messages from the mesh
+    void replica_conn_handler();                                        // Thread function for connecting to the mesh.
+    int mesh_connect_tcp();
+    void peer_conn_handler();                                           // Thread function for connecting to lower id sites, direct transport.
+    void peer_accept(int sock);                                         // Called by the loop for every server connecting.
+    void peer_attach(int peer_id, const std::shared_ptr<Link> &conn);   // Send to the peer through conn from now on.
+    void peer_closed(int peer_id);
+    bool build_replica_msg(replica_msg_wrapper_t &msg, int shard_id, replica_msg_t &send_msg);
+    void parse_replica_msg(const replica_msg_t &replica_msg, replica_msg_wrapper_t &wrapper);
+    void replica_push_message(replica_msg_wrapper_t* wrapper, int shard_id);
     
     ////////////////////
     /* client related */
     ////////////////////
     int client_server_fd;
-    client_info_t clients[CLIENT_COUNT] = {0};                          // saves the client information
-    std::mutex client_req_mutex;                                        // lock of the client_req_queue.
-    std::deque<request_t*> client_req_queue;                            // Hold the request from client.
-    std::thread client_wait_thread;                                     // Thread for listening & accepting clients.
+    std::vector<client_info_t> clients;                                 // saves the client information, indexed by client id
+    std::vector<std::unique_ptr<shard_req_queue_t>> client_req_queues;  // Hold the request from client, indexed by shard id.
+    std::vector<std::atomic<int>> client_queued;                        // The queued requests of every client, indexed by client id.
+    std::mutex client_send_mutex;                                       // lock of the client connections, responses are sent by the raft and apply threads.
 
     void setup_client_server();                                         // Setup client connections.
-    void client_wait_handler();                                         // Thread function for listening & accepting clients.
-    void client_recv_handler(int client_id);                            // Thread function for receiving clients message.
+    void client_accept(int sock, const sockaddr_in &client_addr);       // Called by the loop for every accepted client.
+    void client_recv_frame(int client_id, const uint8_t* data, size_t size);
+    int route_request(request_t* request);                              // The shard owning the account the request touches.
+    bool client_admit_request(request_t* request, int shard_id);        // Queue a client request unless the queue or the client's quota is full.
+    void client_take_inbox(shard_req_queue_t &queue);                   // Move the admitted requests to their client's deque, raft thread only.
+
+    std::vector<std::unique_ptr<QueueSignal>> shard_signals;            // Notified by every message and request queued for the shard, indexed by shard id.
 
 public:
     const uint32_t RECYCLE_CHECK_SLEEP_MS = 50;                         // The sleep time until check next time if the queue is empty.
     
-    Network(Server *context);
+    Network(int server_id, Transport* transport = NULL);
+    ~Network();                                                         // Closes every connection.
+
+    int get_id() {return server_id;};
     
     // replica related APIs
-    void replica_send_message(replica_msg_wrapper_t &msg, int id = -1);         // Send the message to the replica identified by the id. If id == -1, send to all.
-    void replica_pop_message(replica_msg_wrapper_t &msg);                       // Pop the message saved in the message queue and fill the info into msg.
-    size_t replica_get_message_count();                                         // Get the count in the message buffer.
+    void replica_send_message(replica_msg_wrapper_t &msg, int id, int shard_id);   // Send the message to the shard's replica identified by the id. If id == -1, send to all the others.
+    void replica_send_to_shard(replica_msg_wrapper_t &msg, int shard_id);         // Send the message to every replica of the shard, this server included.
+    void replica_multicast(replica_msg_wrapper_t &msg, uint64_t receivers, int shard_id);  // Send the message to every server of the mask (bit i for server i).
+    void replica_cork();                                                          // Batch the messages sent until replica_uncork().
+    void replica_uncork();
+    void replica_pop_message(replica_msg_wrapper_t &msg, int shard_id);           // Pop the message saved in the shard's message queue and fill the info into msg.
+    size_t replica_get_message_count(int shard_id);                               // Get the count in the shard's message buffer.
+    void replica_return_message(replica_msg_wrapper_t &msg, int shard_id);        // Put a popped message back in front, for the next state to handle.
+    void replica_deliver(const replica_msg_t &replica_msg);                       // Queue a message received from another server.
+    void replica_recv_frame(const uint8_t* data, size_t size);                    // Decode and queue a message received as a frame, ie. from the mesh.
+    void wait_message(int shard_id, uint32_t ms, bool takes_requests = false);   // Sleep up to ms, back as soon as a message or a request is queued for the shard.
 
     // request related APIs
-    void client_push_request(request_t* request);
-    request_t* client_pop_request();
+    void client_push_request(request_t* request, int shard_id);                     // Raft thread of the shard only.
+    request_t* client_pop_request(int shard_id, uint32_t handle_ms = 0);            // Requests that can't be handled in handle_ms before their deadline are shed.
     void client_send_message(response_t& response, int client_id = -1);          // Send the message to the client identified by the id. If id == -1, send to all.   
-    size_t client_get_request_count();
+    size_t client_get_request_count(int shard_id);
+    void client_deliver_request(const request_msg_t &request_msg, int client_id);  // Queue a request received from the client, or answer it's busy.
+};
+
+// the network as seen by the raft group of one shard, every message and request it handles belongs to the shard.
+class ShardNetwork {
+private:
+    Network* network;
+    int shard_id;
+
+public:
+    ShardNetwork(Network* network, int shard_id) : network(network), shard_id(shard_id) {};
+
+    int get_shard_id() {return shard_id;};
+
+    void replica_send_message(replica_msg_wrapper_t &msg, int id = -1) {network->replica_send_message(msg, id, shard_id);};
+    void replica_send_to_shard(replica_msg_wrapper_t &msg, int shard) {network->replica_send_to_shard(msg, shard);};
+    void replica_multicast(replica_msg_wrapper_t &msg, uint64_t receivers) {network->replica_multicast(msg, receivers, shard_id);};
+    void replica_cork() {network->replica_cork();};
+    void replica_uncork() {network->replica_uncork();};
+    void replica_pop_message(replica_msg_wrapper_t &msg) {network->replica_pop_message(msg, shard_id);};
+    size_t replica_get_message_count() {return network->replica_get_message_count(shard_id);};
+    void replica_return_message(replica_msg_wrapper_t &msg) {network->replica_return_message(msg, shard_id);};
+    void wait_message(uint32_t ms, bool takes_requests = false) {network->wait_message(shard_id, ms, takes_requests);};
+
+    void client_push_request(request_t* request) {network->client_push_request(request, shard_id);};
+    request_t* client_pop_request(uint32_t handle_ms = 0) {return network->client_pop_request(shard_id, handle_ms);};
+    void client_send_message(response_t& response, int client_id = -1) {
+        response.shard_id = shard_id;
+        network->client_send_message(response, client_id);
+    };
+    size_t client_get_request_count() {return network->client_get_request_count(shard_id);};
 };
\ No newline at end of file
@@ -3,20 +3,41 @@
 // general network parameters
 #define MESH_NETWORK_DELAY_MS   500
 
+// simulated disk sync time of every log write, see disk_sync_delay_ms in the cluster config
+#define DISK_SYNC_DELAY_MS      0
+
 // server client communication
 #define COMM_HEADER_TYPE        uint32_t
 
+// the event loop (event_loop.h) handles up to EVENT_LOOP_MAX_EVENTS ready sockets per epoll_wait().
+// Every connection receives into a FRAME_BUFFER_BYTES buffer (framing.h), grown for a longer frame.
+// A connection announcing a frame longer than MAX_FRAME_BYTES is closed.
+#define FRAME_BUFFER_BYTES      65536
+#define EVENT_LOOP_MAX_EVENTS   256
+#define MAX_FRAME_BYTES         (64 * 1024 * 1024)
+
+// note: the cluster topology below only holds the defaults.
+// the values in use are loaded from the cluster config file at startup, see config.h
+
 // clients information
 // note: the way to calculate client id on server:
 // client id = (client_port - server_id - CLIENT_BASE_PORT) / CLIENT_PORT_MULT
-#define CLIENT_COUNT            3
+#define DEFAULT_CLIENT_COUNT    3
 #define CLIENT_IP               "127.0.0.1"
 #define CLIENT_BASE_PORT        11000
 #define CLIENT_PORT_MULT        10
 #define CLIENT_REQ_TIMEOUT_MS   5000
 
+// admission control of the client requests on the server: the queue of every shard is bounded
+// and a client can only have a few requests queued, the others are answered with SERVER_BUSY.
+// A full queue drains within CLIENT_REQ_TIMEOUT_MS at the commit latency of the simulated network.
+#define CLIENT_QUEUE_CAPACITY   4
+#define CLIENT_MAX_IN_FLIGHT    4
+#define CLIENT_BUSY_BACKOFF_MS  1000
+
 // servers information that the client connects to
-#define SERVER_COUNT            3
+#define DEFAULT_SERVER_COUNT    3
+#define DEFAULT_SHARD_COUNT     1
 #define SERVER_IP               "127.0.0.1"
 #define SERVER_BASE_PORT        8020
 
@@ -28,12 +49,59 @@
 // replica sites bind to the following ip and port when connecting to the mesh
 #define REPLICA_CLIENT_IP              "127.0.0.1"
 #define REPLICA_CLIENT_BASE_PORT       8900
+// without the mesh, server <id> listens for the other servers on its server ip and REPLICA_BASE_PORT + <id>
+#define REPLICA_BASE_PORT              8700
+
+// the links of the servers and the mesh on one host (replica_link in config.h) are named after the port they
+// replace: the unix socket <LINK_DIR>/raft_<port>.sock, the shared memory inbox /dev/shm/raft_<port>.
+// An inbox holds a ring of SHM_RING_BYTES for every sender. The messages that don't fit in a full ring wait
+// in a backlog of up to SHM_BACKLOG_BYTES of the link, the ones beyond are dropped like on a lossy network.
+#define LINK_DIR                       "/tmp"
+#define SHM_RING_BYTES                 (4 * 1024 * 1024)
+#define SHM_BACKLOG_BYTES              (16 * 1024 * 1024)
 
 #define NULL_CANDIDATE_ID -1
 
 #define ELECTION_TIMEOUT_MS     10000
 #define HEARTBEAT_PERIOD_MS     2000
 #define LEADER_HANDLE_TIME_MS   7000
+// The followers learn a new commit index from the next AppendEntries, if none is sent within this time
+// after the commit the leader sends them a heartbeat instead of waiting for the heartbeat period.
+#define COMMIT_PIGGYBACK_WAIT_MS 100
+
+// A lagging follower is streamed the missing log in chunks of CATCHUP_CHUNK_SIZE entries,
+// with up to CATCHUP_WINDOW chunks not acknowledged yet (CATCHUP_QUEUE_SIZE is a power of two above it).
+#define CATCHUP_CHUNK_SIZE      64
+#define CATCHUP_WINDOW          4
+#define CATCHUP_QUEUE_SIZE      8
+#define CATCHUP_CHECK_SLEEP_MS  10
+
+// The followers' phi accrual failure detector of the leader (failure_detector.h), see phi_threshold in the cluster config.
+// phi is trusted after PHI_MIN_SAMPLES intervals between the leader's AppendEntries, the latest PHI_WINDOW_SIZE are kept.
+#define PHI_THRESHOLD           8
+#define PHI_MIN_SAMPLES         3
+#define PHI_WINDOW_SIZE         100
+#define PHI_MIN_STD_DEV_MS      100
+
+// A follower or learner serves a stale read only if it heard from the leader within this time
+#define MAX_READ_STALENESS_MS   5000
+
+// The number of committed ranges that can wait for the apply thread (power of two)
+#define APPLY_QUEUE_SIZE        1024
+
+// The messages from the servers that can wait for the raft thread of a shard, the ones beyond are dropped (power of two)
+#define REPLICA_QUEUE_SIZE      4096
+// The admitted client requests that can wait to be taken in turn by the raft thread of a shard (power of two)
+#define CLIENT_INBOX_SIZE       256
+// The responses that can wait for the client's main thread (power of two)
+#define RESPONSE_QUEUE_SIZE     256
+// The replica message envelopes a thread keeps for reuse, and the ones other threads can give back to it (power of two)
+#define MSG_POOL_SIZE           1024
+// The first block of the protobuf arena of a thread, kept across the batches (a catch up chunk of entries fits in it)
+#define MSG_ARENA_BYTES         65536
+
+// The applied index of a balance table file that doesn't have one, the table reflects the committed entries of the log
+#define UNKNOWN_APPLIED_INDEX   -2
 
 // The length of digits of blockchain's committed index
 // ie. digit len = 4 means committed index range from 0 to 9999
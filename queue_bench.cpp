@@ -0,0 +1,112 @@
+/**
+ * @file queue_bench.cpp
+ * @brief measures the handoff from many producer threads to one consumer, through the lock-free MpscQueue
+ *        (lockfree_queue.h) or through a std::deque under a mutex like the replica and request queues used to.
+ *        Every producer pushes its items as fast as the queue takes them, the consumer pops until it has them all.
+ *        For every producer count it prints the items handed over per second.
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <stdint.h>
+#include "lockfree_queue.h"
+
+const char* usage = "Run the program by typing ./queue_bench [items per producer] [producers ...], ie. ./queue_bench 1000000 1 2 4 8";
+
+const size_t QUEUE_SLOTS = 4096;
+
+// the locked queue, bounded like the ring so a slow consumer makes the producers wait in both.
+class LockedQueue {
+public:
+    bool push(uint64_t item) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (items.size() == QUEUE_SLOTS) {
+            return false;
+        }
+        items.push_back(item);
+        return true;
+    }
+    bool pop(uint64_t &item) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (items.empty()) {
+            return false;
+        }
+        item = items.front();
+        items.pop_front();
+        return true;
+    }
+
+private:
+    std::mutex mutex;
+    std::deque<uint64_t> items;
+};
+
+template <typename Q>
+double run_bench(Q &queue, int producers, uint64_t items) {
+    std::atomic<bool> start_flag(false);
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producers; producer++) {
+        threads.push_back(std::thread([&queue, &start_flag, items]() {
+            while (!start_flag) {
+                std::this_thread::yield();
+            }
+            for (uint64_t i = 0; i < items; i++) {
+                while (!queue.push(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        }));
+    }
+    auto start = std::chrono::steady_clock::now();
+    start_flag = true;
+    uint64_t popped = 0;
+    uint64_t item = 0;
+    while (popped < producers * items) {
+        if (queue.pop(item)) {
+            popped++;
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    return popped * 1e6 / std::max<int64_t>(elapsed.count(), 1);
+}
+
+int main(int argc, char* argv[]) {
+    long items = (argc > 1) ? atol(argv[1]) : 1000000;
+    if (items < 1) {
+        std::cout << usage << std::endl;
+        exit(1);
+    }
+    std::vector<int> counts;
+    for (int i = 2; i < argc; i++) {
+        counts.push_back(atoi(argv[i]));
+    }
+    if (counts.empty()) {
+        counts = {1, 2, 4, 8};
+    }
+
+    for (int producers : counts) {
+        if (producers < 1) {
+            continue;
+        }
+        MpscQueue<uint64_t, QUEUE_SLOTS>* ring = new MpscQueue<uint64_t, QUEUE_SLOTS>();
+        LockedQueue* locked = new LockedQueue();
+        double ring_rate = run_bench(*ring, producers, items);
+        double locked_rate = run_bench(*locked, producers, items);
+        std::cout << "[queue_bench] producers: " << producers << " lock-free items/s: " << (uint64_t) ring_rate;
+        std::cout << " mutex+deque items/s: " << (uint64_t) locked_rate << std::endl;
+        delete ring;
+        delete locked;
+    }
+    return 0;
+}
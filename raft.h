@@ -1,5 +1,7 @@
 #pragma once
 #include <stdint.h>
+#include <string>
+#include <vector>
 #include "parameter.h"
 
 // declarations
@@ -12,24 +14,50 @@ typedef enum {
     REQ_VOTE_RPC,               // request vote RPC
     REQ_VOTE_RPL,               // request vote reply
     APP_ENTR_RPC,               // append entry RPC
-    APP_ENTR_RPL                // append entry reply
+    APP_ENTR_RPL,               // append entry reply
+    REQ_PREVOTE_RPC,            // pre-vote RPC, same payload as the request vote RPC with the term the candidate would use
+    REQ_PREVOTE_RPL,            // pre-vote reply, same payload as the request vote reply
+    TIMEOUT_NOW_RPC,            // leadership transfer, the receiver starts an election right away
+    XSHARD_PREPARE_RPC,         // cross shard transfer, the coordinator shard asks the receiver's shard to prepare
+    XSHARD_PREPARE_RPL,         // the participant's vote, sent once its prepare entry is committed
+    XSHARD_DECISION_RPC,        // the coordinator's decision, a commit is sent once the commit entry is committed
+    XSHARD_DECISION_RPL         // the participant committed the decision
 } replica_msg_type_t;
 
-struct replica_msg_wrapper_t{
-    replica_msg_type_t type;        // type determines which struct we should cast the message payload to.
-    void* payload;                  // cast this one to one of the message struct.
-};
-
 struct request_vote_rpc_t{
     int candidate_id;               // the candidate's id who is requesting votes
     term_t term;                    // candidate's term
     term_t last_log_term;           // the term of the last log
     int last_log_index;             // last log's index
+    bool leadership_transfer;       // the election is started by a TIMEOUT_NOW, voters don't wait for the leader to be silent
 };
 
 struct request_vote_reply_t{
-    term_t term;                    // the term of the replier
+    term_t term;                    // the term of the replier, a pre-vote reply echoes the proposed term instead
     bool vote_granted;              // the flag indicates if candidate got the vote
+    int sender_id;                  // who send the message, only votes from voters are counted
+};
+
+// the entries of a received AppendEntries as the leader encoded them, the block_msg_t of every entry one after
+// the other. The follower compares their terms and logs the new ones as they are, without encoding them again.
+struct encoded_entries_t{
+    std::string bytes;
+    std::vector<size_t> ends;       // where every entry ends in bytes
+    std::vector<term_t> terms;      // the term of every entry, read when the message is received
+
+    size_t size() const {return terms.size();};
+    const char* data(size_t i) const {return bytes.data() + (i == 0 ? 0 : ends[i - 1]);};
+    size_t length(size_t i) const {return ends[i] - (i == 0 ? 0 : ends[i - 1]);};
+    void add(const std::string &entry, term_t term) {
+        bytes.append(entry);
+        ends.push_back(bytes.size());
+        terms.push_back(term);
+    };
+    void clear() {                  // The storage is kept for the next message.
+        bytes.clear();
+        ends.clear();
+        terms.clear();
+    };
 };
 
 struct append_entry_rpc_t{
@@ -39,7 +67,8 @@ struct append_entry_rpc_t{
     int prev_log_index;             // the index of the log before the one to append
     int commit_index;               // the index of the commited last entry
     // size_t entry_count;             // the number of entries commited
-    std::vector<Block> entries;
+    std::vector<Block> entries;     // the entries to send, filled by the leader
+    encoded_entries_t encoded;      // the entries received, the blocks above are left empty
 };
 
 struct append_entry_reply_t{
@@ -47,8 +76,35 @@ struct append_entry_reply_t{
     int sender_id;                  // who send the message
     bool success;                   // indicates wether the append is successful.
     bool reply_hearbeat;
-};              
-
+    int match_index;                // the last log index known to match the leader's log (valid on a successful append)
+    int commit_index;               // the replier's committed index, the leader doesn't resend a commit index it already knows
+};
 
+struct timeout_now_rpc_t{
+    term_t term;                    // the leader's term
+    int leader_id;                  // the leader handing over the leadership
+};
 
+// the cross shard messages are sent to every server of the other shard, only its leader handles them.
+struct xshard_rpc_t{
+    uint64_t txn_id;                // picked by the coordinator
+    int from_shard;                 // the replies go back to this shard
+    uint32_t sender_id;             // the transfer, only set in the prepare RPC
+    uint32_t recver_id;
+    float amount;
+    bool commit;                    // the vote in a prepare reply, the decision in a decision RPC
+};
 
+// a replica message, the type tells which member holds it. The small messages share the inline union,
+// the AppendEntries one owns its entries and keeps their storage when the envelope is reused.
+struct replica_msg_wrapper_t{
+    replica_msg_type_t type = NONE;
+    union {
+        request_vote_rpc_t vote_rpc;        // REQ_VOTE_RPC, REQ_PREVOTE_RPC
+        request_vote_reply_t vote_reply;    // REQ_VOTE_RPL, REQ_PREVOTE_RPL
+        append_entry_reply_t append_reply;  // APP_ENTR_RPL
+        timeout_now_rpc_t timeout_now;      // TIMEOUT_NOW_RPC
+        xshard_rpc_t xshard;                // XSHARD_*
+    };
+    append_entry_rpc_t append_rpc;          // APP_ENTR_RPC
+};
@@ -0,0 +1,228 @@
+/**
+ * @file rejoin_test.cpp
+ * @brief measure the client throughput dip when a partitioned follower rejoins, with and without pre-vote.
+ *        It runs ./starter, ./mesh, ./server and ./client from the working directory, partitions a follower
+ *        with the mesh "toggle" command and reads the per second committed count of the client "bench" command.
+ *        The logs of every run are kept in rejoin_<prevote on/off>_<program>.log.
+ *
+ *        usage: ./rejoin_test [config_file]
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "config.h"
+#include "parameter.h"
+
+// timeline of a run in seconds, starting when the client starts the bench.
+const int WARMUP_S = 20;                                        // the baseline throughput is measured in the second half.
+const int PARTITION_S = 3 * ELECTION_TIMEOUT_MS / 1000;         // long enough for the follower to time out several times.
+const int AFTER_S = 40;
+const int BENCH_S = WARMUP_S + PARTITION_S + AFTER_S;
+
+struct child_t {
+    pid_t pid;
+    int in_fd;                                                  // the child's stdin
+    int out_fd;                                                 // the child's stdout if it's read by the test, otherwise -1
+};
+
+struct run_result_t {
+    bool prevote;
+    double baseline;                                            // txn/s before the partition
+    double after_rejoin;                                        // txn/s in the 20 seconds after the rejoin
+    int longest_stall;                                          // consecutive seconds without a commit after the rejoin
+    int leader_changes;                                         // leader changes seen by the client after the rejoin
+};
+
+/**
+ * @brief fork and exec the program. stdout and stderr go to the log file, or to a pipe if log_file is empty.
+ *
+ * @param args
+ * @param log_file
+ * @return child_t
+ */
+static child_t spawn(const std::vector<std::string> &args, const std::string &log_file) {
+    int in_pipe[2], out_pipe[2] = {-1, -1};
+    pipe(in_pipe);
+    if (log_file.empty()) {
+        pipe(out_pipe);
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+        dup2(in_pipe[0], STDIN_FILENO);
+        int out_fd = log_file.empty() ? out_pipe[1] : open(log_file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        dup2(out_fd, STDOUT_FILENO);
+        dup2(out_fd, STDERR_FILENO);
+        close(in_pipe[1]);
+        if (out_pipe[0] != -1) close(out_pipe[0]);
+        std::vector<char*> argv;
+        for (auto &arg : args) {
+            argv.push_back(const_cast<char*>(arg.c_str()));
+        }
+        argv.push_back(NULL);
+        execv(argv[0], argv.data());
+        std::cerr << "[rejoin_test::spawn] failed to run " << args[0] << std::endl;
+        _exit(1);
+    }
+    close(in_pipe[0]);
+    if (out_pipe[1] != -1) close(out_pipe[1]);
+    return {pid, in_pipe[1], out_pipe[0]};
+}
+
+static void send_command(child_t &child, const std::string &cmd) {
+    std::string line = cmd + "\n";
+    write(child.in_fd, line.c_str(), line.size());
+}
+
+static void stop(child_t &child) {
+    kill(child.pid, SIGKILL);
+    waitpid(child.pid, NULL, 0);
+    close(child.in_fd);
+    if (child.out_fd != -1) close(child.out_fd);
+}
+
+/**
+ * @brief one run: start a fresh cluster, bench it, partition a follower and let it rejoin.
+ *
+ * @param base_config the config file the run is based on, the prevote key is appended to it.
+ * @param prevote
+ * @param client_id a different client per run, the client binds fixed ports as well.
+ * @return run_result_t
+ */
+static run_result_t run(const std::string &base_config, bool prevote, int client_id) {
+    std::string name = std::string("rejoin_") + (prevote ? "on" : "off");
+    std::string config_file = name + ".conf";
+    {
+        std::ifstream base(base_config);
+        std::ofstream conf(config_file);
+        conf << base.rdbuf() << std::endl;
+        conf << "prevote = " << (prevote ? "true" : "false") << std::endl;
+    }
+    std::cout << "[rejoin_test::run] prevote: " << (prevote ? "on" : "off") << ", running for about " << BENCH_S + 2 * ELECTION_TIMEOUT_MS / 1000 << " seconds." << std::endl;
+
+    // reset the blockchain and balance table files.
+    child_t starter = spawn({"./starter", config_file}, name + "_starter.log");
+    waitpid(starter.pid, NULL, 0);
+    close(starter.in_fd);
+
+    child_t mesh = spawn({"./mesh", config_file}, name + "_mesh.log");
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    std::vector<child_t> servers;
+    for (int i = 0; i < get_config().server_count; i++) {
+        servers.push_back(spawn({"./server", std::to_string(i), config_file}, name + "_server_" + std::to_string(i) + ".log"));
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+    // give the cluster time to elect the first leader.
+    std::this_thread::sleep_for(std::chrono::milliseconds(2 * ELECTION_TIMEOUT_MS));
+
+    child_t client = spawn({"./client", std::to_string(client_id), config_file}, "");
+    std::vector<int> committed(BENCH_S, 0);
+    std::vector<int> leaders(BENCH_S, -1);
+    std::mutex bench_mutex;
+    std::thread reader([&]() {
+        std::ofstream log(name + "_client.log");
+        FILE* out = fdopen(dup(client.out_fd), "r");
+        char buf[512];
+        while (fgets(buf, sizeof(buf), out) != NULL) {
+            log << buf;
+            int second, count, leader;
+            if (sscanf(buf, "[bench] second: %d committed: %d leader: %d", &second, &count, &leader) == 3 && second < BENCH_S) {
+                std::lock_guard<std::mutex> lock(bench_mutex);
+                committed[second] = count;
+                leaders[second] = leader;
+            }
+            if (strncmp(buf, "[bench] done", 12) == 0)
+                break;
+        }
+        fclose(out);
+    });
+    // wait for the client to connect before the bench starts.
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    send_command(client, "bench " + std::to_string(BENCH_S));
+    auto t0 = std::chrono::system_clock::now();
+
+    // partition a follower.
+    std::this_thread::sleep_until(t0 + std::chrono::seconds(WARMUP_S));
+    int leader;
+    {
+        std::lock_guard<std::mutex> lock(bench_mutex);
+        leader = leaders[WARMUP_S - 2];
+    }
+    int victim = (leader + 1) % get_config().server_count;
+    std::cout << "[rejoin_test::run] leader: " << leader << ", partitioning server " << victim << std::endl;
+    send_command(mesh, "toggle " + std::to_string(victim));
+
+    std::this_thread::sleep_until(t0 + std::chrono::seconds(WARMUP_S + PARTITION_S));
+    std::cout << "[rejoin_test::run] server " << victim << " rejoins" << std::endl;
+    send_command(mesh, "toggle " + std::to_string(victim));
+
+    reader.join();
+    stop(client);
+    for (auto &server : servers) {
+        stop(server);
+    }
+    stop(mesh);
+
+    run_result_t result;
+    result.prevote = prevote;
+    int baseline_commits = 0;
+    for (int s = WARMUP_S / 2; s < WARMUP_S; s++) {
+        baseline_commits += committed[s];
+    }
+    result.baseline = baseline_commits / (double)(WARMUP_S - WARMUP_S / 2);
+    int rejoin = WARMUP_S + PARTITION_S;
+    int after_commits = 0, stall = 0;
+    result.longest_stall = 0;
+    result.leader_changes = 0;
+    for (int s = rejoin; s < BENCH_S; s++) {
+        if (s < rejoin + 20) {
+            after_commits += committed[s];
+        }
+        stall = committed[s] ? 0 : stall + 1;
+        result.longest_stall = std::max(result.longest_stall, stall);
+        if (leaders[s] != leaders[s - 1]) {
+            result.leader_changes++;
+        }
+    }
+    result.after_rejoin = after_commits / 20.0;
+    return result;
+}
+
+int main(int argc, char* argv[]) {
+    std::string config_file = (argc == 2) ? argv[1] : DEFAULT_CONFIG_FILE;
+    if (!load_cluster_config(config_file)) {
+        exit(1);
+    }
+    if (get_config().server_count < 3 || get_config().client_count < 2) {
+        std::cout << "[rejoin_test] need at least 3 servers and 2 clients." << std::endl;
+        exit(1);
+    }
+
+    std::vector<run_result_t> results;
+    results.push_back(run(config_file, false, 0));
+    // the replicas bind fixed ports when connecting to the mesh, wait until the previous run's ones leave TIME_WAIT.
+    std::this_thread::sleep_for(std::chrono::seconds(65));
+    results.push_back(run(config_file, true, 1));
+
+    for (auto &result : results) {
+        std::cout << "[rejoin_test] prevote: " << (result.prevote ? "on " : "off");
+        std::cout << " baseline txn/s: " << result.baseline;
+        std::cout << " after rejoin txn/s: " << result.after_rejoin;
+        std::cout << " longest stall s: " << result.longest_stall;
+        std::cout << " leader changes: " << result.leader_changes << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,354 @@
+/**
+ * @file replica_bench.cpp
+ * @brief measures the replica messages between three servers of one process, connected to each other directly
+ *        or through the mesh (replica_transport in config.h), over loopback TCP, Unix domain sockets or shared
+ *        memory (replica_link). A transport is named like direct/shm, a plain direct or mesh is over TCP. Every server sends AppendEntries to the two others
+ *        as fast as it can, then server 0 sends RequestVotes to server 1 one at a time and waits for every reply.
+ *        For every transport it prints the AppendEntries delivered per second, from the first arrival to the last,
+ *        the time until all of them arrived and the mean round trip.
+ *        The mesh is started from ./mesh, it delays every message by MESH_NETWORK_DELAY_MS.
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstdlib>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "network.h"
+#include "blockchain.h"
+
+const char* usage = "Run the program by typing ./replica_bench [messages] [entries per message] [round trips] [transports ...], ie. ./replica_bench 20000 4 10 direct/tcp direct/unix direct/shm mesh/shm";
+
+const int SERVER_COUNT = 3;
+const int SEND_BATCH = 16;
+const size_t MAX_RUNS = 12;             // the ports of a run are base_port + run * 10, see run_bench().
+const uint32_t POLL_MS = 10;
+const uint32_t CONNECT_TIMEOUT_MS = 30000;
+const char* MESH_CONFIG_FILE = "cluster_bench.conf";
+
+typedef std::chrono::steady_clock bench_clock_t;
+
+struct server_stats_t {
+    std::atomic<uint64_t> appends;
+    std::atomic<int64_t> first_us;      // arrival of the first and the last AppendEntries, since the start of the run.
+    std::atomic<int64_t> last_us;
+    std::atomic<uint64_t> replied;      // the servers that answered the RequestVote of the awaited term.
+    std::atomic<term_t> awaited;
+    server_stats_t() : appends(0), first_us(-1), last_us(0), replied(0), awaited(0) {};
+};
+
+struct bench_result_t {
+    bool connected = false;
+    uint64_t delivered = 0;             // AppendEntries, every server included.
+    double appends = 0;                 // per second
+    double total_ms = 0;                // from the first send to the last arrival, the delay of the mesh included.
+    double round_trip_ms = 0;
+};
+
+int64_t elapsed_us(bench_clock_t::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(bench_clock_t::now() - start).count();
+}
+
+// every server counts the AppendEntries, answers the RequestVotes with the term they carry and notes the replies.
+void serve_replica(Network* network, server_stats_t* stats, bench_clock_t::time_point start, std::atomic<bool>* stop_flag) {
+    replica_msg_wrapper_t msg;
+    while (!*stop_flag) {
+        network->replica_pop_message(msg, 0);
+        if (msg.type == NONE) {
+            network->wait_message(0, POLL_MS);
+            continue;
+        }
+        if (msg.type == APP_ENTR_RPC) {
+            int64_t now_us = elapsed_us(start);
+            if (stats->first_us < 0) {
+                stats->first_us = now_us;
+            }
+            stats->last_us = now_us;
+            stats->appends++;
+        } else if (msg.type == REQ_VOTE_RPC) {
+            int candidate_id = msg.vote_rpc.candidate_id;
+            term_t term = msg.vote_rpc.term;
+            msg.type = REQ_VOTE_RPL;
+            msg.vote_reply.term = term;
+            msg.vote_reply.vote_granted = true;
+            msg.vote_reply.sender_id = network->get_id();
+            network->replica_send_message(msg, candidate_id, 0);
+        } else if (msg.type == REQ_VOTE_RPL && msg.vote_reply.term == stats->awaited) {
+            stats->replied |= 1ULL << msg.vote_reply.sender_id;
+        }
+    }
+}
+
+void send_vote_request(Network* network, term_t term, int id) {
+    replica_msg_wrapper_t msg;
+    msg.type = REQ_VOTE_RPC;
+    msg.vote_rpc.term = term;
+    msg.vote_rpc.candidate_id = network->get_id();
+    msg.vote_rpc.last_log_term = 0;
+    msg.vote_rpc.last_log_index = -1;
+    msg.vote_rpc.leadership_transfer = false;
+    network->replica_send_message(msg, id, 0);
+}
+
+// the mesh of the run, its input kept open so it waits for commands. 0 if it couldn't be started.
+pid_t spawn_mesh(int &input_fd) {
+    int fds[2];
+    if (pipe(fds) < 0) {
+        return 0;
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+        dup2(fds[0], STDIN_FILENO);
+        int null_fd = open("/dev/null", O_WRONLY);
+        dup2(null_fd, STDOUT_FILENO);
+        close(fds[0]);
+        close(fds[1]);
+        execl("./mesh", "./mesh", MESH_CONFIG_FILE, (char*) NULL);
+        _exit(127);
+    }
+    close(fds[0]);
+    input_fd = fds[1];
+    if (pid < 0) {
+        close(input_fd);
+        return 0;
+    }
+    // a mesh that couldn't start is gone by now.
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    if (waitpid(pid, NULL, WNOHANG) != 0) {
+        close(input_fd);
+        return 0;
+    }
+    return pid;
+}
+
+// the mesh leaves once its input is closed and removes its socket or inbox, it's killed if it doesn't.
+void stop_mesh(pid_t pid, int input_fd) {
+    close(input_fd);
+    auto deadline = bench_clock_t::now() + std::chrono::milliseconds(CONNECT_TIMEOUT_MS);
+    while (waitpid(pid, NULL, WNOHANG) == 0) {
+        if (bench_clock_t::now() > deadline) {
+            kill(pid, SIGTERM);
+            waitpid(pid, NULL, 0);
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(POLL_MS));
+    }
+}
+
+bench_result_t run_bench(replica_transport_t transport, replica_link_t link, int run, int messages, int entries, int round_trips) {
+    bench_result_t result;
+    // every run gets its own ports, the ones of the previous runs may still be in TIME_WAIT.
+    int base_port = 20000 + (getpid() % 100) * MAX_RUNS * 10 + run * 10;
+    cluster_config_t config;
+    config.server_count = SERVER_COUNT;
+    config.client_count = 1;
+    config.initial_voters = config.all_servers();
+    config.replica_transport = transport;
+    config.replica_link = link;
+    config.server_base_port = base_port;
+    config.replica_base_port = base_port + SERVER_COUNT;
+    config.replica_client_base_port = base_port + SERVER_COUNT * 2;
+    config.mesh_port = base_port + SERVER_COUNT * 3;
+    set_config(config);
+
+    pid_t mesh_pid = 0;
+    int mesh_input = -1;
+    if (transport == REPLICA_MESH) {
+        std::ofstream file(MESH_CONFIG_FILE);
+        file << "server_count = " << config.server_count << std::endl;
+        file << "client_count = " << config.client_count << std::endl;
+        file << "mesh_port = " << config.mesh_port << std::endl;
+        file << "replica_client_base_port = " << config.replica_client_base_port << std::endl;
+        file << "replica_transport = mesh" << std::endl;
+        file << "replica_link = " << (link == LINK_SHM ? "shm" : link == LINK_UNIX ? "unix" : "tcp") << std::endl;
+        file << "link_dir = " << config.link_dir << std::endl;
+        file.close();
+        mesh_pid = spawn_mesh(mesh_input);
+        if (mesh_pid == 0) {
+            std::cerr << "[replica_bench] couldn't start ./mesh, build it with make mesh." << std::endl;
+            remove(MESH_CONFIG_FILE);
+            return result;
+        }
+    }
+
+    std::vector<Network*> networks;
+    for (int id = 0; id < SERVER_COUNT; id++) {
+        networks.push_back(new Network(id));
+    }
+    auto start = bench_clock_t::now();
+    std::atomic<bool> stop_flag(false);
+    std::vector<server_stats_t> stats(SERVER_COUNT);
+    std::vector<std::thread> servers;
+    for (int id = 0; id < SERVER_COUNT; id++) {
+        servers.push_back(std::thread(serve_replica, networks[id], &stats[id], start, &stop_flag));
+    }
+
+    // the servers are connected once the others answered a RequestVote of term 0 from every server.
+    bool connected = false;
+    auto connect_deadline = bench_clock_t::now() + std::chrono::milliseconds(CONNECT_TIMEOUT_MS);
+    while (!connected && bench_clock_t::now() < connect_deadline) {
+        connected = true;
+        for (int id = 0; id < SERVER_COUNT; id++) {
+            if (stats[id].replied != (config.all_servers() & ~(1ULL << id))) {
+                send_vote_request(networks[id], 0, -1);
+                connected = false;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+    result.connected = connected;
+
+    if (result.connected) {
+        int64_t send_start_us = elapsed_us(start);
+        std::vector<std::thread> senders;
+        for (int id = 0; id < SERVER_COUNT; id++) {
+            senders.push_back(std::thread([&networks, id, messages, entries]() {
+                replica_msg_wrapper_t msg;
+                msg.type = APP_ENTR_RPC;
+                msg.append_rpc.term = 1;
+                msg.append_rpc.leader_id = id;
+                msg.append_rpc.prev_log_term = 1;
+                msg.append_rpc.commit_index = 0;
+                for (int i = 0; i < entries; i++) {
+                    Transaction txn(i % SERVER_COUNT, (i + 1) % SERVER_COUNT, 1.5);
+                    Block block;
+                    block.set_term(1);
+                    block.set_txn(txn);
+                    block.set_phash(std::string(64, 'f'));
+                    block.set_nonce("a3");
+                    block.set_index(i);
+                    msg.append_rpc.entries.push_back(block);
+                }
+                // corked like the messages a leader sends in a round.
+                for (int i = 0; i < messages; i++) {
+                    if (i % SEND_BATCH == 0) {
+                        networks[id]->replica_cork();
+                    }
+                    msg.append_rpc.prev_log_index = i * entries - 1;
+                    networks[id]->replica_send_message(msg, -1, 0);
+                    if (i % SEND_BATCH == SEND_BATCH - 1 || i == messages - 1) {
+                        networks[id]->replica_uncork();
+                    }
+                }
+            }));
+        }
+        for (auto &sender : senders) {
+            sender.join();
+        }
+        // the messages are lost only if a server falls far behind its queue.
+        uint64_t expected = (uint64_t) messages * (SERVER_COUNT - 1);
+        auto deadline = bench_clock_t::now() + std::chrono::milliseconds(CONNECT_TIMEOUT_MS);
+        bool done = false;
+        while (!done && bench_clock_t::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(POLL_MS));
+            done = true;
+            for (auto &server : stats) {
+                done = done && server.appends == expected;
+            }
+        }
+        int64_t first_us = INT64_MAX, last_us = 0;
+        for (auto &server : stats) {
+            result.delivered += server.appends;
+            first_us = std::min<int64_t>(first_us, server.first_us);
+            last_us = std::max<int64_t>(last_us, server.last_us);
+        }
+        result.appends = result.delivered * 1e6 / std::max<int64_t>(last_us - first_us, 1);
+        result.total_ms = (last_us - send_start_us) / 1000.0;
+
+        for (int i = 1; i <= round_trips; i++) {
+            stats[0].replied = 0;
+            stats[0].awaited = i;
+            auto sent = bench_clock_t::now();
+            auto reply_deadline = sent + std::chrono::milliseconds(CONNECT_TIMEOUT_MS);
+            send_vote_request(networks[0], i, 1);
+            while (stats[0].replied == 0 && bench_clock_t::now() < reply_deadline) {
+                std::this_thread::yield();
+            }
+            if (stats[0].replied == 0) {
+                break;
+            }
+            result.round_trip_ms += elapsed_us(sent) / 1000.0 / round_trips;
+        }
+    }
+
+    stop_flag = true;
+    for (auto &server : servers) {
+        server.join();
+    }
+    for (auto network : networks) {
+        delete network;
+    }
+    if (mesh_pid != 0) {
+        stop_mesh(mesh_pid, mesh_input);
+        remove(MESH_CONFIG_FILE);
+    }
+    return result;
+}
+
+int main(int argc, char* argv[]) {
+    int messages = (argc > 1) ? atoi(argv[1]) : 20000;
+    int entries = (argc > 2) ? atoi(argv[2]) : 4;
+    int round_trips = (argc > 3) ? atoi(argv[3]) : 10;
+    if (messages < 1 || entries < 0 || round_trips < 1) {
+        std::cout << usage << std::endl;
+        exit(1);
+    }
+    std::vector<std::string> transports;
+    for (int i = 4; i < argc; i++) {
+        transports.push_back(argv[i]);
+    }
+    if (transports.empty()) {
+        transports = {"direct/tcp", "direct/unix", "direct/shm", "mesh"};
+    }
+    if (transports.size() > MAX_RUNS) {
+        std::cout << usage << std::endl;
+        exit(1);
+    }
+
+    for (int run = 0; run < transports.size(); run++) {
+        std::string name = transports[run], link_name = "tcp";
+        size_t slash = name.find('/');
+        if (slash != std::string::npos) {
+            link_name = name.substr(slash + 1);
+            name = name.substr(0, slash);
+        }
+        replica_transport_t transport;
+        replica_link_t link;
+        if (name == "direct") {
+            transport = REPLICA_DIRECT;
+        } else if (name == "mesh") {
+            transport = REPLICA_MESH;
+        } else {
+            std::cout << usage << std::endl;
+            exit(1);
+        }
+        if (link_name == "tcp") {
+            link = LINK_TCP;
+        } else if (link_name == "unix") {
+            link = LINK_UNIX;
+        } else if (link_name == "shm") {
+            link = LINK_SHM;
+        } else {
+            std::cout << usage << std::endl;
+            exit(1);
+        }
+        bench_result_t result = run_bench(transport, link, run, messages, entries, round_trips);
+        if (!result.connected) {
+            std::cout << "[replica_bench] " << transports[run] << ": the servers couldn't connect." << std::endl;
+            continue;
+        }
+        std::cout << "[replica_bench] " << transports[run] << " delivered: " << result.delivered << "/" << (uint64_t) messages * SERVER_COUNT * (SERVER_COUNT - 1);
+        std::cout << " appends/s: " << (uint64_t) result.appends << " all delivered in ms: " << result.total_ms;
+        std::cout << " round trip ms: " << result.round_trip_ms << std::endl;
+    }
+    return 0;
+}
@@ -2,13 +2,17 @@
 #include "raft.h"
 #include "server.h"
 #include "state.h"
+#include <algorithm>
 
-Server::Server(int server_id) {
-    // Init network
+Server::Server(int server_id, int shard_id, Network* network) : network(network, shard_id), leader_detector(get_config().heartbeat_period_ms) {
+    // The network is shared by the shards of this server
     // 1) Establish connections between server through mesh
     // 2) Establish connections between clients
     id = server_id;
-    network = new Network(this);
+    this->shard_id = shard_id;
+    stop_flag = false;
+    // servers started within the same second still get different election timeouts.
+    rng.seed(clock_seed() + id * 131 + shard_id);
 
     // Init persistent state info
     curr_term = 0;
@@ -16,8 +20,20 @@ Server::Server(int server_id) {
     voted_candidate = NULL_CANDIDATE_ID;
 
     
-    bc_log.load_file("bc_file_" + std::to_string(id) + ".txt");  // Init bc_log by loading a file
-    bal_tab.load_file("bal_tab_" + std::to_string(id) + ".txt"); // Init bal_tab by loading a file
+    bc_log.load_file(get_config().shard_file("bc_file", id, shard_id));     // Init bc_log by loading a file
+    bc_log.set_sync_delay(get_config().disk_sync_delay_ms);
+    bal_tab.load_file(get_config().shard_file("bal_tab", id, shard_id));    // Init bal_tab by loading a file
+
+    // Use the latest configuration entry in the log, or the initial voters from the cluster config.
+    voters = get_config().initial_voters;
+    refresh_membership(0);
+    transfer_request = -1;
+
+    // The balance table on disk reflects the entries up to its applied index, the ones committed after it are applied again.
+    int table_index = bal_tab.get_applied_index();
+    applied_index = (table_index == UNKNOWN_APPLIED_INDEX) ? bc_log.get_committed_index() : table_index;
+    replay_committed_entries();
+    apply_thread = clock_thread([this]() { apply_handler(); });
 
     // Start with FollowerState
     curr_state = NULL;
@@ -25,15 +41,18 @@ Server::Server(int server_id) {
 }
 
 Server::~Server() {
+    stop_flag = true;
+    if (apply_thread.joinable()) {
+        apply_thread.join();
+    }
+    // the ranges queued after the apply thread returned.
+    while (apply_next_range()) {}
     if (curr_state != NULL) {
         delete curr_state;
     }
     if (next_state != NULL) {
         delete next_state;
     }
-    if (network != NULL) {
-        delete network;
-    }
 }
 
 void Server::set_state(State* state) {
@@ -62,20 +81,206 @@ void Server::run_state() {
 }
 
 void Server::run_state_machine() {
-    while (true) {
+    while (!stop_flag) {
         run_state();
     }
 }
 
-void Server::update_bal_tab_and_committed_index(int new_index) {
+bool Server::is_leader() {
+    return dynamic_cast<LeaderState*>(curr_state) != NULL && next_state == NULL;
+}
+
+/**
+ * @brief Runs on the raft thread. Persist the new committed index and queue the newly committed
+ *        entries for the apply thread, so that the balance table file rewrites never delay heartbeats.
+ *        The table is written with the index it's applied up to, the constructor replays the rest after a crash.
+ * 
+ * @param new_index 
+ */
+void Server::advance_committed_index(int new_index) {
     if (new_index >= bc_log.get_blockchain_length()) {
-        std::cout << "[server::update_bal_tabl_and_committed_index] index invalid: " << new_index << std::endl;
+        std::cout << "[Server::advance_committed_index] index invalid: " << new_index << std::endl;
         return;   
     }
     int old_index = bc_log.get_committed_index();
+    if (new_index <= old_index) {
+        return;
+    }
+    apply_range_t* range = new apply_range_t();
+    range->first_index = old_index + 1;
+    range->last_index = new_index;
     for (int bid = old_index + 1; bid <= new_index; bid++) {
-        Transaction tmp = bc_log.get_block_by_index(bid).get_txn();
-        bal_tab.update_balance(tmp.get_sender_id(), tmp.get_recver_id(), tmp.get_amount());
+        range->txns.push_back(bc_log.get_block_by_index(bid).get_txn());
     }
     bc_log.set_committed_index(new_index);
-}
\ No newline at end of file
+
+    // the apply thread is far behind, wait for a free slot instead of dropping committed entries.
+    while (!apply_queue.push(range)) {
+        clock_sleep_ms(APPLY_CHECK_SLEEP_MS);
+    }
+}
+
+/**
+ * @brief Thread function that applies the committed ranges to the balance table in order
+ *        and publishes applied_index after each range. It drains the queue before it returns.
+ * 
+ */
+void Server::apply_handler() {
+    while (true) {
+        if (apply_next_range()) {
+            continue;
+        }
+        if (stop_flag) {
+            return;
+        }
+        flush_pending_responses();
+        clock_sleep_ms(APPLY_CHECK_SLEEP_MS);
+    }
+}
+
+// false if the queue is empty.
+bool Server::apply_next_range() {
+    apply_range_t* range = NULL;
+    if (!apply_queue.pop(range)) {
+        return false;
+    }
+    apply_range(range);
+    delete range;
+    flush_pending_responses();
+    return true;
+}
+
+/**
+ * @brief Runs before the apply thread starts: apply the entries committed after the balance table was written,
+ *        a crash can come between persisting the committed index and writing the table.
+ * 
+ */
+void Server::replay_committed_entries() {
+    int committed = std::min(bc_log.get_committed_index(), (int) bc_log.get_blockchain_length() - 1);
+    if (applied_index >= committed) {
+        return;
+    }
+    apply_range_t range;
+    range.first_index = applied_index + 1;
+    range.last_index = committed;
+    for (int bid = range.first_index; bid <= range.last_index; bid++) {
+        range.txns.push_back(bc_log.get_block_by_index(bid).get_txn());
+    }
+    std::cout << "[Server::replay_committed_entries] applying the entries " << range.first_index << " to " << range.last_index << " again." << std::endl;
+    apply_range(&range);
+}
+
+// update the table in memory for every entry but only rewrite the file once per range, with the applied index.
+void Server::apply_range(apply_range_t* range) {
+    for (auto &txn : range->txns) {
+        if (txn.get_config_txn_flag()) {
+            continue;
+        }
+        // a cross shard transfer only moves the money of the accounts this shard owns, once it's committed.
+        if (txn.is_xshard()) {
+            if (txn.get_xshard_phase() == XSHARD_COMMIT && owns_account(txn.get_sender_id())) {
+                bal_tab.set_balance(txn.get_sender_id(), bal_tab.get_balance(txn.get_sender_id()) - txn.get_amount(), false);
+            }
+            if (txn.get_xshard_phase() == XSHARD_COMMIT && owns_account(txn.get_recver_id())) {
+                bal_tab.set_balance(txn.get_recver_id(), bal_tab.get_balance(txn.get_recver_id()) + txn.get_amount(), false);
+            }
+            continue;
+        }
+        bal_tab.update_balance(txn.get_sender_id(), txn.get_recver_id(), txn.get_amount(), false);
+    }
+    bal_tab.set_applied_index(range->last_index);
+    bal_tab.write_bal_tab_to_file();
+    applied_index = range->last_index;
+}
+
+/**
+ * @brief Queue a response for a client. It is sent by the apply thread as soon as
+ *        applied_index reaches index, so the balance in it includes the entry.
+ * 
+ * @param index 
+ * @param response 
+ * @param client_id 
+ */
+void Server::reply_after_apply(int index, response_t& response, int client_id) {
+    pending_response_t pending;
+    pending.index = index;
+    pending.client_id = client_id;
+    pending.response = response;
+    pending_response_mutex.lock();
+    pending_responses.push_back(pending);
+    pending_response_mutex.unlock();
+}
+
+void Server::flush_pending_responses() {
+    int applied = applied_index.load();
+    std::vector<pending_response_t> ready;
+    pending_response_mutex.lock();
+    for (auto it = pending_responses.begin(); it != pending_responses.end();) {
+        if (it->index <= applied) {
+            ready.push_back(*it);
+            it = pending_responses.erase(it);
+        } else {
+            it++;
+        }
+    }
+    pending_response_mutex.unlock();
+
+    for (auto &pending : ready) {
+        pending.response.balance = bal_tab.get_balance(pending.client_id);
+        network.client_send_message(pending.response, pending.client_id);
+    }
+}
+
+void Server::refresh_membership(int first_changed_index) {
+    int from = first_changed_index;
+    if (config_index >= first_changed_index) {
+        // the latest config entry is gone, need to look for the one before it.
+        config_index = -1;
+        voters = get_config().initial_voters;
+        from = 0;
+    }
+    for (int bid = std::max(from, 0); bid < bc_log.get_blockchain_length(); bid++) {
+        Transaction &txn = bc_log.get_block_by_index(bid).get_txn();
+        if (txn.get_config_txn_flag()) {
+            config_index = bid;
+            voters = txn.get_voters();
+        }
+    }
+}
+
+void Server::request_membership_change(int server_id, bool add) {
+    if (server_id < 0 || server_id >= get_config().server_count) {
+        std::cout << "[Server::request_membership_change] invalid server id: " << server_id << std::endl;
+        return;
+    }
+    if (curr_leader != id) {
+        std::cout << "[Server::request_membership_change] only the leader can change the membership. shard: " << shard_id << " current leader: " << curr_leader << std::endl;
+        return;
+    }
+    membership_change_mutex.lock();
+    membership_changes.push_back(std::make_pair(server_id, add));
+    membership_change_mutex.unlock();
+}
+
+bool Server::pop_membership_change(int &server_id, bool &add) {
+    std::lock_guard<std::mutex> lock(membership_change_mutex);
+    if (membership_changes.empty()) {
+        return false;
+    }
+    server_id = membership_changes.front().first;
+    add = membership_changes.front().second;
+    membership_changes.pop_front();
+    return true;
+}
+
+void Server::request_leadership_transfer(int server_id) {
+    if (server_id < 0 || server_id >= get_config().server_count || server_id == id) {
+        std::cout << "[Server::request_leadership_transfer] invalid server id: " << server_id << std::endl;
+        return;
+    }
+    if (curr_leader != id) {
+        std::cout << "[Server::request_leadership_transfer] only the leader can transfer the leadership. shard: " << shard_id << " current leader: " << curr_leader << std::endl;
+        return;
+    }
+    transfer_request = server_id;
+}
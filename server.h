@@ -3,15 +3,39 @@
 #include "blockchain.h"
 #include "balance_table.h"
 #include "parameter.h"
+#include "lockfree_queue.h"
 #include <vector>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <random>
+#include "clock.h"
+#include "failure_detector.h"
 
 // declare State class.
 class State;
 
+// a range of newly committed entries handed from the raft thread to the apply thread.
+// the transactions are copied so the apply thread never touches the log itself.
+struct apply_range_t {
+    int first_index;
+    int last_index;
+    std::vector<Transaction> txns;
+};
+
+// a client response that can only be sent after the entry at index is applied.
+struct pending_response_t {
+    int index;
+    int client_id;
+    response_t response;
+};
+
+// the raft group of one shard on this server, the shards of a server share its network.
 class Server {
 private:
     int id;
-    Network* network;
+    int shard_id;
+    ShardNetwork network;
 
     // raft persistent state info
     uint32_t curr_leader;           // Current leader id
@@ -24,23 +48,60 @@ private:
     State* curr_state;
     State* next_state;
 
+    std::atomic<bool> stop_flag;                                        // Set by stop(), the raft and apply threads return.
+    std::mt19937 rng;                                                   // Election timeouts, seeded per server so they differ.
+
+    // apply related
+    std::atomic<int> applied_index;                                     // The last log index applied to bal_tab.
+    SpscQueue<apply_range_t*, APPLY_QUEUE_SIZE> apply_queue;            // Committed ranges waiting to be applied.
+    std::mutex pending_response_mutex;                                  // lock of the pending_responses.
+    std::deque<pending_response_t> pending_responses;                   // Responses waiting for their entry to be applied.
+    std::thread apply_thread;                                           // Thread applying committed entries to bal_tab.
+
+    // membership related
+    uint64_t voters;                                                    // Voters of the latest configuration in the log, committed or not.
+    int config_index = -1;                                              // Log index of the latest config entry, -1 if using the initial configuration.
+    std::mutex membership_change_mutex;                                 // lock of the membership_changes.
+    std::deque<std::pair<int, bool>> membership_changes;                // Admin requested changes, <server id, add or remove>.
+
+    // leadership transfer related
+    std::atomic<int> transfer_request;                                  // Admin requested target of the leadership transfer, -1 if none.
+
+    FailureDetector leader_detector;                                    // Learns the intervals between the leader's AppendEntries, used as a follower.
+
+    void apply_handler();                                               // Thread function for applying committed entries.
+    bool apply_next_range();                                            // Apply the next queued range, false if there's none.
+    void apply_range(apply_range_t* range);                             // Apply the entries and write the table with the applied index.
+    void replay_committed_entries();                                    // Apply the committed entries the table on disk is missing.
+    void flush_pending_responses();                                     // Send the responses whose entries are applied.
+
 public:
-    Server(int id);
+    const uint32_t APPLY_CHECK_SLEEP_MS = 5;                            // The sleep time until check next time if the apply queue is empty.
+
+    Server(int id, int shard_id, Network* network);
     ~Server();
 
     int get_id() {return id;};
-    Network* get_network() {return network;};
+    int get_shard_id() {return shard_id;};
+    ShardNetwork* get_network() {return &network;};
+    bool owns_account(uint32_t account) {return get_config().shard_of(account) == shard_id;}
 
     // state related
     void run_state();
     void set_state(State* state);
     void run_state_machine();
+    void stop() {stop_flag = true;}
+    bool is_stopped() {return stop_flag;}
+    bool is_leader();                                                   // Only consistent while the raft thread sleeps, ie. in the simulator.
+    uint32_t random() {return rng();}
+    FailureDetector& get_leader_detector() {return leader_detector;}
 
     // raft related
     void print_info() {
-        std::cout << "server id: " << id << std::endl;
+        std::cout << "server id: " << id << " shard: " << shard_id << std::endl;
         std::cout << "current leader: " << curr_leader << std::endl;
         std::cout << "voted candidate: " << voted_candidate << std::endl;
+        std::cout << "voters mask: " << voters << " (config entry index: " << config_index << ")" << (is_learner(id) ? " learner" : "") << std::endl;
         bal_tab.print_bal_tab();
         bc_log.print_block_chain();
     }
@@ -56,6 +117,25 @@ public:
     void set_curr_term(term_t newterm) {curr_term = newterm;}
     void clear_voted_candidate() {voted_candidate = NULL_CANDIDATE_ID;};                       
     void set_voted_candidate(int candidate_id) {voted_candidate = candidate_id;}
-    void update_bal_tab_and_committed_index(int new_index);
+    void advance_committed_index(int new_index);                        // Persist the committed index and hand the newly committed entries to the apply thread.
+    int get_applied_index() {return applied_index.load();}
+    void reply_after_apply(int index, response_t& response, int client_id);  // Send the response once the entry at index is applied.
+
+    // membership related
+    // every server uses the latest configuration in its log as soon as it is appended (single server changes).
+    bool is_voter(int server_id) {return (voters >> server_id) & 1;}
+    uint64_t get_voters() {return voters;}
+    int get_voter_count() {return __builtin_popcountll(voters);}
+    int quorum_size() {return get_voter_count() / 2 + 1;}
+    int get_config_index() {return config_index;}
+    // a learner stays one until it is added as a voter, a removed voter listed in the learners becomes one.
+    bool is_learner(int server_id) {return !is_voter(server_id) && ((get_config().initial_learners >> server_id) & 1);}
+    void refresh_membership(int first_changed_index);                   // Re-read the latest configuration after the log changed starting from first_changed_index.
+    void request_membership_change(int server_id, bool add);            // Called by the admin interface, handled by the leader state.
+    bool pop_membership_change(int &server_id, bool &add);
+
+    // leadership transfer related
+    void request_leadership_transfer(int server_id);                    // Called by the admin interface, handled by the leader state.
+    int pop_leadership_transfer() {return transfer_request.exchange(-1);}
     
 };
\ No newline at end of file
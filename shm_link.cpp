@@ -0,0 +1,301 @@
+#include <iostream>
+#include <chrono>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include "shm_link.h"
+
+static const uint32_t SHM_MAGIC = 0x52414654;                  // "RAFT"
+static const uint32_t SHM_WRAP = 0xffffffff;
+static const long SHM_SLEEP_MS = 100;                          // The inbox thread looks at its stop flag this often.
+static const long SHM_BACKLOG_CHECK_MS = 1;                    // A link with a backlog looks for room in the ring this often.
+
+static std::string inbox_name(int port) {
+    return "/raft_" + std::to_string(port);
+}
+
+// the 8 bytes aligned length of a frame of size bytes in a ring.
+static size_t frame_bytes(size_t size) {
+    return (sizeof(uint32_t) + size + 7) & ~(size_t) 7;
+}
+
+// not private futexes, they are shared between the processes.
+static long futex(std::atomic<uint32_t>* word, int op, uint32_t value, const timespec* timeout) {
+    return syscall(SYS_futex, (uint32_t*) word, op, value, timeout, NULL, 0);
+}
+
+ShmInbox::ShmInbox(int port, int rings, frame_handler_t on_frame)
+    : name(inbox_name(port)), rings(rings), on_frame(on_frame), stop_flag(false) {
+    size_t bytes = shm_inbox_t::bytes(rings);
+    // a new file, the senders of an inbox left behind see it's gone.
+    shm_unlink(name.c_str());
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0 || ftruncate(fd, bytes) < 0) {
+        std::cerr << "[ShmInbox::ShmInbox] failed to create " << name << ": " << strerror(errno) << std::endl;
+        if (fd >= 0) {
+            close(fd);
+            shm_unlink(name.c_str());
+        }
+        return;
+    }
+    void* addr = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        std::cerr << "[ShmInbox::ShmInbox] failed to map " << name << ": " << strerror(errno) << std::endl;
+        shm_unlink(name.c_str());
+        return;
+    }
+    // the new file is zeroed: every ring is empty and nobody sleeps.
+    inbox = (shm_inbox_t*) addr;
+    inbox->rings = rings;
+    inbox->owner = getpid();
+    inbox->magic.store(SHM_MAGIC, std::memory_order_release);
+    thread = std::thread(&ShmInbox::run, this);
+}
+
+ShmInbox::~ShmInbox() {
+    if (inbox == NULL) {
+        return;
+    }
+    stop_flag = true;
+    inbox->doorbell++;
+    futex(&inbox->doorbell, FUTEX_WAKE, 1, NULL);
+    thread.join();
+    munmap(inbox, shm_inbox_t::bytes(rings));
+    shm_unlink(name.c_str());
+}
+
+/**
+ * @brief the thread only sleeps once every ring is empty and the doorbell didn't ring since it looked:
+ *        a sender rings it after writing, and wakes the thread up if it said it's sleeping.
+ *
+ */
+void ShmInbox::run() {
+    timespec timeout = {0, SHM_SLEEP_MS * 1000000};
+    while (!stop_flag) {
+        uint32_t doorbell = inbox->doorbell.load();
+        size_t frames = 0;
+        for (int ring = 0; ring < rings; ring++) {
+            frames += drain(ring);
+        }
+        if (frames > 0) {
+            continue;
+        }
+        inbox->sleeping = 1;
+        futex(&inbox->doorbell, FUTEX_WAIT, doorbell, &timeout);
+        inbox->sleeping = 0;
+    }
+}
+
+size_t ShmInbox::drain(int index) {
+    shm_ring_t* ring = inbox->ring(index);
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    uint64_t tail = ring->tail.load(std::memory_order_acquire);
+    size_t frames = 0;
+    while (head < tail) {
+        size_t offset = head % SHM_RING_BYTES;
+        uint32_t size;
+        memcpy(&size, ring->data + offset, sizeof(size));
+        if (size == SHM_WRAP) {
+            head += SHM_RING_BYTES - offset;
+        } else if (offset + frame_bytes(size) > SHM_RING_BYTES || frame_bytes(size) > tail - head) {
+            std::cerr << "[ShmInbox::drain] ring " << index << " of " << name << " is broken, dropped what it holds." << std::endl;
+            head = tail;
+        } else {
+            // the frame is read in place, the sender can't overwrite it before the head moves past it.
+            on_frame(index, ring->data + offset + sizeof(size), size);
+            head += frame_bytes(size);
+            frames++;
+        }
+        ring->head.store(head, std::memory_order_release);
+    }
+    return frames;
+}
+
+std::shared_ptr<ShmLink> ShmLink::open(int port, int ring) {
+    std::string name = inbox_name(port);
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t) st.st_size < sizeof(shm_inbox_t)) {
+        ::close(fd);
+        return NULL;
+    }
+    void* addr = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        return NULL;
+    }
+    shm_inbox_t* inbox = (shm_inbox_t*) addr;
+    if (inbox->magic.load(std::memory_order_acquire) != SHM_MAGIC || ring < 0 || (uint32_t) ring >= inbox->rings
+            || (size_t) st.st_size < shm_inbox_t::bytes(inbox->rings)) {
+        munmap(addr, st.st_size);
+        return NULL;
+    }
+    return std::shared_ptr<ShmLink>(new ShmLink(name, inbox, ring, st.st_size, st.st_ino));
+}
+
+ShmLink::ShmLink(const std::string &name, shm_inbox_t* inbox, int ring, size_t mapped_bytes, ino_t inode)
+    : name(name), inbox(inbox), ring(inbox->ring(ring)), mapped_bytes(mapped_bytes), inode(inode), closed(false) {
+    thread = std::thread(&ShmLink::run, this);
+}
+
+ShmLink::~ShmLink() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop_flag = true;
+    }
+    backlog_cond.notify_one();
+    thread.join();
+    munmap(inbox, mapped_bytes);
+}
+
+/**
+ * @brief the backlog is moved to the ring as the reader makes room, it's looked at every SHM_BACKLOG_CHECK_MS
+ *        while the ring is full. The backlog of a closed link is dropped.
+ *
+ */
+void ShmLink::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stop_flag) {
+        if (closed) {
+            backlog.clear();
+            backlog_bytes = 0;
+        }
+        if (backlog.empty()) {
+            dropping = false;
+            backlog_cond.wait(lock);
+            continue;
+        }
+        while (!backlog.empty()) {
+            uint64_t tail;
+            uint8_t* target = reserve(backlog.front().size(), tail);
+            if (target == NULL) {
+                break;
+            }
+            memcpy(target, backlog.front().data(), backlog.front().size());
+            publish(tail);
+            backlog_bytes -= backlog.front().size();
+            backlog.pop_front();
+        }
+        if (!backlog.empty()) {
+            // the reader may be asleep on frames written while corked.
+            ring_bell();
+            backlog_cond.wait_for(lock, std::chrono::milliseconds(SHM_BACKLOG_CHECK_MS));
+        }
+    }
+}
+
+bool ShmLink::is_open() {
+    if (closed) {
+        return false;
+    }
+    struct stat st;
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0 || fstat(fd, &st) < 0 || st.st_ino != inode || (kill(inbox->owner, 0) < 0 && errno == ESRCH)) {
+        closed = true;
+    }
+    if (fd >= 0) {
+        ::close(fd);
+    }
+    return !closed;
+}
+
+bool ShmLink::send_frame(const uint8_t* body, size_t size) {
+    return send_serialized(size, [body, size](uint8_t* target) { memcpy(target, body, size); });
+}
+
+bool ShmLink::send_serialized(size_t size, const std::function<void(uint8_t*)> &serialize, const uint8_t* prefix, size_t prefix_size) {
+    if (closed) {
+        return false;
+    }
+    if (frame_bytes(prefix_size + size) > SHM_RING_BYTES / 2) {
+        std::cerr << "[ShmLink::send_serialized] dropped a frame of " << prefix_size + size << " bytes, too long for the ring of " << name << std::endl;
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    uint64_t tail;
+    // the frames keep their order, once there's a backlog the new ones go after it.
+    uint8_t* target = backlog.empty() ? reserve(prefix_size + size, tail) : NULL;
+    if (target != NULL) {
+        if (prefix_size > 0) {
+            memcpy(target, prefix, prefix_size);
+        }
+        serialize(target + prefix_size);
+        publish(tail);
+        return true;
+    }
+    if (backlog_bytes + prefix_size + size > SHM_BACKLOG_BYTES) {
+        if (!dropping) {
+            std::cerr << "[ShmLink::send_serialized] the backlog of " << name << " is full, dropping frames until it empties." << std::endl;
+            dropping = true;
+        }
+        return false;
+    }
+    backlog.emplace_back(prefix_size + size, '\0');
+    uint8_t* frame = (uint8_t*) &backlog.back()[0];
+    if (prefix_size > 0) {
+        memcpy(frame, prefix, prefix_size);
+    }
+    serialize(frame + prefix_size);
+    backlog_bytes += prefix_size + size;
+    backlog_cond.notify_one();
+    return true;
+}
+
+uint8_t* ShmLink::reserve(size_t size, uint64_t &tail) {
+    size_t bytes = frame_bytes(size);
+    tail = ring->tail.load(std::memory_order_relaxed);
+    size_t offset = tail % SHM_RING_BYTES;
+    size_t skipped = (offset + bytes > SHM_RING_BYTES) ? SHM_RING_BYTES - offset : 0;
+    if (tail + skipped + bytes - ring->head.load(std::memory_order_acquire) > SHM_RING_BYTES) {
+        return NULL;
+    }
+    if (skipped > 0) {
+        memcpy(ring->data + offset, &SHM_WRAP, sizeof(SHM_WRAP));
+        tail += skipped;
+        offset = 0;
+    }
+    uint32_t length = size;
+    memcpy(ring->data + offset, &length, sizeof(length));
+    tail += bytes;
+    return ring->data + offset + sizeof(length);
+}
+
+void ShmLink::publish(uint64_t tail) {
+    ring->tail.store(tail, std::memory_order_release);
+    if (corked > 0) {
+        bell_pending = true;
+        return;
+    }
+    ring_bell();
+}
+
+void ShmLink::ring_bell() {
+    inbox->doorbell++;
+    if (inbox->sleeping) {
+        futex(&inbox->doorbell, FUTEX_WAKE, 1, NULL);
+    }
+}
+
+void ShmLink::cork() {
+    std::lock_guard<std::mutex> lock(mutex);
+    corked++;
+}
+
+void ShmLink::uncork() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (--corked == 0 && bell_pending) {
+        bell_pending = false;
+        ring_bell();
+    }
+}
@@ -0,0 +1,109 @@
+/**
+ * @file shm_link.h
+ * @brief the shared memory link between the processes of one host ("replica_link = shm" in the cluster config).
+ *        A process receives in its inbox, a segment of /dev/shm named after the port it would listen on, with one
+ *        ring for every sender. The senders write their frames straight into their ring and the inbox thread hands
+ *        them over in place. The thread sleeps on a futex of the segment, the senders wake it up after writing,
+ *        or on uncork() if they are corked. A frame is a uint32_t length then the body, 8 bytes aligned,
+ *        and never wraps around the end of the ring: a SHM_WRAP length sends the reader back to the start.
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <string>
+#include <functional>
+#include <stdint.h>
+#include <sys/types.h>
+#include "parameter.h"
+#include "link.h"
+
+// one ring of an inbox, written by one sender at a time. Only the sender moves the tail, only the reader the head,
+// both count the bytes ever written so the ring is full once tail - head == SHM_RING_BYTES.
+struct shm_ring_t {
+    alignas(64) std::atomic<uint64_t> head;
+    alignas(64) std::atomic<uint64_t> tail;
+    alignas(64) uint8_t data[SHM_RING_BYTES];
+};
+
+struct shm_inbox_t {
+    std::atomic<uint32_t> magic;                                        // SHM_MAGIC once the owner set the inbox up.
+    uint32_t rings;
+    pid_t owner;
+    alignas(64) std::atomic<uint32_t> doorbell;                         // Rung by the senders, the futex of the inbox thread.
+    std::atomic<uint32_t> sleeping;                                     // The inbox thread waits for the doorbell.
+
+    shm_ring_t* ring(int index) {return (shm_ring_t*) (this + 1) + index;};
+    static size_t bytes(int rings) {return sizeof(shm_inbox_t) + rings * sizeof(shm_ring_t);};
+};
+
+// the receiving end, the frames of ring i come from the sender given i. It replaces an inbox
+// the previous owner of the port left behind, the senders of the old one see their link closed.
+class ShmInbox {
+public:
+    typedef std::function<void(int ring, const uint8_t* data, size_t size)> frame_handler_t;
+
+    ShmInbox(int port, int rings, frame_handler_t on_frame);            // The frame handler runs on the inbox thread.
+    ~ShmInbox();                                                        // Stops the thread and removes the inbox.
+
+    bool is_ready() {return inbox != NULL;};                            // false if the inbox couldn't be set up.
+
+private:
+    std::string name;
+    int rings;
+    shm_inbox_t* inbox = NULL;
+    frame_handler_t on_frame;
+    std::atomic<bool> stop_flag;
+    std::thread thread;
+
+    void run();
+    size_t drain(int ring);                                             // Hand the frames of the ring over, returns their count.
+};
+
+// the sending end, a ring of the inbox of another process. Any thread can send, cork and close, a send never
+// waits for the reader: a frame that doesn't fit in the ring goes to the backlog, the link's thread moves it
+// to the ring once the reader made room, the way a Connection queues what the socket doesn't take.
+class ShmLink : public Link {
+public:
+    static std::shared_ptr<ShmLink> open(int port, int ring);           // NULL if the inbox isn't set up yet.
+    ~ShmLink();
+
+    bool is_open() override;                                            // Looks whether the owner of the inbox exited or replaced it.
+    using Link::send_frame;
+    bool send_frame(const uint8_t* body, size_t size) override;
+    void cork() override;
+    void uncork() override;
+    void close() override {closed = true;};
+
+protected:
+    bool send_serialized(size_t size, const std::function<void(uint8_t*)> &serialize, const uint8_t* prefix = NULL, size_t prefix_size = 0) override;
+
+private:
+    std::string name;
+    shm_inbox_t* inbox;
+    shm_ring_t* ring;
+    size_t mapped_bytes;
+    ino_t inode;                                                        // of the inbox, a replaced one is another file.
+    std::atomic<bool> closed;
+    std::mutex mutex;                                                   // lock of the members below and of the tail.
+    int corked = 0;
+    bool bell_pending = false;                                          // A frame was written while corked.
+    std::deque<std::string> backlog;                                    // Frames waiting for room in the ring.
+    size_t backlog_bytes = 0;
+    bool dropping = false;                                              // The backlog is full, reported once until it empties.
+    bool stop_flag = false;
+    std::condition_variable backlog_cond;                               // Wakes the thread up for a new backlog or to stop.
+    std::thread thread;
+
+    ShmLink(const std::string &name, shm_inbox_t* inbox, int ring, size_t mapped_bytes, ino_t inode);
+    void run();                                                         // Moves the backlog to the ring.
+    uint8_t* reserve(size_t size, uint64_t &tail);                      // Room for a body of size, NULL if the ring is full. mutex held.
+    void publish(uint64_t tail);                                        // mutex held
+    void ring_bell();
+};
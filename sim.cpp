@@ -0,0 +1,67 @@
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <algorithm>
+#include "simulator.h"
+
+const char* usage = "Run the program by typing ./sim [seed] [seconds] [clients] [config_file], the seconds are virtual.";
+
+int main(int argc, char* argv[]) {
+    if (argc > 5) {
+        std::cout << usage << std::endl;
+        exit(1);
+    }
+    sim_options_t options;
+    options.seed = (argc > 1) ? atoi(argv[1]) : 1;
+    uint32_t seconds = (argc > 2) ? atoi(argv[2]) : 60;
+    options.clients = (argc > 3) ? atoi(argv[3]) : DEFAULT_CLIENT_COUNT;
+    if (!load_cluster_config((argc > 4) ? argv[4] : DEFAULT_CONFIG_FILE)) {
+        exit(1);
+    }
+
+    // the servers log every message, keep only the report.
+    std::streambuf* cout_buf = std::cout.rdbuf();
+    std::cout.rdbuf(NULL);
+    auto start = std::chrono::steady_clock::now();
+    Simulator sim(options);
+    sim.run_for(seconds * 1000);
+    std::vector<int> leaders;
+    std::vector<term_t> terms;
+    for (int shard_id = 0; shard_id < get_config().shard_count; shard_id++) {
+        leaders.push_back(sim.leader(shard_id));
+        term_t term = 0;
+        for (int id = 0; id < get_config().server_count; id++) {
+            term = std::max(term, sim.get_server(id, shard_id)->get_curr_term());
+        }
+        terms.push_back(term);
+    }
+    std::string digest = sim.digest();
+    uint64_t virtual_ms = sim.elapsed_ms();
+    sim.stop();
+    double wall_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout.clear();
+    std::cout.rdbuf(cout_buf);
+
+    uint64_t committed = 0;
+    for (int client_id = 0; client_id < sim.client_count(); client_id++) {
+        sim_client_t* client = sim.get_client(client_id);
+        committed += client->committed;
+        std::cout << "[sim] client " << client_id << " committed: " << client->committed << " failed: " << client->failed;
+        if (client->committed > 0) {
+            std::cout << " latency ms mean: " << client->total_latency_ms / client->committed << " max: " << client->max_latency_ms;
+        }
+        std::cout << std::endl;
+    }
+    for (int shard_id = 0; shard_id < leaders.size(); shard_id++) {
+        std::cout << "[sim] shard " << shard_id << " leader: " << leaders[shard_id] << " term: " << terms[shard_id] << std::endl;
+    }
+    std::cout << "[sim] seed " << options.seed << " virtual ms: " << virtual_ms << " wall ms: " << (uint64_t) wall_ms;
+    std::cout << " speedup: " << virtual_ms / wall_ms << "x committed/wall s: " << committed * 1000 / wall_ms << std::endl;
+    std::cout << "[sim] replica messages: " << sim.replica_message_count();
+    if (committed > 0) {
+        std::cout << " per commit: " << (double) sim.replica_message_count() / committed;
+    }
+    std::cout << std::endl;
+    std::cout << "[sim] digest: " << digest << std::endl;
+    return 0;
+}
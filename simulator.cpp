@@ -0,0 +1,383 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <memory>
+#include <sys/stat.h>
+#include "simulator.h"
+#include "state.h"
+
+SimClock::SimClock(uint32_t seed) {
+    clock_seed = seed;
+    now_ms = EPOCH_MS;
+}
+
+std::chrono::system_clock::time_point SimClock::now() {
+    std::lock_guard<std::mutex> lock(mutex);
+    uint64_t ms = now_ms;
+    if (stopped) {
+        ms += std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - stop_time).count();
+    }
+    return std::chrono::system_clock::time_point(std::chrono::milliseconds(ms));
+}
+
+/**
+ * @brief Park the running thread until the virtual time passed ms, and let the next one run.
+ *
+ * @param ms
+ */
+void SimClock::sleep_ms(uint32_t ms) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (stopped) {
+        lock.unlock();
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+        return;
+    }
+    waiter_t waiter;
+    agenda_item_t item;
+    item.waiter = &waiter;
+    agenda[std::make_pair(now_ms + ms, seq++)] = item;
+    dispatch(lock);
+    wait(lock, &waiter);
+}
+
+/**
+ * @brief The new thread waits for its turn, which comes once the calling thread sleeps.
+ *
+ * @param task
+ * @return std::thread
+ */
+std::thread SimClock::spawn(std::function<void()> task) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (stopped) {
+        return std::thread(task);
+    }
+    waiter_t* waiter = new waiter_t();
+    agenda_item_t item;
+    item.waiter = waiter;
+    agenda[std::make_pair(now_ms, seq++)] = item;
+    return std::thread([this, waiter, task]() {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wait(lock, waiter);
+        }
+        delete waiter;
+        task();
+        // the thread is done, hand over its turn.
+        std::unique_lock<std::mutex> lock(mutex);
+        dispatch(lock);
+    });
+}
+
+void SimClock::schedule(uint32_t delay_ms, std::function<void()> event) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (stopped) {
+        return;
+    }
+    agenda_item_t item;
+    item.waiter = NULL;
+    item.event = event;
+    agenda[std::make_pair(now_ms + delay_ms, seq++)] = item;
+}
+
+void SimClock::stop() {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopped = true;
+    stop_time = std::chrono::steady_clock::now();
+    for (auto &entry : agenda) {
+        if (entry.second.waiter != NULL) {
+            entry.second.waiter->go = true;
+            entry.second.waiter->cv.notify_one();
+        }
+    }
+    agenda.clear();
+}
+
+/**
+ * @brief Advance the virtual time to the earliest item. The events run right here with the lock
+ *        released, so they must not sleep; the first sleeper found is woken and the caller returns.
+ *
+ * @param lock
+ */
+void SimClock::dispatch(std::unique_lock<std::mutex> &lock) {
+    while (!stopped && !agenda.empty()) {
+        auto it = agenda.begin();
+        now_ms = std::max(now_ms, it->first.first);
+        agenda_item_t item = it->second;
+        agenda.erase(it);
+        if (item.waiter != NULL) {
+            item.waiter->go = true;
+            item.waiter->cv.notify_one();
+            return;
+        }
+        lock.unlock();
+        item.event();
+        lock.lock();
+    }
+}
+
+void SimClock::wait(std::unique_lock<std::mutex> &lock, waiter_t* waiter) {
+    waiter->cv.wait(lock, [waiter]() {return waiter->go;});
+}
+
+/**
+ * @brief Build the cluster of the loaded config in options.data_dir. Nothing runs before run_for.
+ *
+ * @param options
+ */
+Simulator::Simulator(const sim_options_t &options) : clock(options.seed) {
+    this->options = options;
+    rng.seed(options.seed);
+    // the nonces of the blocks come from rand().
+    srand(options.seed);
+    set_virtual_clock(&clock);
+
+    // a leader writing its log on another thread would run outside the virtual clock.
+    cluster_config_t config = get_config();
+    config.data_dir = options.data_dir;
+    config.parallel_log_write = false;
+    set_config(config);
+    create_files();
+
+    partitioned.assign(get_config().server_count, false);
+    killed.assign(get_config().server_count, false);
+    link_delivery_ms.assign(get_config().server_count, std::vector<uint64_t>(get_config().server_count, 0));
+    for (int id = 0; id < get_config().server_count; id++) {
+        networks.push_back(new Network(id, this));
+        servers.push_back(std::vector<Server*>());
+        for (int shard_id = 0; shard_id < get_config().shard_count; shard_id++) {
+            servers[id].push_back(new Server(id, shard_id, networks[id]));
+        }
+    }
+    for (auto &shards : servers) {
+        for (auto server : shards) {
+            raft_threads.push_back(clock_thread([server]() { server->run_state_machine(); }));
+        }
+    }
+    int client_count = std::min(options.clients, get_config().client_count);
+    for (int client_id = 0; client_id < client_count; client_id++) {
+        clients.push_back(new sim_client_t());
+    }
+    for (int client_id = 0; client_id < client_count; client_id++) {
+        clients[client_id]->thread = clock_thread([this, client_id]() { client_handler(client_id); });
+    }
+}
+
+Simulator::~Simulator() {
+    stop();
+    for (auto &shards : servers) {
+        for (auto server : shards) {
+            delete server;
+        }
+    }
+    for (auto network : networks) {
+        delete network;
+    }
+    for (auto client : clients) {
+        delete client;
+    }
+    set_virtual_clock(NULL);
+}
+
+void Simulator::stop() {
+    if (stop_flag) {
+        return;
+    }
+    stop_flag = true;
+    for (auto &shards : servers) {
+        for (auto server : shards) {
+            server->stop();
+        }
+    }
+    clock.stop();
+    for (auto &thread : raft_threads) {
+        thread.join();
+    }
+    for (auto client : clients) {
+        client->thread.join();
+    }
+}
+
+/**
+ * @brief Same files as the starter, every account starts with 10.
+ *
+ */
+void Simulator::create_files() {
+    mkdir(options.data_dir.c_str(), 0755);
+    for (int id = 0; id < get_config().server_count; id++) {
+        for (int shard_id = 0; shard_id < get_config().shard_count; shard_id++) {
+            std::ofstream bc_file(get_config().shard_file("bc_file", id, shard_id));
+            bc_file << "-0001\n";
+            bc_file.close();
+            std::ofstream bal_file(get_config().shard_file("bal_tab", id, shard_id));
+            for (int cid = 0; cid < get_config().client_count; cid++) {
+                bal_file << "10 ";
+            }
+            bal_file << std::endl << -1 << std::endl;
+            bal_file.close();
+        }
+    }
+}
+
+void Simulator::run_for(uint32_t ms) {
+    clock_sleep_ms(ms);
+}
+
+void Simulator::partition_toggle(int server_id) {
+    if (killed[server_id]) {
+        return;
+    }
+    partitioned[server_id] = !partitioned[server_id];
+}
+
+void Simulator::kill(int server_id) {
+    for (auto server : servers[server_id]) {
+        server->stop();
+    }
+    // nothing reaches it anymore, the requests sent to it time out.
+    partitioned[server_id] = true;
+    killed[server_id] = true;
+}
+
+int Simulator::leader(int shard_id) {
+    // a partitioned old leader may not know it was replaced yet, the newest term wins.
+    int leader_id = -1;
+    for (int id = 0; id < servers.size(); id++) {
+        Server* server = servers[id][shard_id];
+        if (!killed[id] && server->is_leader() && (leader_id == -1 || server->get_curr_term() > servers[leader_id][shard_id]->get_curr_term())) {
+            leader_id = id;
+        }
+    }
+    return leader_id;
+}
+
+std::string Simulator::digest() {
+    std::stringstream ss;
+    for (int shard_id = 0; shard_id < get_config().shard_count; shard_id++) {
+        for (int id = 0; id < servers.size(); id++) {
+            Blockchain &log = servers[id][shard_id]->get_bc_log();
+            int committed = log.get_committed_index();
+            ss << shard_id << "/" << id << ":" << committed;
+            if (committed >= 0) {
+                // the blocks are hash chained, the last committed one covers the ones before it.
+                ss << ":" << log.get_block_by_index(committed).find_hash().substr(0, 8);
+            }
+            ss << " ";
+        }
+    }
+    return ss.str();
+}
+
+void Simulator::send_replica_message(int from_id, uint64_t receivers, const replica_msg_t &msg) {
+    // one copy of the message for all the receivers, like the mesh forwards one payload.
+    std::shared_ptr<replica_msg_t> shared_msg;
+    for (int to_id = 0; to_id < networks.size(); to_id++) {
+        if (!(receivers & (1ULL << to_id))) {
+            continue;
+        }
+        replica_messages++;
+        if (partitioned[from_id] || partitioned[to_id]) {
+            continue;
+        }
+        if (options.drop_rate > 0 && std::uniform_real_distribution<double>(0, 1)(rng) < options.drop_rate) {
+            continue;
+        }
+        uint32_t delay = options.network_delay_ms;
+        if (options.jitter_ms > 0) {
+            delay += rng() % (options.jitter_ms + 1);
+        }
+        // like the mesh connections, a link delivers in order: a message never overtakes the previous one.
+        uint64_t now = clock_now_ms();
+        uint64_t &delivery_ms = link_delivery_ms[from_id][to_id];
+        delivery_ms = std::max(delivery_ms, now + delay);
+        Network* network = networks[to_id];
+        if (shared_msg == NULL) {
+            shared_msg = std::make_shared<replica_msg_t>(msg);
+        }
+        clock.schedule(delivery_ms - now, [network, shared_msg]() { network->replica_deliver(*shared_msg); });
+    }
+}
+
+void Simulator::send_client_response(int from_id, int client_id, const response_t &response) {
+    if (client_id >= clients.size() || killed[from_id]) {
+        return;
+    }
+    sim_client_t* client = clients[client_id];
+    clock.schedule(options.client_delay_ms, [client, response]() {
+        std::lock_guard<std::mutex> lock(client->inbox_mutex);
+        client->inbox.push_back(response);
+    });
+}
+
+/**
+ * @brief A closed loop client: one transfer to the next simulated client at a time, sent to the
+ *        leader it knows about. It's resent to another server if it times out, or to the new
+ *        leader once one is announced.
+ *
+ * @param client_id
+ */
+void Simulator::client_handler(int client_id) {
+    const uint32_t POLL_MS = 10;
+    sim_client_t* client = clients[client_id];
+    uint32_t recver_id = (client_id + 1) % std::max((int) clients.size(), 2);
+    uint32_t shard_id = get_config().shard_of(client_id);
+    uint64_t request_id = 0;
+    while (!stop_flag) {
+        request_msg_t request_msg;
+        request_msg.set_type(TRANSACTION_REQUEST);
+        request_msg.set_client_id(client_id);
+        request_msg.set_request_id(++request_id);
+        txn_msg_t* txn_msg = request_msg.mutable_transaction();
+        txn_msg->set_sender_id(client_id);
+        txn_msg->set_recver_id(recver_id);
+        txn_msg->set_amount(1);
+        txn_msg->set_bal_txn_flag(false);
+        uint32_t server_id = client->leader_id;
+        Network* network = networks[server_id];
+        if (!killed[server_id]) {
+            clock.schedule(options.client_delay_ms, [network, request_msg, client_id]() { network->client_deliver_request(request_msg, client_id); });
+        }
+
+        uint64_t sent_ms = clock_now_ms();
+        bool done = false;
+        bool busy = false;
+        while (!stop_flag && !done) {
+            clock_sleep_ms(POLL_MS);
+            if (clock_now_ms() - sent_ms >= CLIENT_REQ_TIMEOUT_MS) {
+                client->failed++;
+                client->leader_id = (client->leader_id + 1) % get_config().server_count;
+                break;
+            }
+            std::lock_guard<std::mutex> lock(client->inbox_mutex);
+            while (!client->inbox.empty()) {
+                response_t response = client->inbox.front();
+                client->inbox.pop_front();
+                // like the real client, a new leader announcement means resending to it.
+                if (response.type == LEADER_CHANGE && response.shard_id == shard_id) {
+                    client->leader_id = response.leader_id;
+                    done = done || (response.leader_id != server_id);
+                    // redirected to the same server, no leader is known yet.
+                    busy = busy || (response.request_id == request_id && response.leader_id == server_id);
+                }
+                if (response.request_id != request_id) {
+                    continue;
+                }
+                done = true;
+                if (response.type == TRANSACTION_RESPONSE && response.succeed) {
+                    uint64_t latency = clock_now_ms() - sent_ms;
+                    client->committed++;
+                    client->total_latency_ms += latency;
+                    client->max_latency_ms = std::max(client->max_latency_ms, latency);
+                    client->last_sent_ms = sent_ms;
+                    client->last_commit_ms = clock_now_ms();
+                } else if (response.type != LEADER_CHANGE) {
+                    client->failed++;
+                    busy = (response.type == SERVER_BUSY);
+                }
+            }
+        }
+        if (busy) {
+            clock_sleep_ms(CLIENT_BUSY_BACKOFF_MS);
+        }
+    }
+}
@@ -0,0 +1,124 @@
+/**
+ * @file simulator.h
+ * @brief runs a whole cluster in one process on a virtual clock, for fast and repeatable runs.
+ *        Every server, shard and client thread runs one at a time: a thread runs until it sleeps,
+ *        then the thread or message delivery due the earliest in virtual time runs next.
+ *        Together with the seeded random numbers, a run only depends on its seed and options.
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include <map>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <random>
+#include "clock.h"
+#include "network.h"
+#include "server.h"
+
+// the virtual clock that hands the single running slot from thread to thread.
+class SimClock : public VirtualClock {
+private:
+    struct waiter_t {
+        std::condition_variable cv;
+        bool go = false;
+    };
+    // a sleeping thread if waiter is set, a scheduled event otherwise.
+    struct agenda_item_t {
+        waiter_t* waiter;
+        std::function<void()> event;
+    };
+
+    std::mutex mutex;
+    uint64_t now_ms;
+    uint64_t seq = 0;                                                   // Orders the items due at the same time.
+    uint32_t clock_seed;
+    bool stopped = false;
+    std::chrono::steady_clock::time_point stop_time;
+    std::map<std::pair<uint64_t, uint64_t>, agenda_item_t> agenda;
+
+    void dispatch(std::unique_lock<std::mutex> &lock);                  // Run the due events and wake the next sleeper.
+    void wait(std::unique_lock<std::mutex> &lock, waiter_t* waiter);
+
+public:
+    // starts in the future of the real clock so the timestamps look like the real ones.
+    const uint64_t EPOCH_MS = 1000000000000ULL;
+
+    SimClock(uint32_t seed);
+
+    std::chrono::system_clock::time_point now();
+    void sleep_ms(uint32_t ms);
+    std::thread spawn(std::function<void()> task);
+    uint32_t seed() {return clock_seed;}
+
+    void schedule(uint32_t delay_ms, std::function<void()> event);      // Run the event on the running thread once the delay passed.
+    uint64_t elapsed_ms() {return now_ms - EPOCH_MS;}
+    // Let every thread run freely on the real clock, so they can notice they are stopped and be joined.
+    void stop();
+};
+
+struct sim_options_t {
+    uint32_t seed = 1;
+    uint32_t network_delay_ms = MESH_NETWORK_DELAY_MS;                  // One way delay of a replica message.
+    uint32_t jitter_ms = 0;                                             // Extra random delay, up to this much.
+    double drop_rate = 0;                                               // Share of the replica messages that are lost.
+    uint32_t client_delay_ms = 10;                                      // One way delay between a client and a server.
+    int clients = 0;                                                    // Closed loop clients sending transfers, at most client_count.
+    std::string data_dir = "sim_data";
+};
+
+struct sim_client_t {
+    std::thread thread;
+    std::mutex inbox_mutex;
+    std::deque<response_t> inbox;
+    uint32_t leader_id = 0;
+    uint64_t committed = 0;
+    uint64_t failed = 0;
+    uint64_t total_latency_ms = 0;
+    uint64_t max_latency_ms = 0;
+    uint64_t last_sent_ms = 0;                                          // When the last committed request was sent,
+    uint64_t last_commit_ms = 0;                                        // and when its response came back.
+};
+
+// the cluster of the loaded config, connected by an in-memory network on a SimClock.
+class Simulator : public Transport {
+private:
+    sim_options_t options;
+    SimClock clock;
+    std::mt19937 rng;
+    std::vector<Network*> networks;
+    std::vector<std::vector<Server*>> servers;                          // [server id][shard id]
+    std::vector<std::thread> raft_threads;
+    std::vector<sim_client_t*> clients;
+    std::vector<bool> partitioned;
+    std::vector<bool> killed;
+    std::vector<std::vector<uint64_t>> link_delivery_ms;                // [from id][to id], the last delivery time on the link.
+    bool stop_flag = false;
+    uint64_t replica_messages = 0;                                      // Sent by the servers, dropped ones included.
+
+    void create_files();
+    void client_handler(int client_id);
+
+public:
+    Simulator(const sim_options_t &options);
+    ~Simulator();
+
+    void run_for(uint32_t ms);
+    void partition_toggle(int server_id);                               // Like the mesh, only the replica messages are cut.
+    void kill(int server_id);                                           // Crash every shard of the server, it never comes back.
+    int leader(int shard_id);                                           // -1 if no server is leading the shard.
+    Server* get_server(int server_id, int shard_id) {return servers[server_id][shard_id];}
+    sim_client_t* get_client(int client_id) {return clients[client_id];}
+    int client_count() {return clients.size();}
+    uint64_t elapsed_ms() {return clock.elapsed_ms();}
+    uint64_t now_ms() {return clock_now_ms();}
+    uint64_t replica_message_count() {return replica_messages;}
+    std::string digest();                                               // The committed logs of every shard, same seed same digest.
+    void stop();                                                        // Stop the servers and clients, called by the destructor.
+
+    void send_replica_message(int from_id, uint64_t receivers, const replica_msg_t &msg);
+    void send_client_response(int from_id, int client_id, const response_t &response);
+};
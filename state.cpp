@@ -1,13 +1,158 @@
 #include <chrono>
 #include <ctime>
+#include <future>
+#include <algorithm>
 #include "state.h"
 #include "raft.h"
 #include "server.h"
 
+bool State::is_log_up_to_date(request_vote_rpc_t* rpc) {
+    Blockchain& log = get_context()->get_bc_log();
+    return log.get_last_term() < rpc->last_log_term
+        || (log.get_last_term() == rpc->last_log_term && log.get_last_index() <= rpc->last_log_index);
+}
+
+/**
+ * @brief Answer a pre-vote without changing my term or my vote.
+ *        The pre-vote is granted only if I'd vote for the candidate in a real election
+ *        and I haven't heard from a live leader recently.
+ * 
+ * @param rpc 
+ * @param leader_alive 
+ */
+void State::handle_prevote_rpc(request_vote_rpc_t* rpc, bool leader_alive) {
+    request_vote_reply_t reply;
+    reply.term = rpc->term;
+    reply.sender_id = get_context()->get_id();
+    reply.vote_granted = !leader_alive && rpc->term > get_context()->get_curr_term() && is_log_up_to_date(rpc);
+    std::cout << "[State::handle_prevote_rpc] pre-vote for " << rpc->candidate_id << " with term: " << rpc->term << " granted: " << reply.vote_granted << std::endl;
+
+    replica_msg_wrapper_t reply_msg;
+    reply_msg.type = REQ_PREVOTE_RPL;
+    reply_msg.vote_reply = reply;
+    get_context()->get_network()->replica_send_message(reply_msg, rpc->candidate_id);
+}
+
+/**
+ * @brief Answer a stale read from the local balance table once the committed entries are applied.
+ *        Refused if the leader has been silent longer than max_read_staleness_ms, the data could be arbitrarily old.
+ * 
+ * @param request 
+ * @param last_leader_time the last time an AppendEntries from the current leader was received.
+ */
+void State::serve_stale_read(request_t* request, std::chrono::system_clock::time_point last_leader_time) {
+    auto staleness = std::chrono::duration_cast<std::chrono::milliseconds>(clock_now() - last_leader_time);
+    response_t response;
+    response.type = BALANCE_RESPONSE;
+    response.request_id = request->request_id;
+    response.leader_id = get_context()->get_curr_leader();
+    response.balance = -1;
+    if (staleness.count() > get_config().max_read_staleness_ms) {
+        std::cout << "[State::serve_stale_read] no leader heard for " << staleness.count() << " ms, refuse the read." << std::endl;
+        response.succeed = false;
+        get_context()->get_network()->client_send_message(response, request->client_id);
+        return;
+    }
+    response.succeed = true;
+    get_context()->reply_after_apply(get_context()->get_bc_log().get_committed_index(), response, request->client_id);
+}
+
+State* State::new_election_state() {
+    if (get_config().prevote) {
+        return new PreCandidateState(get_context());
+    }
+    return new CandidateState(get_context());
+}
+
+// PreCandidate State
+// Ask for pre-votes with the next term before incrementing it. A server that can't reach a majority,
+// or whose cluster still has a live leader, keeps its term and can't disrupt the leader when it rejoins.
+void PreCandidateState::run() {
+    std::cout<<"[State::PreCandidateState::run] Running a PreCandidate State!"<<std::endl;
+    ShardNetwork* network = get_context()->get_network();
+
+    gen_election_timeout();
+    term_t next_term = get_context()->get_curr_term() + 1;
+    prevote_count = 1;
+    if (prevote_count >= get_context()->quorum_size()) {
+        get_context()->set_state(new CandidateState(get_context()));
+        return;
+    }
+
+    auto election_timestamp = clock_now();
+
+    request_vote_rpc_t rpc;
+    rpc.last_log_index = get_context()->get_bc_log().get_last_index();
+    rpc.last_log_term = get_context()->get_bc_log().get_last_term();
+    rpc.candidate_id = get_context()->get_id();
+    rpc.term = next_term;
+    rpc.leadership_transfer = false;
+
+    replica_msg_wrapper_t send_msg;
+    send_msg.type = REQ_PREVOTE_RPC;
+    send_msg.vote_rpc = rpc;
+    network->replica_send_message(send_msg);
+
+    replica_msg_wrapper_t msg;
+
+    while (!get_context()->is_stopped()) {
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(clock_now() - election_timestamp);
+        if (ms.count() > curr_election_timeout) {
+            std::cout<<"[State::PreCandidateState::run] PreCandidate Timeout, keep the term: " << get_context()->get_curr_term() <<std::endl;
+            get_context()->set_state(new PreCandidateState(get_context()));
+            return;
+        }
+
+        if (network->replica_get_message_count() == 0) {
+            network->wait_message(MSG_CHECK_SLEEP_MS);
+            continue;
+        }
+
+        network->replica_pop_message(msg);
+
+        if (msg.type == REQ_PREVOTE_RPC) {
+            // Another server timed out as well, it gets my pre-vote if its log is good enough.
+            handle_prevote_rpc(&msg.vote_rpc, false);
+        } else if (msg.type == REQ_PREVOTE_RPL) {
+            auto prevote_reply = &msg.vote_reply;
+            std::cout << "[State::PreCandidateState::run] received pre-vote: " << prevote_reply->vote_granted << " from: " << prevote_reply->sender_id << std::endl;
+            if (prevote_reply->term == next_term && next_term == get_context()->get_curr_term() + 1
+                && prevote_reply->vote_granted && get_context()->is_voter(prevote_reply->sender_id)) {
+                if (++prevote_count >= get_context()->quorum_size()) {
+                    std::cout<<"[State::PreCandidateState::run] Recv majority pre-vote, Step up to Candidate State!"<<std::endl;
+                    get_context()->set_state(new CandidateState(get_context()));
+                    goto exit;
+                }
+            }
+        } else if (msg.type == REQ_VOTE_RPC) {
+            auto vote_rpc = &msg.vote_rpc;
+            if (vote_rpc->term > get_context()->get_curr_term()) {
+                std::cout<<"[State::PreCandidateState::run] Step down to Follower State!"<<std::endl;
+                get_context()->set_state(new FollowerState(get_context()));
+                // the follower answers it, the candidate would wait for its whole election timeout otherwise.
+                network->replica_return_message(msg);
+                goto exit;
+            }
+        } else if (msg.type == APP_ENTR_RPC) {
+            auto append_rpc = &msg.append_rpc;
+            if (append_rpc->term >= get_context()->get_curr_term()) {
+                std::cout<<"[State::PreCandidateState::run] Leader is alive, Step down to Follower State!"<<std::endl;
+                get_context()->set_state(new FollowerState(get_context()));
+                network->replica_return_message(msg);
+                goto exit;
+            }
+        }
+    }
+    return;
+
+exit:
+    return;
+}
+
 // Candidate State
 void CandidateState::run() {
     std::cout<<"[State::CandidateState::run] Running a Candidate State!"<<std::endl;
-    Network* network = get_context()->get_network();
+    ShardNetwork* network = get_context()->get_network();
         
     gen_election_timeout();
 
@@ -18,7 +163,7 @@ void CandidateState::run() {
     vote_count = 1;
 
     // Reset the election timeout timer
-    auto election_timestamp = std::chrono::system_clock::now();
+    auto election_timestamp = clock_now();
 
     // Make the request vote rpc
     request_vote_rpc_t rpc;
@@ -26,25 +171,27 @@ void CandidateState::run() {
     rpc.last_log_term = get_context()->get_bc_log().get_last_term();
     rpc.candidate_id = get_context()->get_id();
     rpc.term = term;
+    rpc.leadership_transfer = leadership_transfer;
     
     replica_msg_wrapper_t send_msg;
     send_msg.type = REQ_VOTE_RPC;
-    send_msg.payload = (void*) &rpc;
+    send_msg.vote_rpc = rpc;
     // Send the message to other servers
     //std::cout<<"[State::CandidateState::run] Sending out requestVotePRCs!"<<std::endl;
     network->replica_send_message(send_msg);
      
     replica_msg_wrapper_t msg;
 
-    while(true) {
+    while (!get_context()->is_stopped()) {
         // Get the time difference first for checking the timeout.
-        auto curr_timestamp = std::chrono::system_clock::now();
+        auto curr_timestamp = clock_now();
         auto dt = curr_timestamp - election_timestamp;
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(dt);
 
         // if the election is not finished within the timeout, need to end the current election.
         if (ms.count() > curr_election_timeout) {
             std::cout<<"[State::CandidateState::run] Candidate Timeout!"<<std::endl;
+            // a new election started by the timeout doesn't come from the leader anymore.
             get_context()->set_state(new CandidateState(get_context()));
             return;
         }
@@ -53,9 +200,9 @@ void CandidateState::run() {
         // Redirect the client by sending leader id
         // REVIEW: a candidate can't know who is leader, no need to reply
         
-        // if the message buffer is empty then do nothing, waiting for another round to check.
+        // if the message buffer is empty then wait for one, or for another round to check.
         if (network->replica_get_message_count() == 0) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(MSG_CHECK_SLEEP_MS));
+            network->wait_message(MSG_CHECK_SLEEP_MS);
             continue;
         }
 
@@ -64,17 +211,20 @@ void CandidateState::run() {
 
         if (msg.type == REQ_VOTE_RPC) {
             //std::cout<<"[State::CandidateState::run] Received a requestVoteRPC!"<<std::endl;
-            auto vote_rpc = (request_vote_rpc_t*)msg.payload;
+            auto vote_rpc = &msg.vote_rpc;
             // If the term is lower or equal to the current term, then ignore.
             // If the term is higher than mine, then I should step down
             if (vote_rpc->term > get_context()->get_curr_term()) {
                  std::cout<<"[State::CandidateState::run] Step down to Follower State!"<<std::endl;
                 get_context()->set_state(new FollowerState(get_context()));
+                network->replica_return_message(msg);
                 goto exit;
             }
+        } else if (msg.type == REQ_PREVOTE_RPC) {
+            handle_prevote_rpc(&msg.vote_rpc, false);
         } else if (msg.type == REQ_VOTE_RPL) {
              //std::cout<<"[State::CandidateState::run] Recv a requestVoteRPC Reply!"<<std::endl;
-            auto vote_reply = (request_vote_reply_t*)msg.payload;
+            auto vote_reply = &msg.vote_reply;
             // If the reply term is higher then the current term, it means I am slow so I need to step down.
             // REVIEW: Step down to be what, follower?
             std::cout << "[State::CandidateState::run] received vote: " << vote_reply->vote_granted << " term: " << vote_reply->term << std::endl;
@@ -83,9 +233,9 @@ void CandidateState::run() {
                 get_context()->set_state(new FollowerState(get_context()));
                 goto exit;
             }
-            else if (vote_reply->term == get_context()->get_curr_term() && vote_reply->vote_granted) {
-                // If got the majority of votes, then proceed.
-                if (++vote_count >= SERVER_COUNT / 2 + 1) {
+            else if (vote_reply->term == get_context()->get_curr_term() && vote_reply->vote_granted && get_context()->is_voter(vote_reply->sender_id)) {
+                // If got the majority of votes, then proceed. Only votes of the current voters count.
+                if (++vote_count >= get_context()->quorum_size()) {
                     std::cout<<"[State::CandidateState::run] Recv majority vote, Step up to Leader State!"<<std::endl;
                     get_context()->set_state(new LeaderState(get_context()));
                     goto exit;
@@ -93,46 +243,95 @@ void CandidateState::run() {
             }
         } else if (msg.type == APP_ENTR_RPC) {
             //std::cout<<"[State::CandidateState::run] Received a appendEntryRPC!"<<std::endl;
-            auto append_rpc = (append_entry_rpc_t*)msg.payload;
+            auto append_rpc = &msg.append_rpc;
             // REVIEW: The new elected leader should have the same or larger term. Ignore if smaller
             // The new leader should send a empty heartbeat, so shouldn't need to append.
             if (append_rpc->term >= get_context()->get_curr_term()) {
                  std::cout<<"[State::CandidateState::run] Step down to Follower State!"<<std::endl;
                 get_context()->set_state(new FollowerState(get_context()));
+                network->replica_return_message(msg);
                 goto exit;
             }
         }
-
-        // Free payload after done using message
-        if (msg.payload != NULL) {
-            free(msg.payload);
-        }
     }
+    return;
 
 exit:
-    if (msg.payload != NULL) {
-        free(msg.payload);
-    }
     return; 
 }
 
+/**
+ * @brief Commit up to the leader's commit index, but only the entries known to match the leader's log.
+ * 
+ * @param leader_commit_index 
+ * @param match_index the last index known to match the leader's log
+ */
+void FollowerState::follow_commit_index(int leader_commit_index, int match_index) {
+    int commit_index = std::min(leader_commit_index, match_index);
+    if (commit_index > get_context()->get_bc_log().get_committed_index()) {
+        get_context()->advance_committed_index(commit_index);
+    }
+}
+
+bool FollowerState::leader_alive(std::chrono::system_clock::time_point last_leader_time) {
+    auto now = clock_now();
+    FailureDetector &detector = get_context()->get_leader_detector();
+    if (get_config().phi_threshold > 0 && detector.ready()) {
+        return detector.phi(now) < get_config().phi_threshold / 2;
+    }
+    auto leader_silence = std::chrono::duration_cast<std::chrono::milliseconds>(now - last_leader_time);
+    return leader_silence.count() < get_config().election_timeout_ms / 2;
+}
+
 // Follower State
 void FollowerState::run() {
     std::cout<<"[State::FollowerState::run] Running a Follower State!"<<std::endl;
-    Network* network = get_context()->get_network();
+    ShardNetwork* network = get_context()->get_network();
     gen_election_timeout();
-    auto last_time = std::chrono::system_clock::now();
+    auto last_time = clock_now();
     auto curr_time = last_time;
+    // no leader heard in this state yet.
+    auto last_leader_time = last_time - std::chrono::milliseconds(get_config().election_timeout_ms);
+    FailureDetector &detector = get_context()->get_leader_detector();
+    detector.restart();
+    bool suspected = false;
+    auto suspect_time = last_time;
+    uint32_t suspect_backoff_ms = 0;
+    // reused for every message, the entries keep their storage.
+    replica_msg_wrapper_t msg;
 
-    while (true) {
+    while (!get_context()->is_stopped()) {
         
-        auto curr_time = std::chrono::system_clock::now();
+        auto curr_time = clock_now();
         auto dt = curr_time - last_time;
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(dt);
 
+        double phi = detector.phi(curr_time);
+        if (!suspected && get_config().phi_threshold > 0 && phi > get_config().phi_threshold && get_context()->is_voter(get_context()->get_id())) {
+            // phi replaces the fixed half of the election timeout, the random half is kept so the followers
+            // that suspect the leader at about the same time don't split the votes.
+            suspected = true;
+            suspect_time = curr_time;
+            suspect_backoff_ms = get_context()->random() % (get_config().election_timeout_ms / 2);
+            std::cout << "[State::FollowerState::run] suspect the leader, phi: " << phi << " silence ms: " << ms.count();
+            std::cout << " mean interval ms: " << (int) detector.mean_ms() << " backoff ms: " << suspect_backoff_ms << std::endl;
+        }
+        if (suspected && std::chrono::duration_cast<std::chrono::milliseconds>(curr_time - suspect_time).count() >= suspect_backoff_ms) {
+            std::cout<<"[State::FollowerState::run] Leader suspected, Start an election!"<<std::endl;
+            get_context()->set_state(new_election_state());
+            return;
+        }
+
+        if (ms.count() > curr_election_timeout && !get_context()->is_voter(get_context()->get_id())) {
+            // A non-voter (catching up, or removed) never starts an election.
+            std::cout<<"[State::FollowerState::run] Follower State Timeout, not a voter, keep following!"<<std::endl;
+            last_time = curr_time;
+            continue;
+        }
+
         if (ms.count() > curr_election_timeout) {
-            std::cout<<"[State::FollowerState::run] Follower State Timeout, Step up to Candidate State!"<<std::endl;
-            get_context()->set_state(new CandidateState(get_context()));
+            std::cout<<"[State::FollowerState::run] Follower State Timeout, Start an election!"<<std::endl;
+            get_context()->set_state(new_election_state());
             return;
         }
 
@@ -140,6 +339,20 @@ void FollowerState::run() {
         if (network->client_get_request_count() != 0) {
             //std::cout<<"[State::FollowerState::run] Recv wrong Request from Client, Redirecting!"<<std::endl;
             request_t* request = network->client_pop_request();
+            if (request == NULL) {
+                continue;
+            }
+            if (request->type == CONFIG_CHANGE_REQUEST || request->type == XSHARD_REQUEST) {
+                // queued by this server when it was the leader, no one to redirect.
+                delete (Transaction*) request->payload;
+                delete request;
+                continue;
+            }
+            if (request->type == STALE_BALANCE_REQUEST) {
+                serve_stale_read(request, last_leader_time);
+                delete request;
+                continue;
+            }
             response_t response;
             response.type = LEADER_CHANGE;
             response.leader_id = get_context()->get_curr_leader();
@@ -148,27 +361,28 @@ void FollowerState::run() {
             response.balance = -1;
             network->client_send_message(response, request->client_id);
             if (request->payload != NULL) {
-                free(request->payload);
+                delete (Transaction*) request->payload;
             }
-            free(request);
+            delete request;
         }
 
+        // the requests are redirected, one queued since they were checked ends the wait too.
         if (network->replica_get_message_count() == 0) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(MSG_CHECK_SLEEP_MS));
+            network->wait_message(MSG_CHECK_SLEEP_MS, true);
             continue;
         }
 
         // Receiving valid RPC
-        replica_msg_wrapper_t msg;
         network->replica_pop_message(msg);
 
         // Handle received RPC
         if (msg.type == APP_ENTR_RPC) {
-            auto append_rpc = (append_entry_rpc_t*) msg.payload;
+            auto append_rpc = &msg.append_rpc;
             append_entry_reply_t reply;
             reply.sender_id = get_context()->get_id();
             reply.success = false;
             reply.reply_hearbeat = true;
+            reply.match_index = -1;
 
             //std::cout<<"[State::FollowerState::run] received a <append entry rpc>!"<< (append_rpc->entries.size() ? "" : "heartbeat") <<std::endl;
             
@@ -186,19 +400,25 @@ void FollowerState::run() {
                     get_context()->clear_voted_candidate();
                 }
                 // Reset timeout
-                last_time = std::chrono::system_clock::now();
+                last_time = clock_now();
+                last_leader_time = last_time;
+                if (append_rpc->leader_id != get_context()->get_curr_leader()) {
+                    detector.restart();
+                }
+                detector.heartbeat(last_time);
+                suspected = false;
                 
                 // [case][#1] If the append RPC is just a ❤️ heartbeat ❤️.
-                if (append_rpc->entries.size() == 0) {
+                if (append_rpc->encoded.size() == 0) {
                     // Comfirm leader
                     if (append_rpc->leader_id != get_context()->get_curr_leader()) {
                         get_context()->set_curr_leader(append_rpc->leader_id);
                     }
                     // Advance balance table with newly committed entries (Also update committed index of the blockchain)
-                    if (append_rpc->prev_log_index == get_context()->get_bc_log().get_last_index() && append_rpc->prev_log_term == get_context()->get_bc_log().get_last_term()) {
-                        if (append_rpc->commit_index > get_context()->get_bc_log().get_committed_index()) {
-                            get_context()->update_bal_tab_and_committed_index(append_rpc->commit_index);
-                        }
+                    // My log matches the leader's up to prev, whatever I hold after it may still be replaced.
+                    Blockchain &log = get_context()->get_bc_log();
+                    if (append_rpc->prev_log_index == -1 || (append_rpc->prev_log_index <= log.get_last_index() && log.get_block_by_index(append_rpc->prev_log_index).get_term() == append_rpc->prev_log_term)) {
+                        follow_commit_index(append_rpc->commit_index, append_rpc->prev_log_index);
                     }
                     reply.term = get_context()->get_curr_term();
                     reply.success = true;
@@ -217,36 +437,70 @@ void FollowerState::run() {
                 else {
                      // std::cout<<"[State::FollowerState::run] This appendEntryRPC contains Logs!"<<std::endl;
                     // Return failure if log doesn't contain an entry at prevLogIndex whose term matches prevLogTerm
+                    // A failed reply's match_index hints where the leader should retry from.
                     reply.reply_hearbeat = false;
-                    if (get_context()->get_bc_log().get_last_index() < append_rpc->prev_log_index) {
+                    Blockchain &log = get_context()->get_bc_log();
+                    if (log.get_last_index() < append_rpc->prev_log_index) {
                         std::cout<<"[State::FollowerState::run] append entry failed due to log inconsistency! index out of range." << std::endl;
                         reply.term = get_context()->get_curr_term();
                         reply.success = false;
-                    } else if ((append_rpc->prev_log_index != -1) && (get_context()->get_bc_log().get_block_by_index(append_rpc->prev_log_index).get_term() != append_rpc->prev_log_term)) {
+                        reply.match_index = log.get_last_index();
+                    } else if ((append_rpc->prev_log_index != -1) && (log.get_block_by_index(append_rpc->prev_log_index).get_term() != append_rpc->prev_log_term)) {
                         std::cout<<"[State::FollowerState::run] append entry failed due to log inconsistency!"<<std::endl;
                         reply.term = get_context()->get_curr_term();
                         reply.success = false;
+                        // skip the whole conflicting term rather than one entry per round trip.
+                        int conflict_index = append_rpc->prev_log_index;
+                        term_t conflict_term = log.get_block_by_index(conflict_index).get_term();
+                        while (conflict_index > 0 && log.get_block_by_index(conflict_index - 1).get_term() == conflict_term) {
+                            conflict_index--;
+                        }
+                        reply.match_index = conflict_index - 1;
                     } else {  
-                        std::cout<<"[State::FollowerState::run] AppendEntry succeed, Fixing Log! received entry length: " << append_rpc->entries.size() << " prev index:" << append_rpc->prev_log_index <<std::endl;
-                        get_context()->get_bc_log().clean_up_blocks(append_rpc->prev_log_index + 1, append_rpc->entries);
+                        std::cout<<"[State::FollowerState::run] AppendEntry succeed, Fixing Log! received entry length: " << append_rpc->encoded.size() << " prev index:" << append_rpc->prev_log_index <<std::endl;
+                        // Only the entries from the first conflict on are replaced, a late or duplicate append
+                        // must not cut off the entries that came after it. The entries already logged aren't decoded.
+                        const encoded_entries_t &encoded = append_rpc->encoded;
+                        int first_new = 0;
+                        while (first_new < encoded.size() && append_rpc->prev_log_index + 1 + first_new <= log.get_last_index()
+                                && log.get_block_by_index(append_rpc->prev_log_index + 1 + first_new).get_term() == encoded.terms[first_new]) {
+                            first_new++;
+                        }
+                        int matched = encoded.size();
+                        if (first_new < encoded.size()) {
+                            int index = append_rpc->prev_log_index + 1 + first_new;
+                            matched = first_new + log.append_encoded(index, encoded, first_new);
+                            get_context()->refresh_membership(index);
+                        }
                         reply.term = get_context()->get_curr_term();
-                        reply.success = true;
+                        reply.success = matched == encoded.size();
+                        reply.match_index = append_rpc->prev_log_index + matched;
+                        // the commit index comes along with the entries, no need to wait for the next heartbeat.
+                        follow_commit_index(append_rpc->commit_index, reply.match_index);
                     }
                 }
             }
+            reply.commit_index = get_context()->get_bc_log().get_committed_index();
             // Reply is ready; Prepare a message
             replica_msg_wrapper_t reply_msg;
             reply_msg.type = replica_msg_type_t::APP_ENTR_RPL;
-            reply_msg.payload = (void*) &reply;
+            reply_msg.append_reply = reply;
             network->replica_send_message(reply_msg, append_rpc->leader_id);          
         } 
         else if (msg.type == REQ_VOTE_RPC) {
             //std::cout<<"[State::FollowerState::run] Received a requestVoteRPC!"<<std::endl;
-            auto vote_rpc = (request_vote_rpc_t*) msg.payload;
+            auto vote_rpc = &msg.vote_rpc;
             request_vote_reply_t reply;
             reply.vote_granted = false;
+            reply.sender_id = get_context()->get_id();
             
             std::cout<<"[State::FollowerState::run] received vote rpc for" << vote_rpc->candidate_id << " with term: " << vote_rpc->term << std::endl;
+            // Ignore the request if the current leader is alive, so a removed server can't disrupt the cluster.
+            // Unless the leader asked the candidate to take over.
+            if (leader_alive(last_leader_time) && !vote_rpc->leadership_transfer) {
+                std::cout<<"[State::FollowerState::run] heard from the leader recently, ignore the vote rpc!"<<std::endl;
+                continue;
+            }
             // Discover larger term
             if (vote_rpc->term > get_context()->get_curr_term()) {
                 get_context()->set_curr_term(vote_rpc->term);
@@ -256,66 +510,298 @@ void FollowerState::run() {
 
             if (vote_rpc->term == get_context()->get_curr_term()) {
                 if (get_context()->get_voted_candidate() == NULL_CANDIDATE_ID || get_context()->get_voted_candidate() == vote_rpc->candidate_id) {
-                    if (get_context()->get_bc_log().get_last_term() < vote_rpc->last_log_term
-                        || (get_context()->get_bc_log().get_last_term() == vote_rpc->last_log_term 
-                            && get_context()->get_bc_log().get_last_index() <= vote_rpc->last_log_index)) {
+                    if (is_log_up_to_date(vote_rpc)) {
                             // Grant vote and reset election timeout
                               std::cout<<"[State::FollowerState::run] Grant vote!"<<std::endl;
                             reply.vote_granted = true;
                             get_context()->set_voted_candidate(vote_rpc->candidate_id);
-                            last_time = std::chrono::system_clock::now();
+                            last_time = clock_now();
+                            // the old leader is being replaced, give the candidate its time.
+                            detector.restart();
+                            suspected = false;
                         }
                 }
             }
             // Reply is ready; Prepare a message
             replica_msg_wrapper_t reply_msg;
             reply_msg.type = replica_msg_type_t::REQ_VOTE_RPL;
-            reply_msg.payload = (void*) &reply;
+            reply_msg.vote_reply = reply;
             network->replica_send_message(reply_msg, vote_rpc->candidate_id);           
         }
+        else if (msg.type == REQ_PREVOTE_RPC) {
+            handle_prevote_rpc(&msg.vote_rpc, leader_alive(last_leader_time));
+        }
+        else if (msg.type == TIMEOUT_NOW_RPC) {
+            // The leader made sure my log is up to date, start the election without waiting for the timeout or the pre-vote.
+            auto timeout_now = &msg.timeout_now;
+            if (timeout_now->term == get_context()->get_curr_term() && get_context()->is_voter(get_context()->get_id())) {
+                std::cout<<"[State::FollowerState::run] received timeout now from leader " << timeout_now->leader_id << ", Step up to Candidate State!"<<std::endl;
+                get_context()->set_state(new CandidateState(get_context(), true));
+                goto exit;
+            }
+        }
         else {
             // REVIEW: A follower simply ignore all other messages
         }
-        // Free payload after done using a msg
-        if (msg.payload != NULL) {
-            free(msg.payload);
-        }  
     }
 exit:
     return;
 }
 
 // Leader State 
+void LeaderState::send_append_rpc(replica_msg_wrapper_t &msg, uint64_t receivers) {
+    if (receivers == 0) {
+        return;
+    }
+    get_context()->get_network()->replica_multicast(msg, receivers);
+    for (int i = 0; i < get_config().server_count; i++) {
+        if (receivers & (1ULL << i)) {
+            mark_append_sent(i, msg.append_rpc.commit_index);
+        }
+    }
+}
+
+void LeaderState::mark_append_sent(int id, int commit_index) {
+    last_append_time[id] = clock_now();
+    commitIndex[id] = std::max(commitIndex[id], commit_index);
+}
+
+/**
+ * @brief A server is due a heartbeat once it got no AppendEntries for a heartbeat period: the entries sent
+ *        meanwhile already told it the leader is alive, and carried the commit index. Also once the commit
+ *        index advanced COMMIT_PIGGYBACK_WAIT_MS ago and no AppendEntries brought it along yet.
+ * 
+ */
 void LeaderState::send_heartbeat() {
-    append_entry_rpc_t heartbeat;
+    // Need to wrap the heartbeat with replica_msg_wrapper_t because it's the msg used by the network.
+    replica_msg_wrapper_t msg;
+    msg.type = APP_ENTR_RPC;
+    append_entry_rpc_t &heartbeat = msg.append_rpc;
     heartbeat.term = get_context()->get_curr_term();
     heartbeat.leader_id = get_context()->get_id();
     heartbeat.commit_index = get_context()->get_bc_log().get_committed_index();
     heartbeat.prev_log_index = get_context()->get_bc_log().get_last_index();
     heartbeat.prev_log_term = get_context()->get_bc_log().get_last_term();
     // Heartbeat doesn't contain any log entries, prev log term or index.
-    
-    // Need to wrap the heartbeat with replica_msg_wrapper_t because it's the msg used by the network.
-    replica_msg_wrapper_t msg;
-    msg.type = APP_ENTR_RPC;
-    msg.payload = (void*) &heartbeat;
 
-    // Broadcast the heartbeat to all peers
-    get_context()->get_network()->replica_send_message(msg);
+    // Send the heartbeat to all voters and learners, the lagging learners and the server catching up get the missing entries instead.
+    // The heartbeat is the same for every follower, it's encoded once.
+    auto now = clock_now();
+    bool commit_waited = std::chrono::duration_cast<std::chrono::milliseconds>(now - commit_time).count() >= COMMIT_PIGGYBACK_WAIT_MS;
+    uint64_t receivers = 0;
+    get_context()->get_network()->replica_cork();
+    for (int i = 0; i < get_config().server_count; i++) {
+        if (!is_replication_target(i))
+            continue;
+        bool period_passed = std::chrono::duration_cast<std::chrono::milliseconds>(now - last_append_time[i]).count() >= get_config().heartbeat_period_ms;
+        if (!period_passed && !(commit_waited && commitIndex[i] < heartbeat.commit_index))
+            continue;
+        if (is_streamed(i) && matchIndex[i] < heartbeat.prev_log_index) {
+            stream_entries(i);
+            continue;
+        }
+        receivers |= 1ULL << i;
+    }
+    send_append_rpc(msg, receivers);
+    get_context()->get_network()->replica_uncork();
+}
+
+bool LeaderState::is_replication_target(int id) {
+    return id != get_context()->get_id() && (get_context()->is_voter(id) || get_context()->is_learner(id) || id == catchup_id);
+}
+
+bool LeaderState::is_streamed(int id) {
+    return id != get_context()->get_id() && (get_context()->is_learner(id) || id == catchup_id);
+}
+
+/**
+ * @brief Start the next admin requested membership change, one server at a time.
+ *        A new server first catches up as a non-voter, the config entry adding it is appended afterwards.
+ *        Removing a server appends the config entry right away.
+ * 
+ */
+void LeaderState::check_membership_change() {
+    Server* context = get_context();
+    if (catchup_id != -1) {
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(clock_now() - catchup_start_time);
+        if (ms.count() > CATCHUP_TIMEOUT_MS && !config_pending) {
+            std::cout << "[State::LeaderState::check_membership_change] server " << catchup_id << " failed to catch up. abort adding it." << std::endl;
+            catchup_id = -1;
+        }
+        return;
+    }
+    // the previous configuration need to be committed before starting another change.
+    if (config_pending || context->get_config_index() > context->get_bc_log().get_committed_index()) {
+        return;
+    }
+
+    int server_id;
+    bool add;
+    if (!context->pop_membership_change(server_id, add)) {
+        return;
+    }
+    if (add) {
+        if (context->is_voter(server_id)) {
+            std::cout << "[State::LeaderState::check_membership_change] server " << server_id << " is already a voter." << std::endl;
+            return;
+        }
+        std::cout << "[State::LeaderState::check_membership_change] server " << server_id << " starts catching up as a non-voter." << std::endl;
+        catchup_id = server_id;
+        catchup_start_time = clock_now();
+        nextIndex[server_id] = 0;
+        matchIndex[server_id] = -1;
+        if (context->get_bc_log().get_last_index() == -1) {
+            // nothing to catch up.
+            push_config_request(context->get_voters() | (1ULL << server_id));
+            return;
+        }
+        stream_entries(server_id);
+    } else {
+        if (!context->is_voter(server_id)) {
+            std::cout << "[State::LeaderState::check_membership_change] server " << server_id << " is not a voter." << std::endl;
+            return;
+        }
+        if (context->get_voter_count() == 1) {
+            std::cout << "[State::LeaderState::check_membership_change] can't remove the last voter." << std::endl;
+            return;
+        }
+        push_config_request(context->get_voters() & ~(1ULL << server_id));
+    }
+}
 
-    last_heartbeat_time = std::chrono::system_clock::now();
+/**
+ * @brief A successful reply to entries moves the sender's indexes, a failed one starts streaming it
+ *        the log from where the reply hints. Only the replies to entries count, not to the heartbeats.
+ * 
+ * @param reply 
+ */
+void LeaderState::handle_append_reply(append_entry_reply_t* reply) {
+    int id = reply->sender_id;
+    if (reply->reply_hearbeat || reply->term != get_context()->get_curr_term()) {
+        return;
+    }
+    if (catchup_streams[id].active) {
+        handle_catchup_reply(reply);
+    } else if (reply->success) {
+        matchIndex[id] = std::max(matchIndex[id], reply->match_index);
+        nextIndex[id] = matchIndex[id] + 1;
+    } else {
+        start_catchup(id, reply->match_index + 1);
+    }
 }
 
+/**
+ * @brief The replies of the learners and the server catching up never count toward the commit quorum,
+ *        they only move the sender's indexes.
+ * 
+ * @param reply 
+ */
+void LeaderState::handle_streamed_reply(append_entry_reply_t* reply) {
+    handle_append_reply(reply);
+    if (reply->sender_id == catchup_id && matchIndex[catchup_id] >= get_context()->get_bc_log().get_last_index() && !config_pending) {
+        std::cout << "[State::LeaderState::handle_streamed_reply] server " << catchup_id << " caught up. adding it as a voter." << std::endl;
+        push_config_request(get_context()->get_voters() | (1ULL << catchup_id));
+    }
+}
+
+void LeaderState::push_config_request(uint64_t new_voters) {
+    request_t *request = new request_t();
+    bzero(request, sizeof(request_t));
+    request->type = CONFIG_CHANGE_REQUEST;
+    request->client_id = get_context()->get_id();
+    Transaction *txn = new Transaction();
+    txn->set_config(new_voters);
+    request->payload = txn;
+    get_context()->get_network()->client_push_request(request);
+    config_pending = true;
+}
+
+
+/**
+ * @brief Start the admin requested leadership transfer. The target is brought up to date first,
+ *        then it gets a TIMEOUT_NOW and campaigns right away. The transfer is aborted if the target
+ *        doesn't take over within an election timeout.
+ * 
+ */
+void LeaderState::check_leadership_transfer() {
+    Server* context = get_context();
+    if (transfer_id != -1) {
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(clock_now() - transfer_start_time);
+        if (ms.count() > get_config().election_timeout_ms) {
+            std::cout << "[State::LeaderState::check_leadership_transfer] server " << transfer_id << " didn't take over. abort the transfer." << std::endl;
+            transfer_id = -1;
+            timeout_now_sent = false;
+        }
+        return;
+    }
+
+    int server_id = context->pop_leadership_transfer();
+    if (server_id == -1) {
+        return;
+    }
+    if (!context->is_voter(server_id)) {
+        std::cout << "[State::LeaderState::check_leadership_transfer] server " << server_id << " is not a voter." << std::endl;
+        return;
+    }
+    std::cout << "[State::LeaderState::check_leadership_transfer] transferring the leadership to server " << server_id << std::endl;
+    transfer_id = server_id;
+    transfer_start_time = clock_now();
+    int last_index = context->get_bc_log().get_last_index();
+    if (matchIndex[server_id] >= last_index) {
+        send_timeout_now();
+        return;
+    }
+    // the tail first, a failed reply starts streaming the log from its hint like for any follower behind.
+    stream_entries(server_id);
+}
+
+/**
+ * @brief The target's replies move its indexes and its catch up stream as usual,
+ *        it gets the TIMEOUT_NOW once it holds the whole log.
+ * 
+ * @param reply 
+ */
+void LeaderState::handle_transfer_reply(append_entry_reply_t* reply) {
+    handle_append_reply(reply);
+    if (reply->term != get_context()->get_curr_term() || timeout_now_sent) {
+        return;
+    }
+    if (matchIndex[transfer_id] >= get_context()->get_bc_log().get_last_index()) {
+        send_timeout_now();
+    }
+}
+
+void LeaderState::send_timeout_now() {
+    timeout_now_rpc_t rpc;
+    rpc.term = get_context()->get_curr_term();
+    rpc.leader_id = get_context()->get_id();
+    replica_msg_wrapper_t msg;
+    msg.type = TIMEOUT_NOW_RPC;
+    msg.timeout_now = rpc;
+    std::cout << "[State::LeaderState::send_timeout_now] server " << transfer_id << " is up to date, sending timeout now." << std::endl;
+    get_context()->get_network()->replica_send_message(msg, transfer_id);
+    timeout_now_sent = true;
+}
+
+void LeaderState::step_down_for_vote(request_vote_rpc_t* request) {
+    if (request->leadership_transfer) {
+        // Redirect the waiting clients to the server taking over.
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(clock_now() - transfer_start_time);
+        std::cout << "[State::LeaderState::step_down_for_vote] server " << request->candidate_id << " is taking over. transfer ms: " << ms.count() << std::endl;
+        get_context()->set_curr_leader(request->candidate_id);
+    }
+    get_context()->set_state(new FollowerState(get_context()));
+}
 
 void LeaderState::run() {
     std::cout<<"[State::LeaderState::run] Running a Leader State!"<<std::endl;
-    Network* network = get_context()->get_network();
+    ShardNetwork* network = get_context()->get_network();
 
     // Leader set itself to be leader
     get_context()->set_curr_leader(get_context()->get_id());
     // Initialize nextIndex for each replica to last log index + 1
     int last_log_index = get_context()->get_bc_log().get_last_index();
-    // for (int i = 0; i < SERVER_COUNT; i++) {
+    // for (int i = 0; i < get_config().server_count; i++) {
     //     nextIndex[i] = last_log_index + 1;
     // }
     // Send the initial heartbeat to all replicas; Declear the fact the I am elected as leader
@@ -329,56 +815,66 @@ void LeaderState::run() {
     response.succeed = false;
     response.balance = -1;
     network->client_send_message(response);
+    load_xshard_txns();
 
-    request_t *msg_ptr;
-    while (true) {
-        auto curr_time = std::chrono::system_clock::now();
-        auto dt = curr_time - last_heartbeat_time;
-        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(dt);
-        
-        if (ms.count() >= HEARTBEAT_PERIOD_MS) {
-            send_heartbeat();
-            continue;
-        }
+    request_t *msg_ptr = NULL;
+    // reused for every message received, the entries keep their storage.
+    replica_msg_wrapper_t msg;
+    while (!get_context()->is_stopped()) {
+        send_heartbeat();
+
+        check_membership_change();
+        check_leadership_transfer();
+        check_xshard_txns();
+        check_catchup_streams();
 
         // Check replica message before check client request
         if (network->replica_get_message_count() != 0) {
-            replica_msg_wrapper_t msg;
             network->replica_pop_message(msg);
             if (msg.type == REQ_VOTE_RPC) {
-                request_vote_rpc_t *request = (request_vote_rpc_t*) msg.payload;
-                if (request->term > get_context()->get_curr_term()) {
-                    get_context()->set_state(new FollowerState(get_context()));
-                    if (msg.payload != NULL) free(msg.payload);
+                request_vote_rpc_t *request = &msg.vote_rpc;
+                // A removed server times out and campaigns, it shouldn't disrupt the cluster.
+                if (request->term > get_context()->get_curr_term() && get_context()->is_voter(request->candidate_id)) {
+                    step_down_for_vote(request);
+                    network->replica_return_message(msg);
                     return;
                 }
             }
+            else if (msg.type == REQ_PREVOTE_RPC) {
+                handle_prevote_rpc(&msg.vote_rpc, true);
+            }
+            else if (msg.type >= XSHARD_PREPARE_RPC && msg.type <= XSHARD_DECISION_RPL) {
+                handle_xshard_msg(msg);
+            }
             else if (msg.type == APP_ENTR_RPC) {
-                append_entry_rpc_t *append = (append_entry_rpc_t*) msg.payload;
+                append_entry_rpc_t *append = &msg.append_rpc;
                 if (append->term > get_context()->get_curr_term()) {
                     get_context()->set_state(new FollowerState(get_context()));
-                    if (msg.payload != NULL) free(msg.payload);
                     return;
                 }
             }
             // TODO: Check new code 
             else if (msg.type == APP_ENTR_RPL) {
-                append_entry_reply_t  *reply = (append_entry_reply_t *) msg.payload;
+                append_entry_reply_t  *reply = &msg.append_reply;
                 // Heartbeat reply
                 if (reply->reply_hearbeat && reply->term > get_context()->get_curr_term()) {
                     get_context()->set_state(new FollowerState(get_context()));
-                    if (msg.payload != NULL) free(msg.payload);
                     return;
                 }
+                commitIndex[reply->sender_id] = std::max(commitIndex[reply->sender_id], reply->commit_index);
                 // appendEntryRPC reply
-                if (reply->reply_hearbeat == false && reply->term == get_context()->get_curr_term()  && reply->success) {
-                    // Need to update this follower's nextIndex
-                    nextIndex[reply->sender_id] = get_context()->get_bc_log().get_blockchain_length();
+                if (is_streamed(reply->sender_id)) {
+                    handle_streamed_reply(reply);
+                }
+                else if (reply->sender_id == transfer_id && !reply->reply_hearbeat) {
+                    handle_transfer_reply(reply);
+                }
+                else {
+                    handle_append_reply(reply);
                 }
             }
             else {
                 // Ignore all other type of msg
-                if (msg.payload != NULL) free(msg.payload);
             }
         }
 
@@ -386,101 +882,180 @@ void LeaderState::run() {
         // NOTE: respond to vote rpc and heartbeat.
 
         // If the request buffer is empty then do nothing, waiting for another round to check.
-        if (network->client_get_request_count() == 0) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(MSG_CHECK_SLEEP_MS));
+        // No new request is handled while the leadership is being transferred.
+        if (network->client_get_request_count() == 0 || transfer_id != -1) {
+            network->wait_message(MSG_CHECK_SLEEP_MS, transfer_id == -1);
             continue;
         }
         
-        for (int i = 0; i < SERVER_COUNT; i++) {
+        for (int i = 0; i < get_config().server_count; i++) {
+            if (is_streamed(i))
+                continue;
             nextIndex[i] = get_context()->get_bc_log().get_last_index() + 1;
         }
 
         // Fetch a client request, start the protocol
         // std::cout<<"[State::LeaderState::run] Recv a Client Request!"<<std::endl;
-        msg_ptr = network->client_pop_request();
+        // capped, so a fresh request always gets a chance: nothing would correct an estimate above the
+        // client timeout (ie. after a slow first commit that repaired the followers' logs) if every request was shed.
+        msg_ptr = network->client_pop_request(std::min(avg_commit_ms, (uint32_t) CLIENT_REQ_TIMEOUT_MS / 2));
+        if (msg_ptr == NULL) {
+            // every queued request would finish after its client gave up.
+            continue;
+        }
+        auto request_start = clock_now();
 
         // Get current block info, after append new block, current block will become prev block
         term_t prev_log_term = get_context()->get_bc_log().get_last_term();
         int prev_log_index = get_context()->get_bc_log().get_last_index();
 
+        // The leader's balance table is the freshest, no need to go through the log.
+        if (msg_ptr->type == STALE_BALANCE_REQUEST) {
+            response_t response;
+            response.type = BALANCE_RESPONSE;
+            response.request_id = msg_ptr->request_id;
+            response.leader_id = get_context()->get_id();
+            response.succeed = true;
+            response.balance = -1;
+            get_context()->reply_after_apply(get_context()->get_bc_log().get_committed_index(), response, msg_ptr->client_id);
+            delete msg_ptr;
+            continue;
+        }
+
         // Append new entry to local
         // adding new transaction will push into the blockchain a new block with the transaction wrapped
+        // With parallel_log_write the block is only added in memory here and written to the file while it's replicated.
+        bool written = !get_config().parallel_log_write;
         if (msg_ptr->type == BALANCE_REQUEST) {
-            get_context()->get_bc_log().add_transaction(get_context()->get_curr_term(), Transaction(true));
+            get_context()->get_bc_log().add_transaction(get_context()->get_curr_term(), Transaction(true), written);
+        }
+        else if (msg_ptr->type == TRANSACTION_REQUEST && !get_context()->owns_account(((Transaction*)msg_ptr->payload)->get_recver_id())) {
+            // The receiver belongs to another shard, nothing is appended until it's prepared.
+            start_xshard_txn(msg_ptr);
+            delete (Transaction*) msg_ptr->payload;
+            delete msg_ptr;
+            continue;
         }
         else if (msg_ptr->type == TRANSACTION_REQUEST) {
-            get_context()->get_bc_log().add_transaction(get_context()->get_curr_term(), *((Transaction*)msg_ptr->payload));
+            get_context()->get_bc_log().add_transaction(get_context()->get_curr_term(), *((Transaction*)msg_ptr->payload), written);
+        }
+        else if (msg_ptr->type == XSHARD_REQUEST) {
+            get_context()->get_bc_log().add_transaction(get_context()->get_curr_term(), *((Transaction*)msg_ptr->payload), written);
+            track_xshard_entry(prev_log_index + 1);
+        }
+        else if (msg_ptr->type == CONFIG_CHANGE_REQUEST) {
+            // The new configuration takes effect as soon as it's in the log.
+            get_context()->get_bc_log().add_transaction(get_context()->get_curr_term(), *((Transaction*)msg_ptr->payload), written);
+            get_context()->refresh_membership(prev_log_index + 1);
+            config_pending = false;
+            if (catchup_id != -1 && get_context()->is_voter(catchup_id)) {
+                catchup_id = -1;
+            }
+            std::cout << "[State::LeaderState::run] appended config entry. voters mask: " << get_context()->get_voters() << std::endl;
         }
         else {
             // Ignore all other types of msg from client
             // Free msg ptr and payload
             if (msg_ptr->payload != NULL) {
-                free(msg_ptr->payload);
+                delete (Transaction*) msg_ptr->payload;
             }
-            if (msg_ptr != NULL) free(msg_ptr);
+            if (msg_ptr != NULL) delete msg_ptr;
             continue;
         }
+        // The local write runs concurrently with the AppendEntries below, it's waited for at the end of this round at the latest.
+        std::future<void> local_write;
+        if (!written) {
+            Blockchain &log = get_context()->get_bc_log();
+            Block new_block = log.get_block_by_index(prev_log_index + 1);
+            local_write = std::async(std::launch::async, [&log, new_block]() { log.persist_block(new_block); });
+        }
         // Whenever last log index >= netIndex for a follower, send AppendEntries PRC with log enetries starting at nextIndex,
         // Update nextIndex if successful
         // If AppendEntries fails because of log inconsistency, decrement nextIndex and retry
-        for (int i = 0; i < SERVER_COUNT; i++) {
-            if (i == get_context()->get_id()) continue;
-            replica_msg_wrapper_t msg;
-            msg.type = APP_ENTR_RPC;
-            append_entry_rpc_t append_msg;
-            append_msg.term = get_context()->get_curr_term();
-            append_msg.leader_id = get_context()->get_id();
-            append_msg.prev_log_term = prev_log_term;
-            append_msg.prev_log_index = prev_log_index;
-            append_msg.commit_index = get_context()->get_bc_log().get_committed_index();
-            // next_index is initially initialized to my last index + 1 before the push happens
-            // so basically it means the initial value should be prev_log_index + 1 at this moment
-            // which is also the newly pushed block index
-            int next_index = prev_log_index + 1;
-            std::vector<Block> entries;
-            for (int j = next_index; j <= get_context()->get_bc_log().get_blockchain_length() - 1; j++) {
-                entries.push_back(get_context()->get_bc_log().get_block_by_index(j));
-            }
-            append_msg.entries = entries;
-            msg.payload = (void*) &append_msg;
-            std::cout << "[State::LeaderState::run] sending <append entry rpc>!" << std::endl;
-            network->replica_send_message(msg, i);
-        }
-
-        int num_accept = 1;
+        // The AppendEntries of all the followers leave together, the one of the followers up to date is encoded once for all of them.
+        replica_msg_wrapper_t send_msg;
+        send_msg.type = APP_ENTR_RPC;
+        append_entry_rpc_t &append_msg = send_msg.append_rpc;
+        append_msg.term = get_context()->get_curr_term();
+        append_msg.leader_id = get_context()->get_id();
+        append_msg.prev_log_term = prev_log_term;
+        append_msg.prev_log_index = prev_log_index;
+        append_msg.commit_index = get_context()->get_bc_log().get_committed_index();
+        // next_index is initially initialized to my last index + 1 before the push happens
+        // so basically it means the initial value should be prev_log_index + 1 at this moment
+        // which is also the newly pushed block index
+        int next_index = prev_log_index + 1;
+        for (int j = next_index; j <= get_context()->get_bc_log().get_blockchain_length() - 1; j++) {
+            append_msg.entries.push_back(get_context()->get_bc_log().get_block_by_index(j));
+        }
+        uint64_t receivers = 0;
+        get_context()->get_network()->replica_cork();
+        for (int i = 0; i < get_config().server_count; i++) {
+            if (!is_replication_target(i)) continue;
+            // a lagging voter gets the new entry after the ones it misses.
+            if (is_streamed(i) || catchup_streams[i].active) {
+                stream_entries(i);
+                continue;
+            }
+            receivers |= 1ULL << i;
+        }
+        std::cout << "[State::LeaderState::run] sending <append entry rpc>!" << std::endl;
+        send_append_rpc(send_msg, receivers);
+        get_context()->get_network()->replica_uncork();
+
+        // Only the voters of the latest configuration count, the leader itself included if it's still a voter
+        // and the new entry is in its log file.
+        int num_accept = (written && get_context()->is_voter(get_context()->get_id())) ? 1 : 0;
+        std::vector<bool> accepted(get_config().server_count, false);
         int timeout_flag = false;
-        auto last = std::chrono::system_clock::now();
+        auto last = clock_now();
         // keep running if without getting majority
         // note: do we need to consider about the timeout here
-        while (num_accept < SERVER_COUNT / 2 + 1) {
+        while (num_accept < get_context()->quorum_size()) {
             // Leader break out the loop of waiting accepts if Timeout
-            auto curr = std::chrono::system_clock::now();
+            auto curr = clock_now();
             auto dt = curr - last;
             auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(dt);
-            if (ms.count() > LEADER_HANDLE_TIME_MS) {
+            if (ms.count() > LEADER_HANDLE_TIME_MS || get_context()->is_stopped()) {
                 std::cout << "Leader wait for accept timeout !" << std::endl;
                 timeout_flag = true;
                 break;
             }
+            // a slow commit mustn't look like a dead leader to the followers' failure detectors.
+            send_heartbeat();
+            check_catchup_streams();
+
+            if (!written && local_write.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready) {
+                written = true;
+                if (get_context()->is_voter(get_context()->get_id())) {
+                    num_accept++;
+                }
+                continue;
+            }
 
             if (network->replica_get_message_count() == 0) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(MSG_CHECK_SLEEP_MS));
+                network->wait_message(MSG_CHECK_SLEEP_MS);
                 continue;
             }
-            replica_msg_wrapper_t msg;
             network->replica_pop_message(msg);
             if (msg.type == REQ_VOTE_RPC) {
                  std::cout<<"[State::LeaderState::run] recv a <request vote rpc>!"<<std::endl;
-                request_vote_rpc_t* vote_rpc = (request_vote_rpc_t*) msg.payload;
-                if (vote_rpc->term > get_context()->get_curr_term()) {
+                request_vote_rpc_t* vote_rpc = &msg.vote_rpc;
+                if (vote_rpc->term > get_context()->get_curr_term() && get_context()->is_voter(vote_rpc->candidate_id)) {
                     // Step down
-                    get_context()->set_state(new FollowerState(get_context()));
+                    step_down_for_vote(vote_rpc);
                     goto exit;
                 }
             }
+            else if (msg.type == REQ_PREVOTE_RPC) {
+                handle_prevote_rpc(&msg.vote_rpc, true);
+            }
+            else if (msg.type >= XSHARD_PREPARE_RPC && msg.type <= XSHARD_DECISION_RPL) {
+                handle_xshard_msg(msg);
+            }
             else if (msg.type == APP_ENTR_RPC) {
                 std::cout<<"[State::LeaderState::run] recv a <append entry rpc>!"<<std::endl;
-                append_entry_rpc_t* append_rpc = (append_entry_rpc_t*) msg.payload;
+                append_entry_rpc_t* append_rpc = &msg.append_rpc;
                 if (append_rpc->term > get_context()->get_curr_term()) {
                     // Step down
                     get_context()->set_state(new FollowerState(get_context()));
@@ -489,7 +1064,7 @@ void LeaderState::run() {
             }
             else if (msg.type == APP_ENTR_RPL) {
                 
-                append_entry_reply_t* reply = (append_entry_reply_t*) msg.payload;
+                append_entry_reply_t* reply = &msg.append_reply;
 
                 std::cout<<"[State::LeaderState::run] recv a <append entry rpc reply>! term: " << reply->term <<std::endl;
 
@@ -497,44 +1072,33 @@ void LeaderState::run() {
                     get_context()->set_state(new FollowerState(get_context()));
                     goto exit;
                 }
+                commitIndex[reply->sender_id] = std::max(commitIndex[reply->sender_id], reply->commit_index);
+
+                if (is_streamed(reply->sender_id)) {
+                    handle_streamed_reply(reply);
+                    continue;
+                }
 
                 if (reply->term == get_context()->get_curr_term()) {
-                    // Reset timmer
-                    last = std::chrono::system_clock::now();
+                    // Reset timmer, the replies to the heartbeats sent while waiting don't count.
+                    if (!reply->reply_hearbeat) {
+                        last = clock_now();
+                    }
 
                     if (reply->success == true && reply->reply_hearbeat == false) {
                         // Append entry succeed
                         std::cout<<"[State::LeaderState::run] append succeed! sender: " << reply->sender_id <<std::endl;
-                        num_accept++;
-                        nextIndex[reply->sender_id] = get_context()->get_bc_log().get_blockchain_length();
-                    }
-                    else {
-                        // Append failed due to log inconsistency, decrement nextIndex and retry
-                        std::cout<<"[State::LeaderState::run] append failed due to log inconsistency, Retry!"<<std::endl;
-                        nextIndex[reply->sender_id] = nextIndex[reply->sender_id] - 1;
-                        prev_log_index = nextIndex[reply->sender_id] - 1;
-
-                        if (prev_log_index < -1) {
-                            continue;
+                        // A late reply to the previous entry doesn't count, the follower must hold the new one.
+                        if (get_context()->is_voter(reply->sender_id) && !accepted[reply->sender_id] && reply->match_index > prev_log_index) {
+                            accepted[reply->sender_id] = true;
+                            num_accept++;
                         }
-
-                        replica_msg_wrapper_t msg;
-                        msg.type = APP_ENTR_RPC;
-                        append_entry_rpc_t append_msg;
-                        append_msg.term = get_context()->get_curr_term();
-                        append_msg.leader_id = get_context()->get_id();
-                        append_msg.prev_log_term = (prev_log_index == -1) ? 0 : get_context()->get_bc_log().get_block_by_index(prev_log_index).get_term();
-                        append_msg.prev_log_index = (prev_log_index == -1) ? -1 : get_context()->get_bc_log().get_block_by_index(prev_log_index).get_index();
-                        append_msg.commit_index = get_context()->get_bc_log().get_committed_index();
-                        int next_index = nextIndex[reply->sender_id];
-                        std::vector<Block> entries;
-                        for (int j = next_index; j <= get_context()->get_bc_log().get_blockchain_length() - 1; j++) {
-                            entries.push_back(get_context()->get_bc_log().get_block_by_index(j));
-                        }
-                        append_msg.entries = entries;
-                        msg.payload = (void*) &append_msg;
-                        network->replica_send_message(msg, reply->sender_id);
                     }
+                    else if (!reply->reply_hearbeat) {
+                        // Append failed due to log inconsistency, the follower is streamed the missing entries.
+                        std::cout<<"[State::LeaderState::run] append failed due to log inconsistency, catch up server " << reply->sender_id << std::endl;
+                    }
+                    handle_append_reply(reply);
                 } 
             }
             else {
@@ -543,8 +1107,16 @@ void LeaderState::run() {
         }
         
         std::cout << "[State::LeaderState::run] stop waiting for majority commit result. num accepted: " << num_accept << std::endl;
+        if (!timeout_flag) {
+            // commit latency of this request for comparing different cluster sizes.
+            auto commit_ms = std::chrono::duration_cast<std::chrono::milliseconds>(clock_now() - request_start);
+            std::cout << "[State::LeaderState::run] commit latency ms: " << commit_ms.count() << " cluster size: " << get_config().server_count << std::endl;
+            avg_commit_ms = avg_commit_ms ? (avg_commit_ms * 7 + commit_ms.count()) / 8 : commit_ms.count();
+        }
         
         response_t response;
+        // The response is sent by the apply thread once this index is applied to the balance table.
+        int reply_index = get_context()->get_bc_log().get_committed_index();
         if (timeout_flag) {
             // Reply failure to client
             response.succeed = false;
@@ -552,11 +1124,38 @@ void LeaderState::run() {
         else{
             response.succeed = true;
             // Mark log committed if stored on a majority and at least one entry stored in the current term.
-            // Execute the committed txn on balacne table, Also update committed index of the blockchain
+            // Hand the committed txn to the apply thread, Also update committed index of the blockchain
             std::cout<<"[State::LeaderState::run] Enrty Committed, Update Balance Table!"<<std::endl;
+            // the followers alone can make the majority, the committed index in the file mustn't pass the blocks in it.
+            if (!written) {
+                local_write.wait();
+            }
             int curr_committed_index =  get_context()->get_bc_log().get_blockchain_length() - 1;
-            get_context()->update_bal_tab_and_committed_index(curr_committed_index);
+            get_context()->advance_committed_index(curr_committed_index);
+            reply_index = curr_committed_index;
+            commit_time = clock_now();
+        }
+        // A cross shard entry has no client to reply to, the coordinator replies once its commit entry is applied.
+        if (msg_ptr->type == XSHARD_REQUEST) {
+            delete (Transaction*) msg_ptr->payload;
+            delete msg_ptr;
+            continue;
         }
+        // A config entry has no client to reply to.
+        // The leader steps down once the configuration removing it is committed.
+        if (msg_ptr->type == CONFIG_CHANGE_REQUEST) {
+            if (!timeout_flag && !get_context()->is_voter(get_context()->get_id())) {
+                std::cout << "[State::LeaderState::run] removed from the configuration, Step down to Follower State!" << std::endl;
+                get_context()->set_state(new FollowerState(get_context()));
+                goto exit;
+            }
+            if (msg_ptr->payload != NULL) {
+                delete (Transaction*) msg_ptr->payload;
+            }
+            delete msg_ptr;
+            continue;
+        }
+
         // Reply to client
         if (msg_ptr->type == TRANSACTION_REQUEST) {
             response.type = TRANSACTION_RESPONSE;
@@ -566,21 +1165,23 @@ void LeaderState::run() {
         }
         response.request_id = msg_ptr->request_id;
         response.leader_id = get_context()->get_id();
-        response.balance = get_context()->get_bal_tab().get_balance(msg_ptr->client_id);
+        response.balance = -1;
         // std::cout<<"[State::LeaderState::run] reply to client. balance: " << response.balance <<std::endl;
-        network->client_send_message(response, msg_ptr->client_id);
+        get_context()->reply_after_apply(reply_index, response, msg_ptr->client_id);
 
         // Free msg ptr and payload
         if (msg_ptr->payload != NULL) {
-            free(msg_ptr->payload);
+            delete (Transaction*) msg_ptr->payload;
         }
-        if (msg_ptr != NULL) free(msg_ptr);
+        if (msg_ptr != NULL) delete msg_ptr;
     }
+    // stopped, the last request is already freed.
+    return;
 
 exit:
     if (msg_ptr->payload != NULL) {
-        free(msg_ptr->payload);
+        delete (Transaction*) msg_ptr->payload;
     }
-    if (msg_ptr != NULL) free(msg_ptr);
+    if (msg_ptr != NULL) delete msg_ptr;
     return; 
 }
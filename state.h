@@ -1,42 +1,169 @@
 #pragma once
+#include <map>
+#include <set>
+#include <deque>
+#include <chrono>
+#include <thread>
+#include <atomic>
 #include "server.h"
 #include "parameter.h"
+#include "raft.h"
 
 class State {
 private:
     Server* context;
 
 protected:
-    const uint32_t MSG_CHECK_SLEEP_MS = 50;
+    const uint32_t MSG_CHECK_SLEEP_MS = 50;                             // The longest wait for a message, one queued for the shard ends it.
     uint32_t curr_election_timeout;
 
 public:
-    State(Server* context) {this->context = context; srand(time(NULL));};
+    State(Server* context) {this->context = context;};
+    virtual ~State() {};
     Server* get_context() {return context;};
-    void gen_election_timeout() {curr_election_timeout = ELECTION_TIMEOUT_MS / 2 + rand() % (ELECTION_TIMEOUT_MS / 2);};
+    void gen_election_timeout() {curr_election_timeout = get_config().election_timeout_ms / 2 + context->random() % (get_config().election_timeout_ms / 2);};
+    bool is_log_up_to_date(request_vote_rpc_t* rpc);                    // The candidate's log is at least as up-to-date as mine.
+    void handle_prevote_rpc(request_vote_rpc_t* rpc, bool leader_alive);
+    State* new_election_state();                                        // The state a timed out follower moves to.
+    void serve_stale_read(request_t* request, std::chrono::system_clock::time_point last_leader_time);
     virtual void run() {};
 };
 
+class PreCandidateState : public State {
+private:
+    uint32_t prevote_count;
+public:
+    PreCandidateState(Server* context) : State(context) {};
+    void run() override;
+};
+
 class CandidateState : public State {
 private:
     uint32_t vote_count;
+    bool leadership_transfer;                                           // Started by a TIMEOUT_NOW from the leader.
 public:
-    CandidateState(Server* context) : State(context) {};
+    CandidateState(Server* context, bool leadership_transfer = false) : State(context), leadership_transfer(leadership_transfer) {};
     void run() override;
 };
 
 class FollowerState : public State {    
+private:
+    // heard from the leader too recently to vote for someone else. Judged by the failure detector if it learned
+    // enough intervals, it only has to start doubting, otherwise by the election timeout.
+    bool leader_alive(std::chrono::system_clock::time_point last_leader_time);
+    void follow_commit_index(int leader_commit_index, int match_index);
 public:
     FollowerState(Server* context) : State(context) {};
     void run() override;
 };
 
+// a cross shard transfer as tracked by the leader of one of its two shards.
+// the coordinator is the shard of the sender, it logs only the commit entry and presumes an abort for unknown transfers.
+// the participant, the shard of the receiver, logs a prepare entry before voting and then the decision.
+struct xshard_txn_t {
+    Transaction txn;                                                    // the transfer, xshard phase and txn id set
+    bool coordinator = false;
+    int prepare_index = -1;                                             // participant: log index of the prepare entry
+    int decision_index = -1;                                            // log index of the commit or abort entry
+    bool commit = false;                                                // the decision
+    bool aborted = false;                                               // coordinator: gave up without logging anything
+    bool entry_pending = false;                                         // an entry for it is queued but not appended yet
+    bool peer_prepared = false;                                         // coordinator: the participant voted yes
+    bool peer_done = false;                                             // coordinator: the participant committed the decision
+    int client_id = -1;                                                 // coordinator: the client waiting for the result
+    uint64_t request_id = 0;
+    std::chrono::system_clock::time_point start_time;
+    std::chrono::system_clock::time_point last_sent_time;
+};
+
+// sends the catch-up chunks of one lagging follower on its own thread, so serializing and writing
+// them never holds up the leader's thread. The leader builds the chunks, see catchup.cpp.
+class CatchupSender {
+private:
+    ShardNetwork* network;
+    int id;
+    SpscQueue<append_entry_rpc_t*, CATCHUP_QUEUE_SIZE> queue;           // Built by the leader thread, sent and deleted by the sender thread.
+    std::atomic<bool> stop_flag;
+    std::atomic<bool> done;                                             // The thread returned, it can be joined.
+    std::thread thread;
+    void send_handler();
+public:
+    CatchupSender(ShardNetwork* network, int id);
+    ~CatchupSender();
+    bool push(append_entry_rpc_t* chunk);                               // false if the queue is full, the chunk isn't taken.
+};
+
+// the log streamed to a follower lagging behind the leader, CATCHUP_CHUNK_SIZE entries per AppendEntries
+// and at most CATCHUP_WINDOW of them not acknowledged yet.
+struct catchup_stream_t {
+    bool active = false;
+    int next_index = 0;                                                 // The first entry not sent yet.
+    int base_index = 0;                                                 // Where the stream last (re)started.
+    std::deque<int> in_flight;                                          // The last index of every chunk not acknowledged yet.
+    std::chrono::system_clock::time_point progress_time;                // The last ack or (re)start.
+    CatchupSender* sender = NULL;                                       // Created the first time the follower lags.
+};
+
 class LeaderState : public State {
 private:
-    int nextIndex[CLIENT_COUNT];
-    std::chrono::system_clock::time_point last_heartbeat_time;
-    void send_heartbeat();
+    const uint32_t CATCHUP_TIMEOUT_MS = 60000;                          // Give up adding a server that can't catch up within this time.
+
+    std::vector<int> nextIndex;                                         // indexed by server id
+    std::vector<int> matchIndex;                                        // indexed by server id
+    std::vector<int> commitIndex;                                       // indexed by server id, the highest committed index it replied with or was sent
+    std::chrono::system_clock::time_point commit_time;                  // When the committed index last advanced.
+    std::vector<std::chrono::system_clock::time_point> last_append_time; // indexed by server id, when it was last sent an AppendEntries of any kind
+
+    // membership related
+    int catchup_id = -1;                                                // The server catching up as a non-voter before being added.
+    bool config_pending = false;                                        // A config entry is queued but not appended yet.
+    std::chrono::system_clock::time_point catchup_start_time;
+
+    // leadership transfer related
+    int transfer_id = -1;                                               // The server taking over, client requests wait meanwhile.
+    bool timeout_now_sent = false;
+    std::chrono::system_clock::time_point transfer_start_time;
+
+    uint32_t avg_commit_ms = 0;                                         // Moving average of the commit latency, a queued request needs that long to finish.
+
+    bool is_replication_target(int id);                                 // Voters, learners and the server catching up get the AppendEntries.
+    bool is_streamed(int id);                                           // Learners and the server catching up are sent entries from their own nextIndex.
+    void send_append_rpc(replica_msg_wrapper_t &msg, uint64_t receivers);   // Every AppendEntries goes through here, encoded once for all the receivers (bit i for server i), it postpones their next heartbeat.
+    void send_heartbeat();                                              // Only to the servers due one, see the definition.
+    void mark_append_sent(int id, int commit_index);
+    void check_membership_change();
+    void handle_append_reply(append_entry_reply_t* reply);              // Move the sender's indexes, or catch it up if it lags.
+    void handle_streamed_reply(append_entry_reply_t* reply);
+    void push_config_request(uint64_t new_voters);
+    void check_leadership_transfer();
+    void handle_transfer_reply(append_entry_reply_t* reply);
+    void send_timeout_now();
+    void step_down_for_vote(request_vote_rpc_t* request);               // A voter started an election with a higher term.
+
+    // cross shard transfer related, see xshard.cpp
+    const uint32_t XSHARD_PREPARE_TIMEOUT_MS = get_config().election_timeout_ms;      // Abort if the other shard doesn't vote within this time.
+    const uint32_t XSHARD_RETRY_MS = get_config().heartbeat_period_ms;               // Resend an unanswered prepare, vote or decision after this time.
+    std::map<uint64_t, xshard_txn_t> xshard_txns;                       // The unfinished cross shard transfers, by txn id.
+    std::set<uint64_t> xshard_done;                                     // The finished ones, a late duplicate message doesn't restart them.
+    void load_xshard_txns();                                            // Rebuild the transfers in my log when elected.
+    void start_xshard_txn(request_t* request);
+    void track_xshard_entry(int index);                                 // A cross shard entry was appended at index.
+    void check_xshard_txns();
+    void handle_xshard_msg(replica_msg_wrapper_t &msg);
+    void push_xshard_request(xshard_txn_t &xtxn, uint32_t phase);
+    void send_xshard_msg(replica_msg_type_t type, xshard_txn_t &xtxn, bool commit, int shard = -1);
+
+    // catch-up of the lagging followers, see catchup.cpp
+    const uint32_t CATCHUP_RETRY_MS = get_config().heartbeat_period_ms;  // Restart a stream from the last ack if none came within this time.
+    std::vector<catchup_stream_t> catchup_streams;                      // indexed by server id
+    void start_catchup(int id, int from_index);
+    void pump_catchup(int id);                                          // Send chunks until the window is full or the tail is sent.
+    void stream_entries(int id);                                        // Send a follower the entries it misses through its stream.
+    void handle_catchup_reply(append_entry_reply_t* reply);
+    void check_catchup_streams();
 public:
-    LeaderState(Server* context) : State(context) {};
+    LeaderState(Server* context) : State(context), nextIndex(get_config().server_count, 0), matchIndex(get_config().server_count, -1),
+        commitIndex(get_config().server_count, -1), last_append_time(get_config().server_count), catchup_streams(get_config().server_count) {};
+    ~LeaderState();
     void run() override;
 };
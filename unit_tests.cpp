@@ -5,9 +5,50 @@
 #include "blockchain.h"
 #include "balance_table.h"
 #include "Msg.pb.h"
+#include "config.h"
+#include "simulator.h"
+#include "framing.h"
+#include "event_loop.h"
+#include "lockfree_queue.h"
+#include <sys/socket.h>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <new>
 
 using namespace std;
 
+// every allocation of the process is counted, for the tests of the paths that shouldn't allocate.
+static std::atomic<uint64_t> allocation_count(0);
+
+void* operator new(size_t size) {
+    allocation_count++;
+    void* ptr = malloc(size ? size : 1);
+    if (ptr == NULL) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+// the messages sent by a Network built on it go nowhere.
+class NullTransport : public Transport {
+public:
+    void send_replica_message(int from_id, uint64_t receivers, const replica_msg_t &msg) override {};
+    void send_client_response(int from_id, int client_id, const response_t &response) override {};
+};
+
+// the messages sent by a Network built on it go nowhere, but the last replica message is kept encoded.
+class FrameTransport : public Transport {
+public:
+    std::string frame;
+    void send_replica_message(int from_id, uint64_t receivers, const replica_msg_t &msg) override {msg.SerializeToString(&frame);};
+    void send_client_response(int from_id, int client_id, const response_t &response) override {};
+};
+
 void run_test_bc() {
 
     // Test load file, parse_file_to_bc
@@ -59,12 +100,471 @@ void run_test_bal_tab() {
     BalanceTable bt1b;
     bt1b.load_file("bal_tab_1.txt");
     bt1b.print_bal_tab();
+
+    // Test the applied index is written with the amounts
+    bt1b.set_applied_index(7);
+    bt1b.write_bal_tab_to_file();
+    BalanceTable bt1c;
+    bt1c.load_file("bal_tab_1.txt");
+    std::cout << "applied index: " << bt1c.get_applied_index() << "; client 1: " << bt1c.get_balance(1) << endl;
+}
+
+void run_test_config() {
+
+    // Test load_cluster_config with a 5 servers cluster
+    std::ofstream outfile("cluster_test.conf");
+    outfile << "# five servers" << endl;
+    outfile << "server_count = 5" << endl;
+    outfile << "server_ip.4 = 127.0.0.2" << endl;
+    outfile.close();
+    bool loaded = load_cluster_config("cluster_test.conf");
+    std::cout << "loaded: " << loaded << "; servers: " << get_config().server_count;
+    std::cout << "; voters mask: " << get_config().initial_voters;
+    std::cout << "; server 4 ip: " << get_config().get_server_ip(4) << endl;
+
+    // Test a malformed config is rejected and the loaded one is kept
+    std::ofstream badfile("cluster_bad.conf");
+    badfile << "server_count = five" << endl;
+    badfile.close();
+    loaded = load_cluster_config("cluster_bad.conf");
+    std::cout << "loaded: " << loaded << "; servers: " << get_config().server_count << endl;
+
+    // Test a server ip of an id past server_count and a missing file given explicitly are rejected
+    std::ofstream ipfile("cluster_bad.conf");
+    ipfile << "server_count = 3" << endl;
+    ipfile << "server_ip.4 = 127.0.0.3" << endl;
+    ipfile.close();
+    loaded = load_cluster_config("cluster_bad.conf");
+    bool missing_loaded = load_cluster_config("cluster_missing.conf");
+    std::cout << "loaded: " << loaded << "; missing loaded: " << missing_loaded << "; servers: " << get_config().server_count << endl;
+
+    // Test learners, they can't be voters at the same time
+    std::ofstream learnerfile("cluster_learner.conf");
+    learnerfile << "server_count = 5" << endl;
+    learnerfile << "voters = 0,1,2" << endl;
+    learnerfile << "learners = 3,4" << endl;
+    learnerfile.close();
+    loaded = load_cluster_config("cluster_learner.conf");
+    std::cout << "loaded: " << loaded << "; voters mask: " << get_config().initial_voters;
+    std::cout << "; learners mask: " << get_config().initial_learners << endl;
+    std::ofstream overlapfile("cluster_bad.conf");
+    overlapfile << "server_count = 5" << endl;
+    overlapfile << "learners = 4" << endl;
+    overlapfile.close();
+    loaded = load_cluster_config("cluster_bad.conf");
+    std::cout << "loaded: " << loaded << "; learners mask: " << get_config().initial_learners << endl;
+
+    // Test shards, account 4 belongs to shard 1 and every shard gets its own files
+    std::ofstream shardfile("cluster_shard.conf");
+    shardfile << "shard_count = 3" << endl;
+    shardfile.close();
+    loaded = load_cluster_config("cluster_shard.conf");
+    std::cout << "loaded: " << loaded << "; shards: " << get_config().shard_count << "; shard of 4: " << get_config().shard_of(4);
+    std::cout << "; shard 1 log of server 2: " << get_config().shard_file("bc_file", 2, 1) << endl;
+
+    // Test the replica transport, the servers connect directly over TCP unless the mesh or another link is chosen
+    bool direct = (get_config().replica_transport == REPLICA_DIRECT);
+    bool tcp = (get_config().replica_link == LINK_TCP);
+    std::ofstream transportfile("cluster_test.conf");
+    transportfile << "replica_transport = mesh" << endl;
+    transportfile << "replica_link = unix" << endl;
+    transportfile << "link_dir = /run" << endl;
+    transportfile.close();
+    loaded = load_cluster_config("cluster_test.conf");
+    std::cout << "direct by default: " << direct << "; loaded: " << loaded << "; through the mesh: " << (get_config().replica_transport == REPLICA_MESH) << endl;
+    std::cout << "tcp by default: " << tcp << "; unix socket of 9000: " << (get_config().replica_link == LINK_UNIX ? get_config().link_path(9000) : "none") << endl;
+    std::ofstream unknownfile("cluster_bad.conf");
+    unknownfile << "replica_transport = pigeon" << endl;
+    unknownfile.close();
+    loaded = load_cluster_config("cluster_bad.conf");
+    std::cout << "loaded: " << loaded << "; through the mesh: " << (get_config().replica_transport == REPLICA_MESH) << endl;
+}
+
+void run_test_mpsc_queue() {
+
+    // Test the items of every producer are popped once and in order, and a full queue refuses the push
+    const int producers = 4;
+    const uint64_t items = 100000;
+    MpscQueue<uint64_t, 64> queue;
+    QueueSignal signal;
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producers; producer++) {
+        threads.push_back(std::thread([&, producer]() {
+            for (uint64_t i = 0; i < items; i++) {
+                while (!queue.push(((uint64_t) producer << 32) | i)) {
+                    std::this_thread::yield();
+                }
+                signal.notify();
+            }
+        }));
+    }
+    std::vector<uint64_t> next(producers, 0);
+    uint64_t popped = 0;
+    bool in_order = true;
+    while (popped < producers * items) {
+        uint64_t ticket = signal.ticket();
+        uint64_t item;
+        if (!queue.pop(item)) {
+            signal.wait_ms(ticket, 100);
+            continue;
+        }
+        in_order = in_order && (item & 0xffffffff) == next[item >> 32]++;
+        popped++;
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    int full_at = 0;
+    while (queue.push(full_at)) {
+        full_at++;
+    }
+
+    // Test a push wakes the waiting consumer up long before its timeout
+    uint64_t ticket = signal.ticket();
+    std::thread late_producer([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        signal.notify();
+    });
+    auto start = std::chrono::steady_clock::now();
+    bool pushed = signal.wait_ms(ticket, 5000);
+    bool woken_early = pushed && std::chrono::steady_clock::now() - start < std::chrono::milliseconds(2000);
+    late_producer.join();
+    std::cout << "popped: " << popped << "; in order: " << in_order << "; full at: " << full_at << "; woken early: " << woken_early << endl;
+}
+
+void run_test_framing() {
+
+    // Test frames split over reads of every size are handed over whole and in order, a large one included
+    std::vector<std::string> bodies = {"a", "", std::string(1 << 20, 'l'), "bc", std::string(70000, 'm'), "d"};
+    std::string stream;
+    for (auto &body : bodies) {
+        COMM_HEADER_TYPE msg_bytes = htonl(body.size());
+        stream.append((const char*) &msg_bytes, sizeof(msg_bytes));
+        stream.append(body);
+    }
+    FrameBuffer frames;
+    std::vector<std::string> received;
+    size_t offset = 0, read_bytes = 1;
+    while (offset < stream.size()) {
+        uint8_t* ptr = frames.write_ptr();
+        size_t count = std::min(std::min(read_bytes, frames.write_space()), stream.size() - offset);
+        memcpy(ptr, stream.data() + offset, count);
+        frames.commit(count);
+        offset += count;
+        read_bytes = read_bytes * 3 + 1;
+        const uint8_t* data = NULL;
+        size_t size = 0;
+        while (frames.next_frame(data, size)) {
+            received.push_back(std::string((const char*) data, size));
+        }
+    }
+    frames.write_ptr();
+    std::cout << "frames: " << received.size() << "; intact: " << (received == bodies) << "; capacity after: " << frames.get_capacity();
+
+    // Test a frame announcing more than MAX_FRAME_BYTES breaks the stream
+    FrameBuffer broken;
+    COMM_HEADER_TYPE msg_bytes = htonl(MAX_FRAME_BYTES + 1);
+    memcpy(broken.write_ptr(), &msg_bytes, sizeof(msg_bytes));
+    broken.commit(sizeof(msg_bytes));
+    const uint8_t* data = NULL;
+    size_t size = 0;
+    bool handed = broken.next_frame(data, size);
+    std::cout << "; too long handed: " << handed << " broken: " << broken.is_broken() << endl;
+
+    // Test the route headers, one receiver is sent as its id and several as a mask
+    uint8_t route[ROUTE_HEADER_MAX_BYTES];
+    uint64_t masks[3] = {1ULL << 5, (1ULL << 63) | 6, 0};
+    std::cout << "route header bytes:";
+    for (uint64_t mask : masks) {
+        size_t written = write_route_header(route, mask);
+        uint64_t receivers = 0;
+        size_t header_bytes = 0;
+        bool read = read_route_header(route, written, receivers, header_bytes);
+        std::cout << " " << written << (read && receivers == mask && header_bytes == written ? " ok" : " wrong");
+    }
+    uint64_t receivers = 0;
+    size_t header_bytes = 0;
+    std::cout << "; short one read: " << read_route_header(route, 3, receivers, header_bytes) << endl;
+}
+
+void run_test_event_loop() {
+
+    // Test frames larger than the socket buffer are written in parts and arrive whole and in order, corked or not
+    int socks[2];
+    socketpair(AF_UNIX, SOCK_STREAM, 0, socks);
+    EventLoop loop;
+    std::mutex received_mutex;
+    std::vector<std::string> received;
+    auto receiver = loop.attach(socks[0], [&](const uint8_t* data, size_t size) {
+        std::lock_guard<std::mutex> lock(received_mutex);
+        received.push_back(std::string((const char*) data, size));
+    }, NULL);
+    auto sender = loop.attach(socks[1], [](const uint8_t* data, size_t size) {}, NULL);
+    response_msg_t response_msg;
+    response_msg.set_type(BALANCE_RESPONSE);
+    response_msg.set_request_id(42);
+    response_msg.set_succeed(true);
+    std::vector<std::string> bodies = {"a", std::string(8 << 20, 'l'), "b", std::string(300000, 'm'), response_msg.SerializeAsString()};
+    sender->send_frame(bodies[0]);
+    sender->send_frame(bodies[1]);
+    sender->cork();
+    sender->send_frame(bodies[2]);
+    sender->send_frame(bodies[3]);
+    sender->send_message(response_msg);
+    sender->uncork();
+    for (int i = 0; i < 500; i++) {
+        std::lock_guard<std::mutex> lock(received_mutex);
+        if (received.size() >= bodies.size()) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    loop.stop();
+    std::cout << "frames: " << received.size() << "; intact: " << (received == bodies) << endl;
+}
+
+void run_test_msg_envelope() {
+
+    // Test once warmed up, the messages go from the receiving thread to the raft thread without allocating,
+    // heartbeats and replies between the entries included
+    NullTransport transport;
+    Network network(0, &transport);
+    replica_msg_t msgs[3];
+    for (int i = 0; i < 3; i++) {
+        msgs[i].set_receiver_id(0);
+        msgs[i].set_shard_id(0);
+    }
+    msgs[0].set_type(APP_ENTR_RPC);
+    append_entry_rpc_msg_t* append_rpc_msg = msgs[0].mutable_append_entry_rpc_msg();
+    append_rpc_msg->set_term(2);
+    append_rpc_msg->set_leader_id(1);
+    append_rpc_msg->set_prev_log_term(2);
+    append_rpc_msg->set_prev_log_index(6);
+    append_rpc_msg->set_commit_index(5);
+    for (int i = 0; i < 3; i++) {
+        Transaction txn(i, i + 1, 1.5);
+        Block block;
+        block.set_term(2);
+        block.set_phash(std::string(64, 'a' + i));
+        block.set_nonce("nonce");
+        block.set_index(7 + i);
+        block.set_txn(txn);
+        block.encode(*append_rpc_msg->add_entries());
+    }
+    msgs[1] = msgs[0];
+    msgs[1].mutable_append_entry_rpc_msg()->clear_entries();
+    msgs[2].set_type(APP_ENTR_RPL);
+    append_entry_reply_msg_t* append_reply_msg = msgs[2].mutable_append_entry_reply_msg();
+    append_reply_msg->set_term(2);
+    append_reply_msg->set_sender_id(1);
+    append_reply_msg->set_success(true);
+    append_reply_msg->set_reply_heartbeat(false);
+
+    // the rounds run in lockstep, so the counter is read while the receiving thread waits.
+    const int rounds = 400, warm_up = 100, batch = 15;
+    std::atomic<int> delivered(0), handled(0);
+    std::thread receiver([&]() {
+        for (int round = 0; round < rounds; round++) {
+            while (handled < round * batch) {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < batch; i++) {
+                network.replica_deliver(msgs[i % 3]);
+            }
+            delivered += batch;
+        }
+    });
+    replica_msg_wrapper_t msg;
+    uint64_t start_count = 0;
+    int messages = 0;
+    bool intact = true;
+    for (int round = 0; round < rounds; round++) {
+        while (delivered < (round + 1) * batch) {
+            std::this_thread::yield();
+        }
+        if (round == warm_up) {
+            start_count = allocation_count;
+        }
+        for (int i = 0; i < batch; i++) {
+            network.replica_pop_message(msg, 0);
+            if (i % 3 == 0) {
+                intact = intact && msg.type == APP_ENTR_RPC && msg.append_rpc.encoded.size() == 3 && msg.append_rpc.encoded.terms[2] == 2;
+            } else if (i % 3 == 1) {
+                intact = intact && msg.type == APP_ENTR_RPC && msg.append_rpc.encoded.size() == 0;
+            } else {
+                intact = intact && msg.type == APP_ENTR_RPL && msg.append_reply.success;
+            }
+            messages += round >= warm_up;
+        }
+        handled += batch;
+    }
+    receiver.join();
+    uint64_t allocations = allocation_count - start_count;
+    std::cout << "messages: " << messages << "; intact: " << intact << "; allocations: " << allocations << endl;
+}
+
+void run_test_msg_arena() {
+
+    // Test once warmed up, the messages are encoded, decoded and handed from the receiving thread to the raft thread
+    // with heartbeats and replies between the entries, and the only allocations left are the encoded entries:
+    // protobuf keeps the content of the long strings on the heap even in an arena, once sent and once received,
+    // so 2 allocations per entry and none per message.
+    FrameTransport transport;
+    Network sender(1, &transport);
+    Network network(0, &transport);
+    replica_msg_wrapper_t msgs[3];
+    msgs[0].type = APP_ENTR_RPC;
+    msgs[0].append_rpc.term = 2;
+    msgs[0].append_rpc.leader_id = 1;
+    msgs[0].append_rpc.prev_log_term = 2;
+    msgs[0].append_rpc.prev_log_index = 6;
+    msgs[0].append_rpc.commit_index = 5;
+    for (int i = 0; i < 3; i++) {
+        Transaction txn(i, i + 1, 1.5);
+        Block block;
+        block.set_term(2);
+        block.set_phash(std::string(64, 'a' + i));
+        block.set_nonce("nonce");
+        block.set_index(7 + i);
+        block.set_txn(txn);
+        msgs[0].append_rpc.entries.push_back(block);
+    }
+    msgs[1] = msgs[0];
+    msgs[1].append_rpc.entries.clear();
+    msgs[2].type = APP_ENTR_RPL;
+    msgs[2].append_reply.term = 2;
+    msgs[2].append_reply.sender_id = 1;
+    msgs[2].append_reply.success = true;
+    msgs[2].append_reply.reply_hearbeat = false;
+    msgs[2].append_reply.match_index = 9;
+    msgs[2].append_reply.commit_index = 5;
+
+    // the rounds run in lockstep, so the counter is read while the receiving thread waits.
+    const int rounds = 400, warm_up = 100, batch = 15;
+    std::atomic<int> delivered(0), handled(0);
+    std::thread receiver([&]() {
+        for (int round = 0; round < rounds; round++) {
+            while (handled < round * batch) {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < batch; i++) {
+                sender.replica_send_message(msgs[i % 3], 0, 0);
+                network.replica_recv_frame((const uint8_t*) transport.frame.data(), transport.frame.size());
+            }
+            delivered += batch;
+        }
+    });
+    replica_msg_wrapper_t msg;
+    std::string entry;
+    msgs[0].append_rpc.entries[2].encode(entry);
+    uint64_t start_count = 0;
+    int start_delivered = 0;
+    bool intact = true;
+    for (int round = 0; round < rounds; round++) {
+        while (delivered < (round + 1) * batch) {
+            std::this_thread::yield();
+        }
+        if (round == warm_up) {
+            start_count = allocation_count;
+            start_delivered = delivered;
+        }
+        for (int i = 0; i < batch; i++) {
+            network.replica_pop_message(msg, 0);
+            if (i % 3 == 0) {
+                intact = intact && msg.type == APP_ENTR_RPC && msg.append_rpc.encoded.size() == 3 && msg.append_rpc.encoded.terms[2] == 2
+                    && msg.append_rpc.encoded.length(2) == entry.size() && memcmp(msg.append_rpc.encoded.data(2), entry.data(), entry.size()) == 0;
+            } else if (i % 3 == 1) {
+                intact = intact && msg.type == APP_ENTR_RPC && msg.append_rpc.encoded.size() == 0;
+            } else {
+                intact = intact && msg.type == APP_ENTR_RPL && msg.append_reply.success;
+            }
+        }
+        handled += batch;
+    }
+    receiver.join();
+    uint64_t allocations = allocation_count - start_count;
+    // one message in three carries 3 entries.
+    int entries = (delivered - start_delivered) / 3 * 3;
+    std::cout << "messages: " << delivered - start_delivered << "; entries: " << entries << "; intact: " << intact;
+    std::cout << "; allocations: " << allocations << "; per entry: " << (double) allocations / entries << endl;
+}
+
+void run_test_simulator() {
+
+    // Test two simulated runs with the same seed commit the same logs
+    std::ofstream simfile("cluster_sim.conf");
+    simfile << "server_count = 3" << endl;
+    simfile << "client_count = 3" << endl;
+    simfile.close();
+    bool loaded = load_cluster_config("cluster_sim.conf");
+    std::string digests[2];
+    uint64_t committed[2] = {0, 0};
+    for (int run = 0; run < 2; run++) {
+        sim_options_t options;
+        options.seed = 7;
+        options.clients = 3;
+        options.jitter_ms = 100;
+        std::streambuf* cout_buf = std::cout.rdbuf();
+        std::cout.rdbuf(NULL);
+        Simulator sim(options);
+        sim.run_for(30000);
+        digests[run] = sim.digest();
+        sim.stop();
+        for (int client_id = 0; client_id < sim.client_count(); client_id++) {
+            committed[run] += sim.get_client(client_id)->committed;
+        }
+        std::cout.clear();
+        std::cout.rdbuf(cout_buf);
+    }
+    std::cout << "loaded: " << loaded << "; committed: " << committed[0] << " " << committed[1];
+    std::cout << "; same digest: " << (digests[0] == digests[1]) << "; digest: " << digests[0] << endl;
+
+    // Test a follower cut off while the others commit is streamed the missing log once it's back
+    sim_options_t options;
+    options.seed = 11;
+    options.clients = 3;
+    std::streambuf* cout_buf = std::cout.rdbuf();
+    std::cout.rdbuf(NULL);
+    Simulator sim(options);
+    int leader = -1;
+    while (leader == -1) {
+        sim.run_for(1000);
+        leader = sim.leader(0);
+    }
+    int follower = (leader + 1) % get_config().server_count;
+    sim.partition_toggle(follower);
+    sim.run_for(30000);
+    int behind = sim.get_server(leader, 0)->get_bc_log().get_committed_index() - sim.get_server(follower, 0)->get_bc_log().get_committed_index();
+    sim.partition_toggle(follower);
+    sim.run_for(10000);
+    leader = sim.leader(0);
+    bool caught_up = leader != -1 && sim.get_server(follower, 0)->get_bc_log().get_committed_index() >= sim.get_server(leader, 0)->get_bc_log().get_committed_index() - 1;
+
+    // Test the leadership can be transferred to a follower far behind as soon as it's back
+    follower = (leader + 1) % get_config().server_count;
+    sim.partition_toggle(follower);
+    sim.run_for(30000);
+    sim.partition_toggle(follower);
+    sim.get_server(leader, 0)->request_leadership_transfer(follower);
+    sim.run_for(get_config().election_timeout_ms);
+    bool transferred = sim.leader(0) == follower;
+    sim.stop();
+    std::cout.clear();
+    std::cout.rdbuf(cout_buf);
+    std::cout << "behind: " << (behind > 0) << "; caught up: " << caught_up << "; transferred while behind: " << transferred << endl;
 }
 
 int main() {
 
     run_test_bc();
     run_test_bal_tab();
+    run_test_config();
+    run_test_mpsc_queue();
+    run_test_framing();
+    run_test_event_loop();
+    run_test_msg_envelope();
+    run_test_msg_arena();
+    run_test_simulator();
 
     return 0;
 }
\ No newline at end of file
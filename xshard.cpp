@@ -0,0 +1,261 @@
+/**
+ * @file xshard.cpp
+ * @brief two-phase commit of the transfers between accounts of different shards, run by the shard leaders.
+ *        The shard of the sender coordinates:
+ *        1) the coordinator sends a prepare to every server of the receiver's shard, only its leader handles it.
+ *        2) the participant appends a prepare entry and votes yes once the entry is committed.
+ *        3) the coordinator appends the commit entry and replies to the client once it's applied.
+ *        4) the coordinator sends the decision, the participant appends it and acks once it's committed.
+ *        The coordinator logs nothing before the decision, a transfer it doesn't know is presumed aborted.
+ *        Every message is resent until answered, so a lost message or a new leader on either side only delays it.
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <chrono>
+#include "state.h"
+#include "raft.h"
+#include "server.h"
+
+/**
+ * @brief The transfers in my log are the only ones that survive a leader change,
+ *        the coordinator ones without a commit entry were never decided and are presumed aborted.
+ *
+ */
+void LeaderState::load_xshard_txns() {
+    Server* context = get_context();
+    Blockchain &log = context->get_bc_log();
+    for (int bid = 0; bid < log.get_blockchain_length(); bid++) {
+        Transaction &txn = log.get_block_by_index(bid).get_txn();
+        if (!txn.is_xshard()) {
+            continue;
+        }
+        xshard_txn_t &xtxn = xshard_txns[txn.get_xshard_txn_id()];
+        xtxn.txn = txn;
+        xtxn.coordinator = context->owns_account(txn.get_sender_id());
+        xtxn.start_time = clock_now();
+        if (txn.get_xshard_phase() == XSHARD_PREPARE) {
+            xtxn.prepare_index = bid;
+        } else {
+            xtxn.decision_index = bid;
+            xtxn.commit = (txn.get_xshard_phase() == XSHARD_COMMIT);
+        }
+    }
+    if (!xshard_txns.empty()) {
+        std::cout << "[State::LeaderState::load_xshard_txns] cross shard transfers in the log: " << xshard_txns.size() << std::endl;
+    }
+}
+
+/**
+ * @brief A client transfer to an account of another shard, this shard coordinates it.
+ *
+ * @param request
+ */
+void LeaderState::start_xshard_txn(request_t* request) {
+    Server* context = get_context();
+    auto now = clock_now();
+    // unique among the leaders of every shard: the time, my id and my shard.
+    uint64_t txn_id = (std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() << 16)
+                    | (context->get_id() << 8) | context->get_shard_id();
+    xshard_txn_t &xtxn = xshard_txns[txn_id];
+    xtxn.txn = *((Transaction*) request->payload);
+    xtxn.txn.set_xshard(XSHARD_PREPARE, txn_id);
+    xtxn.coordinator = true;
+    xtxn.client_id = request->client_id;
+    xtxn.request_id = request->request_id;
+    xtxn.start_time = now;
+    std::cout << "[State::LeaderState::start_xshard_txn] txn " << txn_id << " to shard " << get_config().shard_of(xtxn.txn.get_recver_id()) << ", sending prepare." << std::endl;
+    send_xshard_msg(XSHARD_PREPARE_RPC, xtxn, true);
+}
+
+void LeaderState::track_xshard_entry(int index) {
+    Transaction &txn = get_context()->get_bc_log().get_block_by_index(index).get_txn();
+    auto it = xshard_txns.find(txn.get_xshard_txn_id());
+    if (it == xshard_txns.end()) {
+        return;
+    }
+    it->second.entry_pending = false;
+    if (txn.get_xshard_phase() == XSHARD_PREPARE) {
+        it->second.prepare_index = index;
+    } else {
+        it->second.decision_index = index;
+    }
+}
+
+/**
+ * @brief Move every unfinished transfer forward once its entries are committed, and resend what's not answered.
+ *
+ */
+void LeaderState::check_xshard_txns() {
+    Server* context = get_context();
+    int committed_index = context->get_bc_log().get_committed_index();
+    auto now = clock_now();
+    for (auto it = xshard_txns.begin(); it != xshard_txns.end();) {
+        xshard_txn_t &xtxn = it->second;
+        // the decision is committed on both sides and the client got the result.
+        if (xtxn.peer_done && xtxn.client_id == -1) {
+            xshard_done.insert(it->first);
+            it = xshard_txns.erase(it);
+            continue;
+        }
+        auto entry = it++;
+        if (xtxn.entry_pending) {
+            continue;
+        }
+        bool retry = std::chrono::duration_cast<std::chrono::milliseconds>(now - xtxn.last_sent_time).count() >= XSHARD_RETRY_MS;
+        bool decided = xtxn.decision_index != -1 && xtxn.decision_index <= committed_index;
+
+        if (xtxn.coordinator) {
+            if (xtxn.decision_index == -1 && !xtxn.aborted) {
+                auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(now - xtxn.start_time);
+                if (xtxn.peer_prepared) {
+                    push_xshard_request(xtxn, XSHARD_COMMIT);
+                } else if (waited.count() > XSHARD_PREPARE_TIMEOUT_MS) {
+                    std::cout << "[State::LeaderState::check_xshard_txns] txn " << entry->first << " not prepared in time, abort." << std::endl;
+                    xtxn.aborted = true;
+                    xtxn.last_sent_time = std::chrono::system_clock::time_point();
+                } else if (retry) {
+                    send_xshard_msg(XSHARD_PREPARE_RPC, xtxn, true);
+                }
+                continue;
+            }
+            if ((decided || xtxn.aborted) && xtxn.client_id != -1) {
+                response_t response;
+                response.type = TRANSACTION_RESPONSE;
+                response.request_id = xtxn.request_id;
+                response.leader_id = context->get_id();
+                response.succeed = decided && xtxn.commit;
+                response.balance = -1;
+                context->reply_after_apply(decided ? xtxn.decision_index : committed_index, response, xtxn.client_id);
+                xtxn.client_id = -1;
+            }
+            if ((decided || xtxn.aborted) && !xtxn.peer_done && retry) {
+                send_xshard_msg(XSHARD_DECISION_RPC, xtxn, decided && xtxn.commit);
+            }
+        } else {
+            // the participant keeps voting until the decision is known, a coordinator that forgot the transfer aborts it.
+            if (xtxn.decision_index == -1 && xtxn.prepare_index != -1 && xtxn.prepare_index <= committed_index && retry) {
+                send_xshard_msg(XSHARD_PREPARE_RPL, xtxn, true);
+            }
+            if (decided && !xtxn.peer_done) {
+                send_xshard_msg(XSHARD_DECISION_RPL, xtxn, xtxn.commit);
+                xtxn.peer_done = true;
+            }
+        }
+    }
+}
+
+void LeaderState::handle_xshard_msg(replica_msg_wrapper_t &msg) {
+    Server* context = get_context();
+    xshard_rpc_t* rpc = &msg.xshard;
+    int committed_index = context->get_bc_log().get_committed_index();
+    auto it = xshard_txns.find(rpc->txn_id);
+
+    if (xshard_done.count(rpc->txn_id)) {
+        // a late duplicate, only the decision needs an answer.
+        if (msg.type == XSHARD_DECISION_RPC) {
+            xshard_txn_t xtxn;
+            xtxn.txn.set_xshard(XSHARD_ABORT, rpc->txn_id);
+            send_xshard_msg(XSHARD_DECISION_RPL, xtxn, rpc->commit, rpc->from_shard);
+        }
+        return;
+    }
+
+    if (msg.type == XSHARD_PREPARE_RPC) {
+        if (it != xshard_txns.end()) {
+            // already preparing, the vote is sent once the prepare entry is committed.
+            return;
+        }
+        xshard_txn_t &xtxn = xshard_txns[rpc->txn_id];
+        xtxn.txn = Transaction(rpc->sender_id, rpc->recver_id, rpc->amount);
+        xtxn.txn.set_xshard(XSHARD_PREPARE, rpc->txn_id);
+        xtxn.start_time = clock_now();
+        push_xshard_request(xtxn, XSHARD_PREPARE);
+    }
+    else if (msg.type == XSHARD_PREPARE_RPL) {
+        if (it == xshard_txns.end()) {
+            // presumed abort, the coordinator lost the transfer before deciding.
+            xshard_txn_t xtxn;
+            xtxn.txn.set_xshard(XSHARD_ABORT, rpc->txn_id);
+            send_xshard_msg(XSHARD_DECISION_RPC, xtxn, false, rpc->from_shard);
+            return;
+        }
+        xshard_txn_t &xtxn = it->second;
+        if (xtxn.decision_index == -1 && !xtxn.aborted) {
+            xtxn.peer_prepared = rpc->commit;
+            xtxn.aborted = !rpc->commit;
+        } else if (xtxn.aborted || xtxn.decision_index <= committed_index) {
+            // the participant missed the decision.
+            send_xshard_msg(XSHARD_DECISION_RPC, xtxn, !xtxn.aborted && xtxn.commit);
+        }
+    }
+    else if (msg.type == XSHARD_DECISION_RPC) {
+        if (it == xshard_txns.end()) {
+            // never prepared here, nothing to undo.
+            xshard_txn_t xtxn;
+            xtxn.txn.set_xshard(XSHARD_ABORT, rpc->txn_id);
+            send_xshard_msg(XSHARD_DECISION_RPL, xtxn, rpc->commit, rpc->from_shard);
+            return;
+        }
+        xshard_txn_t &xtxn = it->second;
+        if (xtxn.decision_index != -1 && xtxn.decision_index <= committed_index) {
+            send_xshard_msg(XSHARD_DECISION_RPL, xtxn, xtxn.commit);
+        } else if (xtxn.decision_index == -1 && !xtxn.entry_pending) {
+            push_xshard_request(xtxn, rpc->commit ? XSHARD_COMMIT : XSHARD_ABORT);
+        }
+    }
+    else if (msg.type == XSHARD_DECISION_RPL) {
+        if (it != xshard_txns.end()) {
+            it->second.peer_done = true;
+        }
+    }
+}
+
+/**
+ * @brief The cross shard entries go through the client request queue so they're appended and
+ *        replicated in order with the other requests.
+ *
+ * @param xtxn
+ * @param phase
+ */
+void LeaderState::push_xshard_request(xshard_txn_t &xtxn, uint32_t phase) {
+    request_t *request = new request_t();
+    bzero(request, sizeof(request_t));
+    request->type = XSHARD_REQUEST;
+    request->client_id = get_context()->get_id();
+    Transaction *txn = new Transaction(xtxn.txn);
+    txn->set_xshard(phase, xtxn.txn.get_xshard_txn_id());
+    request->payload = txn;
+    get_context()->get_network()->client_push_request(request);
+    xtxn.commit = (phase == XSHARD_COMMIT);
+    xtxn.entry_pending = true;
+}
+
+/**
+ * @brief Send a cross shard message to every server of the other shard of the transfer.
+ *        It's the receiver's shard for the coordinator and the sender's shard for the participant.
+ *
+ * @param type
+ * @param xtxn
+ * @param commit
+ * @param shard the destination if the transfer is unknown here, -1 for the other shard of the transfer.
+ */
+void LeaderState::send_xshard_msg(replica_msg_type_t type, xshard_txn_t &xtxn, bool commit, int shard) {
+    Server* context = get_context();
+    xshard_rpc_t rpc;
+    rpc.txn_id = xtxn.txn.get_xshard_txn_id();
+    rpc.from_shard = context->get_shard_id();
+    rpc.sender_id = xtxn.txn.get_sender_id();
+    rpc.recver_id = xtxn.txn.get_recver_id();
+    rpc.amount = xtxn.txn.get_amount();
+    rpc.commit = commit;
+    replica_msg_wrapper_t msg;
+    msg.type = type;
+    msg.xshard = rpc;
+    if (shard == -1) {
+        bool to_participant = (type == XSHARD_PREPARE_RPC || type == XSHARD_DECISION_RPC);
+        shard = get_config().shard_of(to_participant ? xtxn.txn.get_recver_id() : xtxn.txn.get_sender_id());
+    }
+    context->get_network()->replica_send_to_shard(msg, shard);
+    xtxn.last_sent_time = clock_now();
+}